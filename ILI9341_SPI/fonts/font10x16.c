@@ -0,0 +1,238 @@
+/* Generated by mkfont.py from font5x7.bdf, do not edit. */
+
+#include <stdint.h>
+#include "ili9341_font.h"
+
+static const uint8_t font10x16_bitmaps[1499] = {
+	0x0F, 0x05, 0x44, 0x40, 0x02, 0x24, 0x24, 0x24, 0x24, 0x24, 0x22, 0xF0, 0xF0, 0xF0, 0xF0, 0x22,
+	0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x2F, 0x05, 0x22, 0x22, 0x42, 0x22, 0x2F, 0x05, 0x22,
+	0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0xF0, 0x70, 0x42, 0x82, 0x68, 0x2A, 0x22, 0x42, 0x22,
+	0x66, 0x46, 0x62, 0x22, 0x42, 0x2A, 0x28, 0x62, 0x82, 0xF0, 0x90, 0x04, 0x64, 0x64, 0x46, 0x42,
+	0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x46, 0x44, 0x64, 0x64, 0xF0, 0x50, 0x24, 0x64, 0x42,
+	0x42, 0x22, 0x42, 0x22, 0x22, 0x42, 0x22, 0x62, 0x82, 0x62, 0x22, 0x24, 0x22, 0x24, 0x42, 0x22,
+	0x42, 0x44, 0x22, 0x24, 0x22, 0xF0, 0x50, 0x08, 0x22, 0x24, 0x22, 0xF0, 0xF0, 0xC0, 0x42, 0x42,
+	0x22, 0x42, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x62, 0x42, 0x62, 0x42, 0xC0, 0x02, 0x42, 0x62,
+	0x42, 0x62, 0x42, 0x42, 0x42, 0x42, 0x42, 0x22, 0x42, 0x22, 0x42, 0xF0, 0x10, 0xF0, 0x72, 0x22,
+	0x42, 0x22, 0x62, 0x82, 0x4F, 0x05, 0x42, 0x82, 0x62, 0x22, 0x42, 0x22, 0xF0, 0xF0, 0xC0, 0xF0,
+	0x92, 0x82, 0x82, 0x82, 0x4F, 0x05, 0x42, 0x82, 0x82, 0x82, 0xF0, 0xF0, 0xE0, 0xF0, 0xF0, 0x28,
+	0x22, 0x24, 0x22, 0xA0, 0xF0, 0xF0, 0xF0, 0xFF, 0x05, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0xF0,
+	0xF0, 0xAF, 0x01, 0x80, 0xF0, 0xD2, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0xF0,
+	0xF0, 0xF0, 0x30, 0x26, 0x46, 0x22, 0x64, 0x64, 0x46, 0x46, 0x22, 0x24, 0x22, 0x26, 0x46, 0x44,
+	0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x22, 0x42, 0x24, 0x24, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+	0x42, 0x42, 0x2C, 0xC0, 0x26, 0x46, 0x22, 0x64, 0x62, 0x82, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62,
+	0x82, 0x6F, 0x05, 0xF0, 0x50, 0x0F, 0x05, 0x62, 0x82, 0x62, 0x82, 0xA2, 0x82, 0xA2, 0x84, 0x64,
+	0x62, 0x26, 0x46, 0xF0, 0x70, 0x62, 0x82, 0x64, 0x64, 0x42, 0x22, 0x42, 0x22, 0x22, 0x42, 0x22,
+	0x42, 0x2F, 0x05, 0x62, 0x82, 0x82, 0x82, 0xF0, 0x70, 0x0F, 0x07, 0x82, 0x88, 0x28, 0xA2, 0x82,
+	0x82, 0x84, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x44, 0x64, 0x42, 0x82, 0x62, 0x82, 0x88, 0x28,
+	0x22, 0x64, 0x64, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x0F, 0x05, 0x82, 0x82, 0x62, 0x82, 0x62,
+	0x82, 0x62, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0, 0xB0, 0x26, 0x46, 0x22, 0x64, 0x64, 0x64, 0x62,
+	0x26, 0x46, 0x22, 0x64, 0x64, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x26, 0x46, 0x22, 0x64, 0x64,
+	0x64, 0x62, 0x28, 0x28, 0x82, 0x82, 0x62, 0x82, 0x44, 0x64, 0xF0, 0x90, 0x8F, 0x01, 0x8F, 0x01,
+	0xF0, 0x10, 0x8F, 0x01, 0x88, 0x22, 0x24, 0x22, 0xA0, 0x62, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+	0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0xF0, 0x10, 0xF0, 0xF0, 0xAF, 0x05, 0xF0, 0x5F, 0x05,
+	0xF0, 0xF0, 0xF0, 0xF0, 0x02, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x42, 0x62, 0x42, 0x62,
+	0x42, 0x62, 0xF0, 0x70, 0x26, 0x46, 0x22, 0x64, 0x62, 0x82, 0x82, 0x62, 0x82, 0x62, 0x82, 0xF0,
+	0xD2, 0x82, 0xF0, 0x90, 0x26, 0x46, 0x22, 0x64, 0x62, 0x82, 0x82, 0x24, 0x22, 0x24, 0x24, 0x22,
+	0x24, 0x22, 0x24, 0x22, 0x24, 0x22, 0x22, 0x26, 0x46, 0xF0, 0x70, 0x26, 0x46, 0x22, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x6F, 0x09, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50, 0x08, 0x28, 0x22, 0x64, 0x64,
+	0x64, 0x6A, 0x28, 0x22, 0x64, 0x64, 0x64, 0x6A, 0x28, 0xF0, 0x70, 0x26, 0x46, 0x22, 0x64, 0x64,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x06, 0x46, 0x42, 0x42,
+	0x22, 0x42, 0x22, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x42, 0x22, 0x42, 0x26, 0x46, 0xF0, 0x90,
+	0x0F, 0x07, 0x82, 0x82, 0x82, 0x88, 0x28, 0x22, 0x82, 0x82, 0x82, 0x8F, 0x05, 0xF0, 0x50, 0x0F,
+	0x07, 0x82, 0x82, 0x82, 0x88, 0x28, 0x22, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0, 0xD0, 0x26, 0x46,
+	0x22, 0x64, 0x64, 0x82, 0x82, 0x28, 0x28, 0x64, 0x64, 0x64, 0x62, 0x28, 0x28, 0xF0, 0x50, 0x02,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x6F, 0x09, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50, 0x0C,
+	0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x2C, 0xC0, 0x46, 0x46, 0x62, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x22, 0x42, 0x22, 0x42, 0x44, 0x64, 0xF0, 0x90, 0x02, 0x64,
+	0x64, 0x42, 0x22, 0x42, 0x22, 0x22, 0x42, 0x22, 0x44, 0x64, 0x62, 0x22, 0x42, 0x22, 0x42, 0x42,
+	0x22, 0x42, 0x22, 0x64, 0x62, 0xF0, 0x50, 0x02, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x8F, 0x05, 0xF0, 0x50, 0x02, 0x64, 0x66, 0x28, 0x26, 0x22, 0x24, 0x22, 0x24,
+	0x22, 0x24, 0x22, 0x24, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50, 0x02, 0x64, 0x64, 0x64,
+	0x66, 0x46, 0x44, 0x22, 0x24, 0x22, 0x24, 0x46, 0x46, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50, 0x26,
+	0x46, 0x22, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70,
+	0x08, 0x28, 0x22, 0x64, 0x64, 0x64, 0x6A, 0x28, 0x22, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0, 0xD0,
+	0x26, 0x46, 0x22, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x22, 0x24, 0x22, 0x24, 0x42, 0x22, 0x42,
+	0x44, 0x22, 0x24, 0x22, 0xF0, 0x50, 0x08, 0x28, 0x22, 0x64, 0x64, 0x64, 0x6A, 0x28, 0x22, 0x22,
+	0x42, 0x22, 0x42, 0x42, 0x22, 0x42, 0x22, 0x64, 0x62, 0xF0, 0x50, 0x28, 0x2A, 0x82, 0x82, 0x82,
+	0xA6, 0x46, 0xA2, 0x82, 0x82, 0x8A, 0x28, 0xF0, 0x70, 0x0F, 0x05, 0x42, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0, 0x90, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x62, 0x22, 0x22, 0x42, 0x22, 0x62, 0x82, 0xF0, 0x90, 0x02, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x22, 0x22,
+	0x22, 0x22, 0x42, 0x22, 0xF0, 0x70, 0x02, 0x64, 0x64, 0x64, 0x62, 0x22, 0x22, 0x42, 0x22, 0x62,
+	0x82, 0x62, 0x22, 0x42, 0x22, 0x22, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50, 0x02, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x62, 0x22, 0x22, 0x42, 0x22, 0x62, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0, 0x90, 0x0F,
+	0x05, 0x82, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x62, 0x82, 0x8F, 0x05, 0xF0, 0x50, 0x0E,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x4C, 0xC0, 0xF0, 0x52, 0x82, 0xA2, 0x82,
+	0xA2, 0x82, 0xA2, 0x82, 0xA2, 0x82, 0xF0, 0xF0, 0xA0, 0x0C, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+	0x42, 0x42, 0x42, 0x4E, 0xC0, 0x42, 0x82, 0x62, 0x22, 0x42, 0x22, 0x22, 0x64, 0x62, 0xF0, 0xF0,
+	0xF0, 0xF0, 0xF0, 0xF0, 0xA0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0x05, 0xF0, 0x50,
+	0x02, 0x42, 0x62, 0x42, 0x62, 0x42, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC6, 0x46, 0xA2, 0x82,
+	0x28, 0x2A, 0x64, 0x62, 0x28, 0x28, 0xF0, 0x50, 0x02, 0x82, 0x82, 0x82, 0x82, 0x24, 0x22, 0x24,
+	0x24, 0x46, 0x44, 0x64, 0x64, 0x64, 0x6A, 0x28, 0xF0, 0x70, 0xF0, 0xF0, 0xC6, 0x46, 0x22, 0x82,
+	0x82, 0x82, 0x82, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70, 0x82, 0x82, 0x82, 0x82, 0x24, 0x22, 0x24,
+	0x24, 0x46, 0x46, 0x64, 0x64, 0x64, 0x62, 0x28, 0x28, 0xF0, 0x50, 0xF0, 0xF0, 0xC6, 0x46, 0x22,
+	0x64, 0x6F, 0x09, 0x82, 0xA6, 0x46, 0xF0, 0x70, 0x44, 0x64, 0x42, 0x42, 0x22, 0x42, 0x22, 0x82,
+	0x66, 0x46, 0x62, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0, 0xB0, 0xF0, 0xF0, 0xC8, 0x2A, 0x64, 0x64,
+	0x64, 0x62, 0x28, 0x28, 0x82, 0x82, 0x26, 0x46, 0x20, 0x02, 0x82, 0x82, 0x82, 0x82, 0x24, 0x22,
+	0x24, 0x24, 0x46, 0x44, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50, 0x22, 0x42, 0xE4, 0x24,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x2C, 0xC0, 0x62, 0x62, 0xF0, 0x54, 0x44, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x64, 0x44, 0x42, 0x24, 0x44, 0x20, 0x02, 0x62, 0x62, 0x62, 0x62, 0x44, 0x44, 0x22,
+	0x22, 0x22, 0x24, 0x44, 0x42, 0x22, 0x22, 0x22, 0x22, 0x44, 0x42, 0xF0, 0x10, 0x04, 0x24, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x2C, 0xC0, 0xF0, 0xF0, 0xA4, 0x22, 0x24,
+	0x22, 0x22, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x64, 0x64, 0x64, 0x62, 0xF0, 0x50,
+	0xF0, 0xF0, 0xA2, 0x24, 0x22, 0x24, 0x24, 0x46, 0x44, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0xF0,
+	0x50, 0xF0, 0xF0, 0xC6, 0x46, 0x22, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x26, 0x46, 0xF0, 0x70,
+	0xF0, 0xF0, 0xA8, 0x28, 0x22, 0x64, 0x64, 0x64, 0x6A, 0x28, 0x22, 0x82, 0x82, 0x82, 0x80, 0xF0,
+	0xF0, 0xC4, 0x22, 0x24, 0x24, 0x46, 0x46, 0x46, 0x44, 0x24, 0x22, 0x24, 0x22, 0x82, 0x82, 0x82,
+	0x82, 0xF0, 0xF0, 0xA2, 0x24, 0x22, 0x24, 0x24, 0x46, 0x44, 0x82, 0x82, 0x82, 0x82, 0x82, 0xF0,
+	0xD0, 0xF0, 0xF0, 0xC6, 0x46, 0x22, 0x82, 0xA6, 0x46, 0xA2, 0x8A, 0x28, 0xF0, 0x70, 0x22, 0x82,
+	0x82, 0x82, 0x66, 0x46, 0x62, 0x82, 0x82, 0x82, 0x82, 0x42, 0x22, 0x42, 0x44, 0x64, 0xF0, 0x70,
+	0xF0, 0xF0, 0xA2, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x46, 0x44, 0x24, 0x22, 0x24, 0x22, 0xF0,
+	0x50, 0xF0, 0xF0, 0xA2, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x22, 0x22, 0x42, 0x22, 0x62, 0x82,
+	0xF0, 0x90, 0xF0, 0xF0, 0xA2, 0x64, 0x64, 0x64, 0x64, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x22,
+	0x22, 0x22, 0x22, 0x42, 0x22, 0xF0, 0x70, 0xF0, 0xF0, 0xA2, 0x64, 0x62, 0x22, 0x22, 0x42, 0x22,
+	0x62, 0x82, 0x62, 0x22, 0x42, 0x22, 0x22, 0x64, 0x62, 0xF0, 0x50, 0xF0, 0xF0, 0xA2, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x62, 0x28, 0x28, 0x82, 0x82, 0x26, 0x46, 0x20, 0xF0, 0xF0, 0xAF, 0x05, 0x62,
+	0x82, 0x62, 0x82, 0x62, 0x82, 0x6F, 0x05, 0xF0, 0x50, 0x42, 0x42, 0x22, 0x42, 0x42, 0x42, 0x22,
+	0x42, 0x62, 0x42, 0x42, 0x42, 0x62, 0x42, 0xC0, 0x0F, 0x0D, 0x40, 0x02, 0x42, 0x62, 0x42, 0x42,
+	0x42, 0x62, 0x42, 0x22, 0x42, 0x42, 0x42, 0x22, 0x42, 0xF0, 0x10, 0xF0, 0xF0, 0xC2, 0x82, 0x62,
+	0x22, 0x24, 0x22, 0x22, 0x62, 0x82, 0xF0, 0xF0, 0xF0, 0xF0, 0x20,
+};
+
+static const s_ili9341_glyph font10x16_glyphs[95] = {
+	{0, 0, 6, 0},	// ' '
+	{0, 2, 4, 0},	// '!'
+	{4, 6, 8, 0},	// '"'
+	{15, 10, 12, 0},	// '#'
+	{41, 10, 12, 0},	// '$'
+	{59, 10, 12, 0},	// '%'
+	{77, 10, 12, 0},	// '&'
+	{103, 4, 6, 0},	// '\''
+	{110, 6, 8, 0},	// '('
+	{125, 6, 8, 0},	// ')'
+	{141, 10, 12, 0},	// '*'
+	{159, 10, 12, 0},	// '+'
+	{173, 4, 6, 0},	// ','
+	{180, 10, 12, 0},	// '-'
+	{191, 4, 6, 0},	// '.'
+	{196, 10, 12, 0},	// '/'
+	{211, 10, 12, 0},	// '0'
+	{230, 6, 8, 0},	// '1'
+	{244, 10, 12, 0},	// '2'
+	{261, 10, 12, 0},	// '3'
+	{277, 10, 12, 0},	// '4'
+	{297, 10, 12, 0},	// '5'
+	{312, 10, 12, 0},	// '6'
+	{329, 10, 12, 0},	// '7'
+	{345, 10, 12, 0},	// '8'
+	{363, 10, 12, 0},	// '9'
+	{380, 4, 6, 0},	// ':'
+	{386, 4, 6, 0},	// ';'
+	{393, 8, 10, 0},	// '<'
+	{409, 10, 12, 0},	// '='
+	{420, 8, 10, 0},	// '>'
+	{436, 10, 12, 0},	// '?'
+	{452, 10, 12, 0},	// '@'
+	{475, 10, 12, 0},	// 'A'
+	{491, 10, 12, 0},	// 'B'
+	{507, 10, 12, 0},	// 'C'
+	{524, 10, 12, 0},	// 'D'
+	{544, 10, 12, 0},	// 'E'
+	{559, 10, 12, 0},	// 'F'
+	{574, 10, 12, 0},	// 'G'
+	{591, 10, 12, 0},	// 'H'
+	{607, 6, 8, 0},	// 'I'
+	{620, 10, 12, 0},	// 'J'
+	{638, 10, 12, 0},	// 'K'
+	{663, 10, 12, 0},	// 'L'
+	{679, 10, 12, 0},	// 'M'
+	{700, 10, 12, 0},	// 'N'
+	{719, 10, 12, 0},	// 'O'
+	{736, 10, 12, 0},	// 'P'
+	{752, 10, 12, 0},	// 'Q'
+	{774, 10, 12, 0},	// 'R'
+	{795, 10, 12, 0},	// 'S'
+	{809, 10, 12, 0},	// 'T'
+	{825, 10, 12, 0},	// 'U'
+	{842, 10, 12, 0},	// 'V'
+	{861, 10, 12, 0},	// 'W'
+	{886, 10, 12, 0},	// 'X'
+	{908, 10, 12, 0},	// 'Y'
+	{927, 10, 12, 0},	// 'Z'
+	{943, 6, 8, 0},	// '['
+	{955, 10, 12, 0},	// '\\'
+	{969, 6, 8, 0},	// ']'
+	{981, 10, 12, 0},	// '^'
+	{997, 10, 12, 0},	// '_'
+	{1008, 6, 8, 0},	// '`'
+	{1018, 10, 12, 0},	// 'a'
+	{1032, 10, 12, 0},	// 'b'
+	{1050, 10, 12, 0},	// 'c'
+	{1065, 10, 12, 0},	// 'd'
+	{1083, 10, 12, 0},	// 'e'
+	{1096, 10, 12, 0},	// 'f'
+	{1114, 10, 12, 0},	// 'g'
+	{1129, 10, 12, 0},	// 'h'
+	{1148, 6, 8, 0},	// 'i'
+	{1160, 8, 10, 0},	// 'j'
+	{1176, 8, 10, 0},	// 'k'
+	{1197, 6, 8, 0},	// 'l'
+	{1211, 10, 12, 0},	// 'm'
+	{1232, 10, 12, 0},	// 'n'
+	{1249, 10, 12, 0},	// 'o'
+	{1264, 10, 12, 0},	// 'p'
+	{1279, 10, 12, 0},	// 'q'
+	{1297, 10, 12, 0},	// 'r'
+	{1313, 10, 12, 0},	// 's'
+	{1326, 10, 12, 0},	// 't'
+	{1344, 10, 12, 0},	// 'u'
+	{1361, 10, 12, 0},	// 'v'
+	{1378, 10, 12, 0},	// 'w'
+	{1399, 10, 12, 0},	// 'x'
+	{1419, 10, 12, 0},	// 'y'
+	{1435, 10, 12, 0},	// 'z'
+	{1449, 6, 8, 0},	// '{'
+	{1464, 2, 4, 0},	// '|'
+	{1467, 6, 8, 0},	// '}'
+	{1483, 10, 12, 0},	// '~'
+};
+
+static const s_ili9341_kern font10x16_kerning[24] = {
+	{'A', 'T', -2},
+	{'A', 'V', -2},
+	{'A', 'W', -2},
+	{'A', 'Y', -2},
+	{'F', 'A', -2},
+	{'L', 'T', -2},
+	{'L', 'V', -2},
+	{'L', 'Y', -2},
+	{'P', 'A', -2},
+	{'T', ',', -2},
+	{'T', '.', -2},
+	{'T', 'A', -2},
+	{'T', 'a', -2},
+	{'T', 'e', -2},
+	{'T', 'o', -2},
+	{'T', 'y', -2},
+	{'V', 'A', -2},
+	{'V', 'a', -2},
+	{'V', 'e', -2},
+	{'V', 'o', -2},
+	{'W', 'A', -2},
+	{'Y', 'A', -2},
+	{'Y', 'e', -2},
+	{'Y', 'o', -2},
+};
+
+const s_ili9341_font font10x16 = {
+	.height = 16,
+	.bpp = 1,
+	.rle = 1,
+	.first = 32,
+	.count = 95,
+	.glyphs = font10x16_glyphs,
+	.bitmaps = font10x16_bitmaps,
+	.kerning = font10x16_kerning,
+	.kerning_count = 24
+};
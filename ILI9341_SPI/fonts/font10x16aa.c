@@ -0,0 +1,466 @@
+/* Generated by mkfont.py from font5x7.bdf, do not edit. */
+
+#include <stdint.h>
+#include "ili9341_font.h"
+
+static const uint8_t font10x16aa_bitmaps[5152] = {
+	0x1A, 0xFF, 0x1A, 0x30, 0x3A, 0x30, 0x1A, 0x10, 0x1A, 0x1F, 0x10, 0x3F, 0x10, 0x3F, 0x10, 0x3F,
+	0x10, 0x1F, 0x1A, 0x10, 0x1A, 0xF0, 0xF0, 0xF0, 0xB0, 0x10, 0x1A, 0x10, 0x1A, 0x30, 0x1F, 0x10,
+	0x1F, 0x20, 0x04, 0x1F, 0x10, 0x1F, 0x04, 0x00, 0x03, 0x0C, 0x1F, 0x15, 0x1F, 0x0C, 0x03, 0x0B,
+	0x7F, 0x0B, 0x0A, 0x7F, 0x0A, 0x00, 0x05, 0x1F, 0x15, 0x1F, 0x05, 0x10, 0x05, 0x1F, 0x15, 0x1F,
+	0x05, 0x00, 0x0A, 0x7F, 0x0A, 0x0B, 0x7F, 0x0B, 0x03, 0x0C, 0x1F, 0x15, 0x1F, 0x0C, 0x03, 0x00,
+	0x04, 0x1F, 0x10, 0x1F, 0x04, 0x20, 0x1F, 0x10, 0x1F, 0x30, 0x1A, 0x10, 0x1A, 0xF0, 0x50, 0x20,
+	0x03, 0x1B, 0x03, 0x40, 0x03, 0x0C, 0x1F, 0x0C, 0x04, 0x20, 0x03, 0x0C, 0x5F, 0x0A, 0x03, 0x0C,
+	0x6F, 0x0A, 0x0B, 0x0F, 0x15, 0x1F, 0x05, 0x20, 0x0B, 0x0F, 0x15, 0x1F, 0x05, 0x20, 0x03, 0x0C,
+	0x4F, 0x0B, 0x03, 0x10, 0x03, 0x0B, 0x4F, 0x0C, 0x03, 0x20, 0x05, 0x1F, 0x15, 0x0F, 0x0B, 0x20,
+	0x05, 0x1F, 0x15, 0x0F, 0x0B, 0x0A, 0x6F, 0x0C, 0x03, 0x0A, 0x5F, 0x0C, 0x03, 0x20, 0x04, 0x0C,
+	0x1F, 0x0C, 0x03, 0x40, 0x03, 0x1B, 0x03, 0xF0, 0x60, 0x03, 0x1B, 0x03, 0x50, 0x0B, 0x1F, 0x0B,
+	0x50, 0x0B, 0x1F, 0x0B, 0x20, 0x03, 0x0B, 0x0A, 0x03, 0x1B, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B,
+	0x40, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F,
+	0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03,
+	0x0C, 0x0F, 0x0C, 0x03, 0x40, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x1B, 0x03, 0x0A, 0x0B, 0x03,
+	0x20, 0x0B, 0x1F, 0x0B, 0x50, 0x0B, 0x1F, 0x0B, 0x50, 0x03, 0x1B, 0x03, 0xF0, 0x30, 0x00, 0x03,
+	0x0B, 0x1F, 0x0B, 0x03, 0x20, 0x03, 0x0C, 0x3F, 0x0C, 0x03, 0x10, 0x0B, 0x0F, 0x0C, 0x04, 0x00,
+	0x05, 0x0F, 0x0B, 0x10, 0x1F, 0x04, 0x10, 0x05, 0x0F, 0x0B, 0x10, 0x1F, 0x10, 0x0A, 0x0F, 0x0C,
+	0x03, 0x10, 0x0A, 0x09, 0x16, 0x09, 0x0B, 0x03, 0x30, 0x06, 0x19, 0x06, 0x50, 0x06, 0x19, 0x06,
+	0x40, 0x0A, 0x09, 0x16, 0x09, 0x0A, 0x10, 0x1A, 0x1F, 0x10, 0x0A, 0x09, 0x16, 0x09, 0x0A, 0x1F,
+	0x04, 0x10, 0x06, 0x19, 0x06, 0x00, 0x0B, 0x0F, 0x0C, 0x04, 0x00, 0x06, 0x19, 0x06, 0x00, 0x03,
+	0x0C, 0x2F, 0x09, 0x16, 0x09, 0x0A, 0x00, 0x03, 0x0B, 0x1F, 0x0A, 0x10, 0x1A, 0xF0, 0x30, 0x0A,
+	0x0F, 0x0B, 0x03, 0x0A, 0x1F, 0x0B, 0x00, 0x05, 0x1F, 0x00, 0x05, 0x0F, 0x0B, 0x0A, 0x0F, 0x0C,
+	0x03, 0x0A, 0x0B, 0x03, 0xF0, 0xF0, 0x80, 0x20, 0x03, 0x0B, 0x0A, 0x10, 0x03, 0x0C, 0x0F, 0x0B,
+	0x00, 0x03, 0x0C, 0x0F, 0x0C, 0x13, 0x0C, 0x0F, 0x0C, 0x03, 0x00, 0x0B, 0x0F, 0x0C, 0x03, 0x10,
+	0x1F, 0x04, 0x20, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x04, 0x20, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03,
+	0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x20,
+	0x03, 0x0B, 0x0A, 0xB0, 0x0A, 0x0B, 0x03, 0x20, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F,
+	0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x20, 0x04, 0x1F,
+	0x30, 0x1F, 0x30, 0x1F, 0x20, 0x04, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x00, 0x03, 0x0C, 0x0F,
+	0x0C, 0x13, 0x0C, 0x0F, 0x0C, 0x03, 0x00, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x0A, 0x0B, 0x03, 0xE0,
+	0xF0, 0x50, 0x1A, 0x10, 0x1A, 0x30, 0x0A, 0x09, 0x16, 0x09, 0x0A, 0x40, 0x06, 0x19, 0x06, 0x50,
+	0x05, 0x1F, 0x05, 0x20, 0x0A, 0x7F, 0x1A, 0x7F, 0x0A, 0x20, 0x05, 0x1F, 0x05, 0x50, 0x06, 0x19,
+	0x06, 0x40, 0x0A, 0x09, 0x16, 0x09, 0x0A, 0x30, 0x1A, 0x10, 0x1A, 0xF0, 0xF0, 0x90, 0xF0, 0x70,
+	0x1A, 0x70, 0x1F, 0x60, 0x04, 0x1F, 0x04, 0x40, 0x04, 0x0C, 0x1F, 0x0C, 0x04, 0x10, 0x0A, 0x7F,
+	0x1A, 0x7F, 0x0A, 0x10, 0x04, 0x0C, 0x1F, 0x0C, 0x04, 0x40, 0x04, 0x1F, 0x04, 0x60, 0x1F, 0x70,
+	0x1A, 0xF0, 0xF0, 0xB0, 0xF0, 0xF0, 0x0A, 0x0F, 0x0B, 0x03, 0x0A, 0x1F, 0x0B, 0x00, 0x05, 0x1F,
+	0x00, 0x05, 0x0F, 0x0B, 0x0A, 0x0F, 0x0C, 0x03, 0x0A, 0x0B, 0x03, 0x80, 0xF0, 0xF0, 0xF0, 0xB0,
+	0x0A, 0x7F, 0x1A, 0x7F, 0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x03, 0x1B, 0x03,
+	0x0B, 0x1F, 0x1B, 0x1F, 0x0B, 0x03, 0x1B, 0x03, 0x70, 0xF0, 0xA0, 0x03, 0x0B, 0x0A, 0x50, 0x03,
+	0x0C, 0x0F, 0x0B, 0x40, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30,
+	0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C,
+	0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x40, 0x0B, 0x0F, 0x0C, 0x03, 0x50, 0x0A, 0x0B, 0x03,
+	0xF0, 0xF0, 0xE0, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B,
+	0x0F, 0x0C, 0x04, 0x20, 0x05, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x05, 0x3F, 0x20, 0x03, 0x0B, 0x4F,
+	0x10, 0x03, 0x0C, 0x5F, 0x10, 0x0B, 0x0F, 0x15, 0x3F, 0x15, 0x0F, 0x0B, 0x10, 0x5F, 0x0C, 0x03,
+	0x10, 0x4F, 0x0B, 0x03, 0x20, 0x3F, 0x05, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x05, 0x20, 0x04, 0x0C,
+	0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0, 0x40, 0x00,
+	0x03, 0x0B, 0x0A, 0x10, 0x03, 0x0C, 0x1F, 0x10, 0x0B, 0x2F, 0x10, 0x0B, 0x2F, 0x10, 0x03, 0x0C,
+	0x1F, 0x20, 0x04, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x20, 0x04, 0x1F, 0x04,
+	0x00, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x0B, 0x3F, 0x0B, 0x0A, 0x3F, 0x0A, 0xB0, 0x00, 0x03, 0x0B,
+	0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C,
+	0x0F, 0x0B, 0x0A, 0x0B, 0x03, 0x30, 0x04, 0x1F, 0x60, 0x04, 0x1F, 0x50, 0x03, 0x0C, 0x0F, 0x0B,
+	0x40, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F,
+	0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x05, 0x40, 0x03, 0x0C,
+	0x1F, 0x05, 0x40, 0x0B, 0x7F, 0x1A, 0x7F, 0x0A, 0xF0, 0x30, 0x0A, 0x7F, 0x1A, 0x7F, 0x0B, 0x40,
+	0x05, 0x1F, 0x0C, 0x03, 0x40, 0x06, 0x09, 0x0B, 0x03, 0x40, 0x0A, 0x09, 0x06, 0x60, 0x0B, 0x0F,
+	0x05, 0x60, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x50, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x50, 0x03, 0x0C,
+	0x0F, 0x0B, 0x60, 0x04, 0x1F, 0x0A, 0x0B, 0x03, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10,
+	0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0,
+	0x40, 0x40, 0x03, 0x0B, 0x0A, 0x50, 0x03, 0x0C, 0x1F, 0x40, 0x03, 0x0C, 0x2F, 0x30, 0x03, 0x0C,
+	0x3F, 0x20, 0x03, 0x0C, 0x0F, 0x15, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0A, 0x10, 0x1F, 0x10, 0x0B,
+	0x0F, 0x05, 0x10, 0x04, 0x1F, 0x04, 0x00, 0x1F, 0x05, 0x00, 0x04, 0x0C, 0x1F, 0x0C, 0x03, 0x0B,
+	0x7F, 0x0B, 0x03, 0x0B, 0x6F, 0x0B, 0x30, 0x04, 0x0C, 0x1F, 0x0C, 0x03, 0x40, 0x04, 0x1F, 0x04,
+	0x60, 0x1F, 0x70, 0x1A, 0xF0, 0x50, 0x03, 0x0B, 0x6F, 0x0A, 0x0B, 0x7F, 0x0A, 0x1F, 0x05, 0x60,
+	0x1F, 0x05, 0x60, 0x0B, 0x5F, 0x0B, 0x03, 0x00, 0x03, 0x0B, 0x5F, 0x0C, 0x03, 0x50, 0x04, 0x0C,
+	0x0F, 0x0B, 0x60, 0x04, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x0A, 0x0B, 0x03, 0x30, 0x04, 0x1F, 0x0B,
+	0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B,
+	0x3F, 0x0B, 0x03, 0xF0, 0x40, 0x20, 0x03, 0x0B, 0x1F, 0x0A, 0x30, 0x03, 0x0C, 0x2F, 0x0A, 0x20,
+	0x03, 0x0C, 0x0F, 0x0C, 0x04, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x40, 0x0B, 0x0F, 0x05, 0x60,
+	0x1F, 0x05, 0x60, 0x6F, 0x0B, 0x03, 0x00, 0x7F, 0x0C, 0x03, 0x1F, 0x0C, 0x04, 0x10, 0x04, 0x0C,
+	0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10,
+	0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0,
+	0x40, 0x0A, 0x6F, 0x0B, 0x03, 0x0A, 0x7F, 0x0B, 0x60, 0x05, 0x1F, 0x60, 0x05, 0x0F, 0x0B, 0x40,
+	0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C,
+	0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x40, 0x0B, 0x0F, 0x0C, 0x03, 0x50, 0x1F, 0x04, 0x60,
+	0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1A, 0xF0, 0x90, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00,
+	0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04,
+	0x30, 0x04, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0A, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0A,
+	0x00, 0x05, 0x5F, 0x05, 0x10, 0x05, 0x5F, 0x05, 0x00, 0x0A, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C,
+	0x0F, 0x0A, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10,
+	0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0,
+	0x40, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C,
+	0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B,
+	0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x1F, 0x03, 0x0C, 0x7F, 0x00, 0x03, 0x0B, 0x6F, 0x60, 0x05,
+	0x1F, 0x60, 0x05, 0x0F, 0x0B, 0x40, 0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x30, 0x04, 0x0C, 0x0F, 0x0C,
+	0x03, 0x20, 0x0A, 0x2F, 0x0C, 0x03, 0x30, 0x0A, 0x1F, 0x0B, 0x03, 0xF0, 0x60, 0x70, 0x03, 0x1B,
+	0x03, 0x0B, 0x1F, 0x1B, 0x1F, 0x0B, 0x03, 0x1B, 0x03, 0x70, 0x03, 0x1B, 0x03, 0x0B, 0x1F, 0x1B,
+	0x1F, 0x0B, 0x03, 0x1B, 0x03, 0xF0, 0x70, 0x03, 0x1B, 0x03, 0x0B, 0x1F, 0x1B, 0x1F, 0x0B, 0x03,
+	0x1B, 0x03, 0x70, 0x0A, 0x0F, 0x0B, 0x03, 0x0A, 0x1F, 0x0B, 0x00, 0x05, 0x1F, 0x00, 0x05, 0x0F,
+	0x0B, 0x0A, 0x0F, 0x0C, 0x03, 0x0A, 0x0B, 0x03, 0x80, 0x40, 0x03, 0x0B, 0x0A, 0x30, 0x03, 0x0C,
+	0x0F, 0x0B, 0x20, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03,
+	0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x20, 0x0B, 0x0F, 0x05, 0x40, 0x0B,
+	0x0F, 0x05, 0x40, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03,
+	0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x40,
+	0x03, 0x0B, 0x0A, 0xF0, 0xF0, 0xF0, 0x70, 0x0A, 0x7F, 0x1A, 0x7F, 0x0A, 0xF0, 0x30, 0x0A, 0x7F,
+	0x1A, 0x7F, 0x0A, 0xF0, 0xF0, 0xF0, 0xB0, 0x0A, 0x0B, 0x03, 0x40, 0x0B, 0x0F, 0x0C, 0x03, 0x30,
+	0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C,
+	0x03, 0x30, 0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x40, 0x05, 0x0F, 0x0B, 0x40, 0x05, 0x0F, 0x0B, 0x20,
+	0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C,
+	0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x20, 0x0B, 0x0F, 0x0C, 0x03, 0x30, 0x0A, 0x0B, 0x03,
+	0xF0, 0x40, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F,
+	0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x0A, 0x0B, 0x03, 0x30, 0x04, 0x1F, 0x60, 0x04, 0x1F,
+	0x50, 0x03, 0x0C, 0x0F, 0x0B, 0x40, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C,
+	0x03, 0x40, 0x0B, 0x0F, 0x0C, 0x03, 0x50, 0x0A, 0x0B, 0x03, 0xF0, 0xA0, 0x1A, 0x70, 0x1A, 0xF0,
+	0x70, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C,
+	0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x0A, 0x0B, 0x03, 0x30, 0x04, 0x1F, 0x70, 0x1F, 0x70, 0x1F,
+	0x00, 0x03, 0x0B, 0x0F, 0x0B, 0x03, 0x10, 0x1F, 0x03, 0x0C, 0x2F, 0x0B, 0x10, 0x1F, 0x0B, 0x0F,
+	0x15, 0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x1F, 0x0B, 0x0F, 0x15, 0x1F,
+	0x15, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0, 0x40,
+	0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x04,
+	0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x04, 0x30,
+	0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0xFF, 0x7F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x3F, 0x04,
+	0x30, 0x04, 0x3F, 0x50, 0x1F, 0x1A, 0x50, 0x1A, 0xF0, 0x30, 0x03, 0x0B, 0x4F, 0x0B, 0x03, 0x00,
+	0x0B, 0x6F, 0x0C, 0x03, 0x1F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04,
+	0x3F, 0x04, 0x30, 0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0A, 0x7F, 0x05, 0x00, 0x7F,
+	0x05, 0x00, 0x1F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0A, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x04,
+	0x30, 0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x1B, 0x6F, 0x0C, 0x13, 0x0B, 0x4F, 0x0B,
+	0x03, 0xF0, 0x40, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B,
+	0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x03, 0x0B, 0x0A, 0x1F, 0x70,
+	0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x04, 0x30, 0x03, 0x0B, 0x0A,
+	0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03,
+	0x0B, 0x3F, 0x0B, 0x03, 0xF0, 0x40, 0x03, 0x0B, 0x2F, 0x0B, 0x03, 0x20, 0x0B, 0x4F, 0x0C, 0x03,
+	0x10, 0x1F, 0x0C, 0x14, 0x0C, 0x0F, 0x0C, 0x03, 0x00, 0x1F, 0x04, 0x10, 0x03, 0x0C, 0x0F, 0x0C,
+	0x03, 0x1F, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x1F, 0x40, 0x04, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x40,
+	0x04, 0x3F, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x1F,
+	0x0C, 0x14, 0x0C, 0x0F, 0x0C, 0x03, 0x00, 0x0B, 0x4F, 0x0C, 0x03, 0x10, 0x03, 0x0B, 0x2F, 0x0B,
+	0x03, 0xF0, 0x60, 0x03, 0x0B, 0x6F, 0x0A, 0x0B, 0x7F, 0x0A, 0x1F, 0x0C, 0x04, 0x50, 0x1F, 0x04,
+	0x60, 0x1F, 0x04, 0x60, 0x1F, 0x0C, 0x04, 0x50, 0x6F, 0x0A, 0x10, 0x6F, 0x0A, 0x10, 0x1F, 0x0C,
+	0x04, 0x50, 0x1F, 0x04, 0x60, 0x1F, 0x04, 0x60, 0x1F, 0x0C, 0x04, 0x50, 0x0B, 0x7F, 0x0A, 0x03,
+	0x0B, 0x6F, 0x0A, 0xF0, 0x30, 0x03, 0x0B, 0x6F, 0x0A, 0x0B, 0x7F, 0x0A, 0x1F, 0x0C, 0x04, 0x50,
+	0x1F, 0x04, 0x60, 0x1F, 0x04, 0x60, 0x1F, 0x0C, 0x04, 0x50, 0x6F, 0x0A, 0x10, 0x6F, 0x0A, 0x10,
+	0x1F, 0x0C, 0x04, 0x50, 0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1A, 0xF0, 0xB0,
+	0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x04,
+	0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x03, 0x0B, 0x0A, 0x1F, 0x70, 0x1F, 0x70, 0x1F,
+	0x10, 0x0A, 0x2F, 0x0B, 0x03, 0x1F, 0x10, 0x0A, 0x3F, 0x0B, 0x1F, 0x30, 0x04, 0x0C, 0x3F, 0x40,
+	0x04, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x1F, 0x03, 0x0C,
+	0x6F, 0x0B, 0x00, 0x03, 0x0B, 0x4F, 0x0B, 0x03, 0xF0, 0x30, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F,
+	0x50, 0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0xFF, 0x7F, 0x0C,
+	0x04, 0x10, 0x04, 0x0C, 0x3F, 0x04, 0x30, 0x04, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x1F, 0x1A,
+	0x50, 0x1A, 0xF0, 0x30, 0x0A, 0x3F, 0x0A, 0x0B, 0x3F, 0x0B, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x00,
+	0x04, 0x1F, 0x04, 0x20, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x20,
+	0x04, 0x1F, 0x04, 0x00, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x0B, 0x3F, 0x0B, 0x0A, 0x3F, 0x0A, 0xB0,
+	0x30, 0x0A, 0x3F, 0x0A, 0x30, 0x0B, 0x3F, 0x0B, 0x30, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x40, 0x04,
+	0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x10, 0x0A,
+	0x0B, 0x03, 0x10, 0x04, 0x1F, 0x10, 0x0B, 0x0F, 0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x10, 0x03, 0x0C,
+	0x3F, 0x0C, 0x03, 0x20, 0x03, 0x0B, 0x1F, 0x0B, 0x03, 0xF0, 0x60, 0x1A, 0x40, 0x03, 0x0B, 0x0A,
+	0x1F, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x1F, 0x20, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x1F, 0x10, 0x03,
+	0x0C, 0x0F, 0x0C, 0x03, 0x00, 0x1F, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x1F, 0x05, 0x06, 0x09,
+	0x0B, 0x03, 0x20, 0x2F, 0x09, 0x06, 0x40, 0x2F, 0x09, 0x06, 0x40, 0x1F, 0x05, 0x06, 0x09, 0x0B,
+	0x03, 0x20, 0x1F, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03,
+	0x00, 0x1F, 0x20, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x1F, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x1A, 0x40,
+	0x03, 0x0B, 0x0A, 0xF0, 0x30, 0x1A, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F,
+	0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x04, 0x60, 0x1F, 0x0C, 0x04, 0x50,
+	0x0B, 0x7F, 0x0A, 0x03, 0x0B, 0x6F, 0x0A, 0xF0, 0x30, 0x0A, 0x0B, 0x03, 0x30, 0x03, 0x0B, 0x0A,
+	0x1F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x4F, 0x0B, 0x10, 0x0B, 0x5F, 0x09, 0x16, 0x09, 0x4F, 0x05,
+	0x06, 0x19, 0x06, 0x05, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10, 0x1A, 0x10,
+	0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x1F, 0x1A, 0x50, 0x1A, 0xF0, 0x30,
+	0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F, 0x04, 0x40, 0x3F, 0x0C, 0x03, 0x30, 0x4F, 0x0C, 0x03, 0x20,
+	0x5F, 0x0C, 0x03, 0x10, 0x3F, 0x15, 0x0F, 0x0B, 0x10, 0x3F, 0x10, 0x0B, 0x0F, 0x15, 0x3F, 0x10,
+	0x03, 0x0C, 0x5F, 0x20, 0x03, 0x0C, 0x4F, 0x30, 0x03, 0x0C, 0x3F, 0x40, 0x04, 0x3F, 0x50, 0x1F,
+	0x1A, 0x50, 0x1A, 0xF0, 0x30, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C,
+	0x03, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x50,
+	0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B,
+	0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B,
+	0x3F, 0x0B, 0x03, 0xF0, 0x40, 0x03, 0x0B, 0x4F, 0x0B, 0x03, 0x00, 0x0B, 0x6F, 0x0C, 0x03, 0x1F,
+	0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x04, 0x30, 0x04, 0x3F,
+	0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x7F, 0x0C, 0x03, 0x6F, 0x0B, 0x03, 0x00, 0x1F, 0x0C,
+	0x04, 0x50, 0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1A, 0xF0, 0xB0, 0x00, 0x03,
+	0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04,
+	0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F,
+	0x10, 0x1A, 0x10, 0x3F, 0x10, 0x0A, 0x09, 0x16, 0x09, 0x0A, 0x1F, 0x04, 0x10, 0x06, 0x19, 0x06,
+	0x00, 0x0B, 0x0F, 0x0C, 0x04, 0x00, 0x06, 0x19, 0x06, 0x00, 0x03, 0x0C, 0x2F, 0x09, 0x16, 0x09,
+	0x0A, 0x00, 0x03, 0x0B, 0x1F, 0x0A, 0x10, 0x1A, 0xF0, 0x30, 0x03, 0x0B, 0x4F, 0x0B, 0x03, 0x00,
+	0x0B, 0x6F, 0x0C, 0x03, 0x1F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04,
+	0x3F, 0x04, 0x30, 0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x7F, 0x0C, 0x03, 0x6F,
+	0x0B, 0x03, 0x00, 0x1F, 0x15, 0x1F, 0x05, 0x20, 0x1F, 0x10, 0x0B, 0x0F, 0x05, 0x20, 0x1F, 0x10,
+	0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x00, 0x1F, 0x20, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x1F, 0x30, 0x03,
+	0x0C, 0x0F, 0x0B, 0x1A, 0x40, 0x03, 0x0B, 0x0A, 0xF0, 0x30, 0x00, 0x03, 0x0B, 0x5F, 0x0A, 0x03,
+	0x0C, 0x6F, 0x0A, 0x0B, 0x0F, 0x0C, 0x04, 0x50, 0x1F, 0x04, 0x60, 0x1F, 0x04, 0x60, 0x0B, 0x0F,
+	0x0C, 0x04, 0x50, 0x03, 0x0C, 0x4F, 0x0B, 0x03, 0x10, 0x03, 0x0B, 0x4F, 0x0C, 0x03, 0x50, 0x04,
+	0x0C, 0x0F, 0x0B, 0x60, 0x04, 0x1F, 0x60, 0x04, 0x1F, 0x50, 0x04, 0x0C, 0x0F, 0x0B, 0x0A, 0x6F,
+	0x0C, 0x03, 0x0A, 0x5F, 0x0B, 0x03, 0xF0, 0x40, 0x0A, 0x7F, 0x1A, 0x7F, 0x0A, 0x10, 0x04, 0x0C,
+	0x1F, 0x0C, 0x04, 0x40, 0x04, 0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70,
+	0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1A, 0xF0, 0x70, 0x1A, 0x50, 0x1A,
+	0x1F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50,
+	0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B,
+	0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0, 0x40, 0x1A, 0x50, 0x1A,
+	0x1F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x04,
+	0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x0F, 0x0B,
+	0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0C, 0x0F, 0x15, 0x0F, 0x0C, 0x03, 0x20, 0x03, 0x0C,
+	0x1F, 0x0C, 0x03, 0x40, 0x03, 0x1B, 0x03, 0xF0, 0x60, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F, 0x50,
+	0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x10, 0x1A, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10,
+	0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x1F, 0x0B, 0x0F, 0x05, 0x06, 0x19,
+	0x06, 0x05, 0x0F, 0x0B, 0x03, 0x0C, 0x0F, 0x09, 0x16, 0x09, 0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0B,
+	0x0A, 0x10, 0x0A, 0x0B, 0x03, 0xF0, 0x40, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F, 0x04, 0x30, 0x04,
+	0x1F, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B,
+	0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x09, 0x16, 0x09, 0x0B, 0x03, 0x30, 0x06, 0x19, 0x06, 0x50,
+	0x06, 0x19, 0x06, 0x30, 0x03, 0x0B, 0x09, 0x16, 0x09, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x0F, 0x0B,
+	0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x1F, 0x04,
+	0x30, 0x04, 0x3F, 0x50, 0x1F, 0x1A, 0x50, 0x1A, 0xF0, 0x30, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F,
+	0x50, 0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F,
+	0x0B, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0C, 0x0F, 0x15, 0x0F,
+	0x0C, 0x03, 0x20, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x40, 0x04, 0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F,
+	0x70, 0x1F, 0x70, 0x1A, 0xF0, 0x70, 0x0A, 0x6F, 0x0B, 0x03, 0x0A, 0x7F, 0x0B, 0x60, 0x05, 0x1F,
+	0x60, 0x05, 0x0F, 0x0B, 0x40, 0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03,
+	0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F,
+	0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x40, 0x0B, 0x0F, 0x05, 0x60, 0x1F, 0x05, 0x60,
+	0x0B, 0x7F, 0x0A, 0x03, 0x0B, 0x6F, 0x0A, 0xF0, 0x30, 0x03, 0x0B, 0x2F, 0x0A, 0x0B, 0x3F, 0x0A,
+	0x1F, 0x0C, 0x04, 0x10, 0x1F, 0x04, 0x20, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F,
+	0x30, 0x1F, 0x30, 0x1F, 0x04, 0x20, 0x1F, 0x0C, 0x04, 0x10, 0x0B, 0x3F, 0x0A, 0x03, 0x0B, 0x2F,
+	0x0A, 0xB0, 0xF0, 0x30, 0x0A, 0x0B, 0x03, 0x60, 0x0B, 0x0F, 0x0C, 0x03, 0x50, 0x03, 0x0C, 0x0F,
+	0x0C, 0x03, 0x50, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x50, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x50, 0x03,
+	0x0C, 0x0F, 0x0C, 0x03, 0x50, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x50, 0x03, 0x0C, 0x0F, 0x0C, 0x03,
+	0x50, 0x03, 0x0C, 0x0F, 0x0B, 0x60, 0x03, 0x0B, 0x0A, 0xF0, 0xF0, 0x70, 0x0A, 0x2F, 0x0B, 0x03,
+	0x0A, 0x3F, 0x0B, 0x10, 0x04, 0x0C, 0x1F, 0x20, 0x04, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F,
+	0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x20, 0x04, 0x1F, 0x10, 0x04, 0x0C, 0x1F, 0x0A, 0x3F, 0x0B,
+	0x0A, 0x2F, 0x0B, 0x03, 0xB0, 0x20, 0x03, 0x1B, 0x03, 0x40, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x20,
+	0x03, 0x0C, 0x0F, 0x15, 0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B, 0x0F, 0x0C,
+	0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x0A, 0x0B, 0x03, 0x30, 0x03, 0x0B,
+	0x0A, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x30, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70,
+	0x0A, 0x7F, 0x1A, 0x7F, 0x0A, 0xF0, 0x30, 0x0A, 0x0B, 0x03, 0x20, 0x0B, 0x0F, 0x0C, 0x03, 0x10,
+	0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B,
+	0x20, 0x03, 0x0B, 0x0A, 0xF0, 0xF0, 0xF0, 0xB0, 0xF0, 0xF0, 0x90, 0x0A, 0x3F, 0x0B, 0x03, 0x20,
+	0x0A, 0x4F, 0x0C, 0x03, 0x60, 0x05, 0x0F, 0x0B, 0x60, 0x05, 0x1F, 0x00, 0x03, 0x0B, 0x6F, 0x03,
+	0x0C, 0x7F, 0x0B, 0x0F, 0x05, 0x30, 0x05, 0x1F, 0x0B, 0x0F, 0x05, 0x30, 0x05, 0x1F, 0x03, 0x0C,
+	0x6F, 0x0B, 0x00, 0x03, 0x0B, 0x4F, 0x0B, 0x03, 0xF0, 0x30, 0x1A, 0x70, 0x1F, 0x70, 0x1F, 0x70,
+	0x1F, 0x70, 0x1F, 0x10, 0x0A, 0x1F, 0x0B, 0x03, 0x00, 0x1F, 0x15, 0x3F, 0x0C, 0x03, 0x3F, 0x0C,
+	0x14, 0x0C, 0x0F, 0x0B, 0x2F, 0x0C, 0x03, 0x10, 0x04, 0x3F, 0x0C, 0x03, 0x30, 0x3F, 0x04, 0x40,
+	0x3F, 0x04, 0x30, 0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x1B, 0x6F, 0x0C, 0x13, 0x0B,
+	0x4F, 0x0B, 0x03, 0xF0, 0x40, 0xF0, 0xF0, 0x80, 0x03, 0x0B, 0x3F, 0x0A, 0x10, 0x03, 0x0C, 0x4F,
+	0x0A, 0x10, 0x0B, 0x0F, 0x0C, 0x04, 0x50, 0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x04,
+	0x30, 0x03, 0x0B, 0x0A, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x5F,
+	0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0, 0x40, 0x70, 0x1A, 0x70, 0x1F, 0x70, 0x1F,
+	0x70, 0x1F, 0x00, 0x03, 0x0B, 0x1F, 0x0A, 0x10, 0x1F, 0x03, 0x0C, 0x3F, 0x15, 0x1F, 0x0B, 0x0F,
+	0x0C, 0x14, 0x0C, 0x5F, 0x04, 0x10, 0x03, 0x0C, 0x4F, 0x30, 0x03, 0x0C, 0x3F, 0x40, 0x04, 0x3F,
+	0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x1F, 0x03, 0x0C, 0x6F, 0x0B,
+	0x00, 0x03, 0x0B, 0x4F, 0x0B, 0x03, 0xF0, 0x30, 0xF0, 0xF0, 0x80, 0x03, 0x0B, 0x3F, 0x0B, 0x03,
+	0x00, 0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x0B, 0x0F, 0x05, 0x30, 0x05, 0x0F, 0x0B, 0x1F, 0x05, 0x30,
+	0x05, 0xAF, 0x0B, 0x7F, 0x0B, 0x03, 0x1F, 0x05, 0x60, 0x0B, 0x0F, 0x05, 0x60, 0x03, 0x0C, 0x4F,
+	0x0A, 0x20, 0x03, 0x0B, 0x3F, 0x0A, 0xF0, 0x50, 0x20, 0x03, 0x0B, 0x1F, 0x0B, 0x03, 0x20, 0x03,
+	0x0C, 0x3F, 0x0C, 0x03, 0x10, 0x0B, 0x0F, 0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x10, 0x1F, 0x04, 0x10,
+	0x03, 0x0B, 0x0A, 0x00, 0x04, 0x1F, 0x04, 0x40, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x30, 0x0B, 0x3F,
+	0x0B, 0x30, 0x0B, 0x3F, 0x0B, 0x30, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x40, 0x04, 0x1F, 0x04, 0x60,
+	0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1A, 0xF0, 0x90, 0xF0, 0xF0, 0x80, 0x03, 0x0B, 0x4F, 0x0B,
+	0x13, 0x0C, 0x6F, 0x1B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x3F, 0x04, 0x30, 0x04, 0x3F, 0x04,
+	0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x1F, 0x03, 0x0C, 0x7F, 0x00, 0x03,
+	0x0B, 0x6F, 0x60, 0x05, 0x1F, 0x60, 0x05, 0x0F, 0x0B, 0x10, 0x0A, 0x4F, 0x0C, 0x03, 0x10, 0x0A,
+	0x3F, 0x0B, 0x03, 0x00, 0x1A, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x10, 0x0A, 0x1F,
+	0x0B, 0x03, 0x00, 0x1F, 0x15, 0x3F, 0x0C, 0x03, 0x3F, 0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x2F, 0x0C,
+	0x03, 0x10, 0x04, 0x3F, 0x0C, 0x03, 0x30, 0x3F, 0x04, 0x40, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50,
+	0x1F, 0x1A, 0x50, 0x1A, 0xF0, 0x30, 0x10, 0x1A, 0x30, 0x1A, 0xD0, 0x0A, 0x0F, 0x0B, 0x03, 0x10,
+	0x0B, 0x1F, 0x0B, 0x10, 0x03, 0x0C, 0x1F, 0x20, 0x04, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x20, 0x04,
+	0x1F, 0x04, 0x00, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x0B, 0x3F, 0x0B, 0x0A, 0x3F, 0x0A, 0xB0, 0x50,
+	0x1A, 0x50, 0x1A, 0xF0, 0x30, 0x0A, 0x0F, 0x0B, 0x03, 0x30, 0x0B, 0x1F, 0x0B, 0x30, 0x03, 0x0C,
+	0x1F, 0x40, 0x04, 0x1F, 0x50, 0x1F, 0x50, 0x1F, 0x50, 0x1F, 0x50, 0x1F, 0x0A, 0x0B, 0x03, 0x10,
+	0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x3F, 0x0C, 0x03, 0x00, 0x03,
+	0x0B, 0x1F, 0x0B, 0x03, 0x00, 0x1A, 0x50, 0x1F, 0x50, 0x1F, 0x50, 0x1F, 0x50, 0x1F, 0x20, 0x03,
+	0x0B, 0x0A, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x1F, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x1F, 0x05,
+	0x06, 0x09, 0x0B, 0x03, 0x00, 0x2F, 0x09, 0x06, 0x20, 0x2F, 0x09, 0x06, 0x20, 0x1F, 0x05, 0x06,
+	0x09, 0x0B, 0x03, 0x00, 0x1F, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0B,
+	0x1A, 0x20, 0x03, 0x0B, 0x0A, 0xF0, 0x0A, 0x0F, 0x0B, 0x03, 0x10, 0x0B, 0x1F, 0x0B, 0x10, 0x03,
+	0x0C, 0x1F, 0x20, 0x04, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30,
+	0x1F, 0x20, 0x04, 0x1F, 0x04, 0x00, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x0B, 0x3F, 0x0B, 0x0A, 0x3F,
+	0x0A, 0xB0, 0xF0, 0xF0, 0x70, 0x03, 0x0B, 0x0F, 0x0A, 0x10, 0x0A, 0x0B, 0x03, 0x00, 0x0B, 0x1F,
+	0x09, 0x16, 0x09, 0x0F, 0x0C, 0x03, 0x1F, 0x05, 0x06, 0x19, 0x06, 0x05, 0x0F, 0x0B, 0x1F, 0x10,
+	0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10, 0x1A, 0x10, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50,
+	0x1F, 0x1A, 0x50, 0x1A, 0xF0, 0x30, 0xF0, 0xF0, 0x70, 0x1A, 0x10, 0x0A, 0x1F, 0x0B, 0x03, 0x00,
+	0x1F, 0x15, 0x3F, 0x0C, 0x03, 0x3F, 0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x2F, 0x0C, 0x03, 0x10, 0x04,
+	0x3F, 0x0C, 0x03, 0x30, 0x3F, 0x04, 0x40, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x1F, 0x1A, 0x50,
+	0x1A, 0xF0, 0x30, 0xF0, 0xF0, 0x80, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0x00, 0x03, 0x0C, 0x5F, 0x0C,
+	0x03, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x50,
+	0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x10, 0x04, 0x0C, 0x0F, 0x0B,
+	0x03, 0x0C, 0x5F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x3F, 0x0B, 0x03, 0xF0, 0x40, 0xF0, 0xF0, 0x70,
+	0x03, 0x0B, 0x4F, 0x0B, 0x03, 0x00, 0x0B, 0x6F, 0x0C, 0x03, 0x1F, 0x0C, 0x04, 0x10, 0x04, 0x0C,
+	0x0F, 0x0B, 0x1F, 0x04, 0x30, 0x04, 0x3F, 0x04, 0x30, 0x04, 0x3F, 0x0C, 0x04, 0x10, 0x04, 0x0C,
+	0x0F, 0x0B, 0x7F, 0x0C, 0x03, 0x6F, 0x0B, 0x03, 0x00, 0x1F, 0x0C, 0x04, 0x50, 0x1F, 0x04, 0x60,
+	0x1F, 0x70, 0x1A, 0x70, 0xF0, 0xF0, 0x80, 0x03, 0x0B, 0x1F, 0x0A, 0x10, 0x1A, 0x03, 0x0C, 0x3F,
+	0x00, 0x04, 0x1F, 0x0B, 0x0F, 0x0C, 0x04, 0x05, 0x0E, 0x01, 0x0B, 0x3F, 0x04, 0x10, 0x06, 0x09,
+	0x4F, 0x04, 0x10, 0x06, 0x09, 0x2F, 0x0B, 0x0F, 0x0C, 0x04, 0x05, 0x0E, 0x01, 0x0B, 0x1F, 0x03,
+	0x0C, 0x3F, 0x00, 0x04, 0x1F, 0x00, 0x03, 0x0B, 0x1F, 0x0A, 0x10, 0x1F, 0x70, 0x1F, 0x70, 0x1F,
+	0x70, 0x1F, 0x70, 0x1A, 0xF0, 0xF0, 0x70, 0x1A, 0x10, 0x0A, 0x1F, 0x0B, 0x03, 0x00, 0x1F, 0x15,
+	0x3F, 0x0C, 0x03, 0x3F, 0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x2F, 0x0C, 0x03, 0x10, 0x03, 0x0B, 0x0A,
+	0x1F, 0x0C, 0x03, 0x50, 0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x70, 0x1A, 0xF0, 0xB0,
+	0xF0, 0xF0, 0x80, 0x03, 0x0B, 0x3F, 0x0A, 0x10, 0x03, 0x0C, 0x4F, 0x0A, 0x10, 0x0B, 0x0F, 0x05,
+	0x60, 0x0B, 0x0F, 0x05, 0x60, 0x03, 0x0C, 0x4F, 0x0B, 0x03, 0x10, 0x03, 0x0B, 0x4F, 0x0C, 0x03,
+	0x60, 0x05, 0x0F, 0x0B, 0x60, 0x05, 0x0F, 0x0B, 0x0A, 0x6F, 0x0C, 0x03, 0x0A, 0x5F, 0x0B, 0x03,
+	0xF0, 0x40, 0x10, 0x1A, 0x70, 0x1F, 0x60, 0x04, 0x1F, 0x04, 0x40, 0x03, 0x0C, 0x1F, 0x0C, 0x03,
+	0x30, 0x0B, 0x3F, 0x0B, 0x30, 0x0B, 0x3F, 0x0B, 0x30, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x40, 0x04,
+	0x1F, 0x04, 0x60, 0x1F, 0x70, 0x1F, 0x70, 0x1F, 0x04, 0x10, 0x03, 0x0B, 0x0A, 0x10, 0x0B, 0x0F,
+	0x0C, 0x14, 0x0C, 0x0F, 0x0B, 0x10, 0x03, 0x0C, 0x3F, 0x0C, 0x03, 0x20, 0x03, 0x0B, 0x1F, 0x0B,
+	0x03, 0xF0, 0x40, 0xF0, 0xF0, 0x70, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F,
+	0x40, 0x04, 0x3F, 0x30, 0x03, 0x0C, 0x3F, 0x04, 0x10, 0x03, 0x0C, 0x2F, 0x0B, 0x0F, 0x0C, 0x14,
+	0x0C, 0x3F, 0x03, 0x0C, 0x3F, 0x15, 0x1F, 0x00, 0x03, 0x0B, 0x1F, 0x0A, 0x10, 0x1A, 0xF0, 0x30,
+	0xF0, 0xF0, 0x70, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04,
+	0x1F, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B,
+	0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0C, 0x0F, 0x15, 0x0F, 0x0C, 0x03, 0x20, 0x03, 0x0C, 0x1F, 0x0C,
+	0x03, 0x40, 0x03, 0x1B, 0x03, 0xF0, 0x60, 0xF0, 0xF0, 0x70, 0x1A, 0x50, 0x1A, 0x1F, 0x50, 0x3F,
+	0x50, 0x3F, 0x50, 0x3F, 0x10, 0x1A, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x3F, 0x10, 0x1F, 0x10, 0x1F,
+	0x0B, 0x0F, 0x05, 0x06, 0x19, 0x06, 0x05, 0x0F, 0x0B, 0x03, 0x0C, 0x0F, 0x09, 0x16, 0x09, 0x0F,
+	0x0C, 0x03, 0x00, 0x03, 0x0B, 0x0A, 0x10, 0x0A, 0x0B, 0x03, 0xF0, 0x40, 0xF0, 0xF0, 0x70, 0x0A,
+	0x0B, 0x03, 0x30, 0x03, 0x0B, 0x0A, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x03,
+	0x0C, 0x0F, 0x0B, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x00, 0x03, 0x0B, 0x09, 0x16, 0x09, 0x0B, 0x03,
+	0x30, 0x06, 0x19, 0x06, 0x50, 0x06, 0x19, 0x06, 0x30, 0x03, 0x0B, 0x09, 0x16, 0x09, 0x0B, 0x03,
+	0x00, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03,
+	0x0C, 0x0F, 0x0B, 0x0A, 0x0B, 0x03, 0x30, 0x03, 0x0B, 0x0A, 0xF0, 0x30, 0xF0, 0xF0, 0x70, 0x1A,
+	0x50, 0x1A, 0x1F, 0x50, 0x3F, 0x50, 0x3F, 0x50, 0x3F, 0x04, 0x30, 0x04, 0x1F, 0x0B, 0x0F, 0x0C,
+	0x04, 0x10, 0x04, 0x0C, 0x1F, 0x03, 0x0C, 0x7F, 0x00, 0x03, 0x0B, 0x6F, 0x60, 0x05, 0x1F, 0x60,
+	0x05, 0x0F, 0x0B, 0x10, 0x0A, 0x4F, 0x0C, 0x03, 0x10, 0x0A, 0x3F, 0x0B, 0x03, 0x00, 0xF0, 0xF0,
+	0x70, 0x0A, 0x7F, 0x1A, 0x7F, 0x0B, 0x40, 0x05, 0x1F, 0x0C, 0x03, 0x40, 0x05, 0x0F, 0x0C, 0x03,
+	0x30, 0x03, 0x0B, 0x0F, 0x0C, 0x03, 0x30, 0x03, 0x0C, 0x0F, 0x0B, 0x03, 0x30, 0x03, 0x0C, 0x0F,
+	0x05, 0x40, 0x03, 0x0C, 0x1F, 0x05, 0x40, 0x0B, 0x7F, 0x1A, 0x7F, 0x0A, 0xF0, 0x30, 0x20, 0x03,
+	0x0B, 0x0A, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x1F, 0x04, 0x10,
+	0x04, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0A, 0x10, 0x0B, 0x0F, 0x05, 0x20, 0x0B, 0x0F, 0x05, 0x20,
+	0x03, 0x0C, 0x0F, 0x0A, 0x20, 0x04, 0x1F, 0x30, 0x1F, 0x04, 0x20, 0x0B, 0x0F, 0x0C, 0x03, 0x10,
+	0x03, 0x0C, 0x0F, 0x0B, 0x20, 0x03, 0x0B, 0x0A, 0xB0, 0x1A, 0xFF, 0x7F, 0x1A, 0x30, 0x0A, 0x0B,
+	0x03, 0x20, 0x0B, 0x0F, 0x0C, 0x03, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x20, 0x04, 0x1F, 0x30, 0x1F,
+	0x04, 0x20, 0x0A, 0x0F, 0x0C, 0x03, 0x20, 0x05, 0x0F, 0x0B, 0x20, 0x05, 0x0F, 0x0B, 0x10, 0x0A,
+	0x0F, 0x0C, 0x03, 0x10, 0x1F, 0x04, 0x10, 0x04, 0x1F, 0x10, 0x03, 0x0C, 0x0F, 0x0B, 0x10, 0x0B,
+	0x0F, 0x0C, 0x03, 0x10, 0x0A, 0x0B, 0x03, 0xE0, 0xF0, 0xF0, 0x80, 0x03, 0x1B, 0x03, 0x40, 0x03,
+	0x0C, 0x1F, 0x0C, 0x03, 0x30, 0x0B, 0x0F, 0x15, 0x0F, 0x0B, 0x10, 0x3A, 0x10, 0x0B, 0x0F, 0x15,
+	0x0F, 0x0B, 0x30, 0x03, 0x0C, 0x1F, 0x0C, 0x03, 0x40, 0x03, 0x1B, 0x03, 0xF0, 0xF0, 0xF0, 0xC0,
+};
+
+static const s_ili9341_glyph font10x16aa_glyphs[95] = {
+	{0, 0, 6, 0},	// ' '
+	{0, 2, 4, 0},	// '!'
+	{6, 6, 8, 0},	// '"'
+	{25, 10, 12, 0},	// '#'
+	{95, 10, 12, 0},	// '$'
+	{169, 10, 12, 0},	// '%'
+	{254, 10, 12, 0},	// '&'
+	{351, 4, 6, 0},	// '\''
+	{375, 6, 8, 0},	// '('
+	{436, 6, 8, 0},	// ')'
+	{496, 10, 12, 0},	// '*'
+	{542, 10, 12, 0},	// '+'
+	{580, 4, 6, 0},	// ','
+	{604, 10, 12, 0},	// '-'
+	{618, 4, 6, 0},	// '.'
+	{633, 10, 12, 0},	// '/'
+	{691, 10, 12, 0},	// '0'
+	{767, 6, 8, 0},	// '1'
+	{813, 10, 12, 0},	// '2'
+	{890, 10, 12, 0},	// '3'
+	{961, 10, 12, 0},	// '4'
+	{1030, 10, 12, 0},	// '5'
+	{1093, 10, 12, 0},	// '6'
+	{1169, 10, 12, 0},	// '7'
+	{1225, 10, 12, 0},	// '8'
+	{1313, 10, 12, 0},	// '9'
+	{1389, 4, 6, 0},	// ':'
+	{1414, 4, 6, 0},	// ';'
+	{1449, 8, 10, 0},	// '<'
+	{1524, 10, 12, 0},	// '='
+	{1543, 8, 10, 0},	// '>'
+	{1618, 10, 12, 0},	// '?'
+	{1681, 10, 12, 0},	// '@'
+	{1760, 10, 12, 0},	// 'A'
+	{1818, 10, 12, 0},	// 'B'
+	{1891, 10, 12, 0},	// 'C'
+	{1958, 10, 12, 0},	// 'D'
+	{2035, 10, 12, 0},	// 'E'
+	{2085, 10, 12, 0},	// 'F'
+	{2128, 10, 12, 0},	// 'G'
+	{2202, 10, 12, 0},	// 'H'
+	{2244, 6, 8, 0},	// 'I'
+	{2288, 10, 12, 0},	// 'J'
+	{2347, 10, 12, 0},	// 'K'
+	{2437, 10, 12, 0},	// 'L'
+	{2473, 10, 12, 0},	// 'M'
+	{2528, 10, 12, 0},	// 'N'
+	{2581, 10, 12, 0},	// 'O'
+	{2645, 10, 12, 0},	// 'P'
+	{2702, 10, 12, 0},	// 'Q'
+	{2778, 10, 12, 0},	// 'R'
+	{2858, 10, 12, 0},	// 'S'
+	{2920, 10, 12, 0},	// 'T'
+	{2957, 10, 12, 0},	// 'U'
+	{3005, 10, 12, 0},	// 'V'
+	{3065, 10, 12, 0},	// 'W'
+	{3127, 10, 12, 0},	// 'X'
+	{3210, 10, 12, 0},	// 'Y'
+	{3270, 10, 12, 0},	// 'Z'
+	{3337, 6, 8, 0},	// '['
+	{3378, 10, 12, 0},	// '\\'
+	{3436, 6, 8, 0},	// ']'
+	{3477, 10, 12, 0},	// '^'
+	{3528, 10, 12, 0},	// '_'
+	{3543, 6, 8, 0},	// '`'
+	{3576, 10, 12, 0},	// 'a'
+	{3626, 10, 12, 0},	// 'b'
+	{3685, 10, 12, 0},	// 'c'
+	{3738, 10, 12, 0},	// 'd'
+	{3800, 10, 12, 0},	// 'e'
+	{3848, 10, 12, 0},	// 'f'
+	{3913, 10, 12, 0},	// 'g'
+	{3972, 10, 12, 0},	// 'h'
+	{4022, 6, 8, 0},	// 'i'
+	{4063, 8, 10, 0},	// 'j'
+	{4117, 8, 10, 0},	// 'k'
+	{4182, 6, 8, 0},	// 'l'
+	{4226, 10, 12, 0},	// 'm'
+	{4278, 10, 12, 0},	// 'n'
+	{4323, 10, 12, 0},	// 'o'
+	{4381, 10, 12, 0},	// 'p'
+	{4436, 10, 12, 0},	// 'q'
+	{4500, 10, 12, 0},	// 'r'
+	{4544, 10, 12, 0},	// 's'
+	{4594, 10, 12, 0},	// 't'
+	{4659, 10, 12, 0},	// 'u'
+	{4704, 10, 12, 0},	// 'v'
+	{4759, 10, 12, 0},	// 'w'
+	{4812, 10, 12, 0},	// 'x'
+	{4892, 10, 12, 0},	// 'y'
+	{4942, 10, 12, 0},	// 'z'
+	{4990, 6, 8, 0},	// '{'
+	{5049, 2, 4, 0},	// '|'
+	{5054, 6, 8, 0},	// '}'
+	{5112, 10, 12, 0},	// '~'
+};
+
+static const s_ili9341_kern font10x16aa_kerning[24] = {
+	{'A', 'T', -2},
+	{'A', 'V', -2},
+	{'A', 'W', -2},
+	{'A', 'Y', -2},
+	{'F', 'A', -2},
+	{'L', 'T', -2},
+	{'L', 'V', -2},
+	{'L', 'Y', -2},
+	{'P', 'A', -2},
+	{'T', ',', -2},
+	{'T', '.', -2},
+	{'T', 'A', -2},
+	{'T', 'a', -2},
+	{'T', 'e', -2},
+	{'T', 'o', -2},
+	{'T', 'y', -2},
+	{'V', 'A', -2},
+	{'V', 'a', -2},
+	{'V', 'e', -2},
+	{'V', 'o', -2},
+	{'W', 'A', -2},
+	{'Y', 'A', -2},
+	{'Y', 'e', -2},
+	{'Y', 'o', -2},
+};
+
+const s_ili9341_font font10x16aa = {
+	.height = 16,
+	.bpp = 4,
+	.rle = 1,
+	.first = 32,
+	.count = 95,
+	.glyphs = font10x16aa_glyphs,
+	.bitmaps = font10x16aa_bitmaps,
+	.kerning = font10x16aa_kerning,
+	.kerning_count = 24
+};
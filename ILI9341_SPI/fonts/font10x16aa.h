@@ -0,0 +1,10 @@
+/* Generated by mkfont.py from font5x7.bdf, do not edit. */
+
+#ifndef ILI9341_SPI_FONTS_FONT10X16AA_H_
+#define ILI9341_SPI_FONTS_FONT10X16AA_H_
+
+#include "ili9341_font.h"
+
+extern const s_ili9341_font font10x16aa;
+
+#endif /* ILI9341_SPI_FONTS_FONT10X16AA_H_ */
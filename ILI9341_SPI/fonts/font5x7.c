@@ -0,0 +1,171 @@
+/* Generated by mkfont.py from font5x7.bdf, do not edit. */
+
+#include <stdint.h>
+#include "ili9341_font.h"
+
+static const uint8_t font5x7_bitmaps[419] = {
+	0xFA, 0xB6, 0x80, 0x00, 0x52, 0xBE, 0xAF, 0xA9, 0x40, 0x23, 0xE8, 0xE2, 0xF8, 0x80, 0xC6, 0x44,
+	0x44, 0x4C, 0x60, 0x64, 0xA8, 0x8A, 0xC9, 0xA0, 0xD8, 0x00, 0x2A, 0x48, 0x88, 0x88, 0x92, 0xA0,
+	0x02, 0x89, 0xF2, 0x28, 0x00, 0x01, 0x09, 0xF2, 0x10, 0x00, 0x00, 0xD8, 0x00, 0x01, 0xF0, 0x00,
+	0x00, 0x00, 0x3C, 0x00, 0x44, 0x44, 0x40, 0x00, 0x74, 0x67, 0x5C, 0xC5, 0xC0, 0x59, 0x24, 0xB8,
+	0x74, 0x42, 0x22, 0x23, 0xE0, 0xF8, 0x88, 0x20, 0xC5, 0xC0, 0x11, 0x95, 0x2F, 0x88, 0x40, 0xFC,
+	0x3C, 0x10, 0xC5, 0xC0, 0x32, 0x21, 0xE8, 0xC5, 0xC0, 0xF8, 0x44, 0x44, 0x21, 0x00, 0x74, 0x62,
+	0xE8, 0xC5, 0xC0, 0x74, 0x62, 0xF0, 0x89, 0x80, 0x3C, 0xF0, 0x3C, 0xD8, 0x12, 0x48, 0x42, 0x10,
+	0x00, 0x3E, 0x0F, 0x80, 0x00, 0x84, 0x21, 0x24, 0x80, 0x74, 0x42, 0x22, 0x00, 0x80, 0x74, 0x42,
+	0xDA, 0xD5, 0xC0, 0x74, 0x63, 0x1F, 0xC6, 0x20, 0xF4, 0x63, 0xE8, 0xC7, 0xC0, 0x74, 0x61, 0x08,
+	0x45, 0xC0, 0xE4, 0xA3, 0x18, 0xCB, 0x80, 0xFC, 0x21, 0xE8, 0x43, 0xE0, 0xFC, 0x21, 0xE8, 0x42,
+	0x00, 0x74, 0x61, 0x78, 0xC5, 0xE0, 0x8C, 0x63, 0xF8, 0xC6, 0x20, 0xE9, 0x24, 0xB8, 0x38, 0x84,
+	0x21, 0x49, 0x80, 0x8C, 0xA9, 0x8A, 0x4A, 0x20, 0x84, 0x21, 0x08, 0x43, 0xE0, 0x8E, 0xEB, 0x58,
+	0xC6, 0x20, 0x8C, 0x73, 0x59, 0xC6, 0x20, 0x74, 0x63, 0x18, 0xC5, 0xC0, 0xF4, 0x63, 0xE8, 0x42,
+	0x00, 0x74, 0x63, 0x1A, 0xC9, 0xA0, 0xF4, 0x63, 0xEA, 0x4A, 0x20, 0x7C, 0x20, 0xE0, 0x87, 0xC0,
+	0xF9, 0x08, 0x42, 0x10, 0x80, 0x8C, 0x63, 0x18, 0xC5, 0xC0, 0x8C, 0x63, 0x18, 0xA8, 0x80, 0x8C,
+	0x63, 0x5A, 0xD5, 0x40, 0x8C, 0x54, 0x45, 0x46, 0x20, 0x8C, 0x62, 0xA2, 0x10, 0x80, 0xF8, 0x44,
+	0x44, 0x43, 0xE0, 0xF2, 0x49, 0x38, 0x04, 0x10, 0x41, 0x04, 0x00, 0xE4, 0x92, 0x78, 0x22, 0xA2,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x88, 0x80, 0x00, 0x00, 0x1C, 0x17, 0xC5, 0xE0,
+	0x84, 0x2D, 0x98, 0xC7, 0xC0, 0x00, 0x1D, 0x08, 0x45, 0xC0, 0x08, 0x5B, 0x38, 0xC5, 0xE0, 0x00,
+	0x1D, 0x1F, 0xC1, 0xC0, 0x32, 0x51, 0xC4, 0x21, 0x00, 0x00, 0x1F, 0x18, 0xBC, 0x2E, 0x84, 0x2D,
+	0x98, 0xC6, 0x20, 0x43, 0x24, 0xB8, 0x10, 0x31, 0x11, 0x96, 0x88, 0x9A, 0xCA, 0x90, 0xC9, 0x24,
+	0xB8, 0x00, 0x35, 0x5A, 0xC6, 0x20, 0x00, 0x2D, 0x98, 0xC6, 0x20, 0x00, 0x1D, 0x18, 0xC5, 0xC0,
+	0x00, 0x3D, 0x18, 0xFA, 0x10, 0x00, 0x1B, 0x39, 0xB4, 0x21, 0x00, 0x2D, 0x98, 0x42, 0x00, 0x00,
+	0x1D, 0x07, 0x07, 0xC0, 0x42, 0x38, 0x84, 0x24, 0xC0, 0x00, 0x23, 0x18, 0xCD, 0xA0, 0x00, 0x23,
+	0x18, 0xA8, 0x80, 0x00, 0x23, 0x1A, 0xD5, 0x40, 0x00, 0x22, 0xA2, 0x2A, 0x20, 0x00, 0x23, 0x18,
+	0xBC, 0x2E, 0x00, 0x3E, 0x22, 0x23, 0xE0, 0x29, 0x44, 0x88, 0xFE, 0x89, 0x14, 0xA0, 0x00, 0x11,
+	0x51, 0x00, 0x00,
+};
+
+static const s_ili9341_glyph font5x7_glyphs[95] = {
+	{0, 0, 3, 0},	// ' '
+	{0, 1, 2, 0},	// '!'
+	{1, 3, 4, 0},	// '"'
+	{4, 5, 6, 0},	// '#'
+	{9, 5, 6, 0},	// '$'
+	{14, 5, 6, 0},	// '%'
+	{19, 5, 6, 0},	// '&'
+	{24, 2, 3, 0},	// '\''
+	{26, 3, 4, 0},	// '('
+	{29, 3, 4, 0},	// ')'
+	{32, 5, 6, 0},	// '*'
+	{37, 5, 6, 0},	// '+'
+	{42, 2, 3, 0},	// ','
+	{44, 5, 6, 0},	// '-'
+	{49, 2, 3, 0},	// '.'
+	{51, 5, 6, 0},	// '/'
+	{56, 5, 6, 0},	// '0'
+	{61, 3, 4, 0},	// '1'
+	{64, 5, 6, 0},	// '2'
+	{69, 5, 6, 0},	// '3'
+	{74, 5, 6, 0},	// '4'
+	{79, 5, 6, 0},	// '5'
+	{84, 5, 6, 0},	// '6'
+	{89, 5, 6, 0},	// '7'
+	{94, 5, 6, 0},	// '8'
+	{99, 5, 6, 0},	// '9'
+	{104, 2, 3, 0},	// ':'
+	{106, 2, 3, 0},	// ';'
+	{108, 4, 5, 0},	// '<'
+	{112, 5, 6, 0},	// '='
+	{117, 4, 5, 0},	// '>'
+	{121, 5, 6, 0},	// '?'
+	{126, 5, 6, 0},	// '@'
+	{131, 5, 6, 0},	// 'A'
+	{136, 5, 6, 0},	// 'B'
+	{141, 5, 6, 0},	// 'C'
+	{146, 5, 6, 0},	// 'D'
+	{151, 5, 6, 0},	// 'E'
+	{156, 5, 6, 0},	// 'F'
+	{161, 5, 6, 0},	// 'G'
+	{166, 5, 6, 0},	// 'H'
+	{171, 3, 4, 0},	// 'I'
+	{174, 5, 6, 0},	// 'J'
+	{179, 5, 6, 0},	// 'K'
+	{184, 5, 6, 0},	// 'L'
+	{189, 5, 6, 0},	// 'M'
+	{194, 5, 6, 0},	// 'N'
+	{199, 5, 6, 0},	// 'O'
+	{204, 5, 6, 0},	// 'P'
+	{209, 5, 6, 0},	// 'Q'
+	{214, 5, 6, 0},	// 'R'
+	{219, 5, 6, 0},	// 'S'
+	{224, 5, 6, 0},	// 'T'
+	{229, 5, 6, 0},	// 'U'
+	{234, 5, 6, 0},	// 'V'
+	{239, 5, 6, 0},	// 'W'
+	{244, 5, 6, 0},	// 'X'
+	{249, 5, 6, 0},	// 'Y'
+	{254, 5, 6, 0},	// 'Z'
+	{259, 3, 4, 0},	// '['
+	{262, 5, 6, 0},	// '\\'
+	{267, 3, 4, 0},	// ']'
+	{270, 5, 6, 0},	// '^'
+	{275, 5, 6, 0},	// '_'
+	{280, 3, 4, 0},	// '`'
+	{283, 5, 6, 0},	// 'a'
+	{288, 5, 6, 0},	// 'b'
+	{293, 5, 6, 0},	// 'c'
+	{298, 5, 6, 0},	// 'd'
+	{303, 5, 6, 0},	// 'e'
+	{308, 5, 6, 0},	// 'f'
+	{313, 5, 6, 0},	// 'g'
+	{318, 5, 6, 0},	// 'h'
+	{323, 3, 4, 0},	// 'i'
+	{326, 4, 5, 0},	// 'j'
+	{330, 4, 5, 0},	// 'k'
+	{334, 3, 4, 0},	// 'l'
+	{337, 5, 6, 0},	// 'm'
+	{342, 5, 6, 0},	// 'n'
+	{347, 5, 6, 0},	// 'o'
+	{352, 5, 6, 0},	// 'p'
+	{357, 5, 6, 0},	// 'q'
+	{362, 5, 6, 0},	// 'r'
+	{367, 5, 6, 0},	// 's'
+	{372, 5, 6, 0},	// 't'
+	{377, 5, 6, 0},	// 'u'
+	{382, 5, 6, 0},	// 'v'
+	{387, 5, 6, 0},	// 'w'
+	{392, 5, 6, 0},	// 'x'
+	{397, 5, 6, 0},	// 'y'
+	{402, 5, 6, 0},	// 'z'
+	{407, 3, 4, 0},	// '{'
+	{410, 1, 2, 0},	// '|'
+	{411, 3, 4, 0},	// '}'
+	{414, 5, 6, 0},	// '~'
+};
+
+static const s_ili9341_kern font5x7_kerning[24] = {
+	{'A', 'T', -1},
+	{'A', 'V', -1},
+	{'A', 'W', -1},
+	{'A', 'Y', -1},
+	{'F', 'A', -1},
+	{'L', 'T', -1},
+	{'L', 'V', -1},
+	{'L', 'Y', -1},
+	{'P', 'A', -1},
+	{'T', ',', -1},
+	{'T', '.', -1},
+	{'T', 'A', -1},
+	{'T', 'a', -1},
+	{'T', 'e', -1},
+	{'T', 'o', -1},
+	{'T', 'y', -1},
+	{'V', 'A', -1},
+	{'V', 'a', -1},
+	{'V', 'e', -1},
+	{'V', 'o', -1},
+	{'W', 'A', -1},
+	{'Y', 'A', -1},
+	{'Y', 'e', -1},
+	{'Y', 'o', -1},
+};
+
+const s_ili9341_font font5x7 = {
+	.height = 8,
+	.bpp = 1,
+	.rle = 0,
+	.first = 32,
+	.count = 95,
+	.glyphs = font5x7_glyphs,
+	.bitmaps = font5x7_bitmaps,
+	.kerning = font5x7_kerning,
+	.kerning_count = 24
+};
@@ -0,0 +1,10 @@
+/* Generated by mkfont.py from font5x7.bdf, do not edit. */
+
+#ifndef ILI9341_SPI_FONTS_FONT5X7_H_
+#define ILI9341_SPI_FONTS_FONT5X7_H_
+
+#include "ili9341_font.h"
+
+extern const s_ili9341_font font5x7;
+
+#endif /* ILI9341_SPI_FONTS_FONT5X7_H_ */
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""
+Font table generator of the ILI9341 font engine (ili9341_font.h).
+
+Reads a BDF bitmap font, and writes <name>.c, <name>.h: the glyph bitmaps (packed, or run length
+encoded), the glyph lookup index (first .. last character), and the sorted kerning pairs. The
+tables are const, so they stay in the flash.
+
+  mkfont.py font5x7.bdf font5x7 --proportional --kern font5x7.kern
+  mkfont.py font5x7.bdf font10x16 --scale 2 --rle --proportional --kern font5x7.kern
+  mkfont.py font5x7.bdf font10x16aa --scale 2 --aa --rle --proportional --kern font5x7.kern
+
+The run length encoding pays off from the 2x scale: the strokes of the small fonts are short runs.
+
+The kerning file has one pair per line: two characters, and the advance adjust in pixels
+(for example "AV -1"). The lines starting with # are comments.
+"""
+
+import argparse
+import os
+
+
+def parse_bdf(path):
+    """The glyphs of the BDF font: {code: (dwidth, [rows of 0/1 pixels, top first], xoff)}, ascent, descent."""
+    glyphs = {}
+    ascent = descent = None
+    with open(path) as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "STARTCHAR":
+            code = dwidth = bbx = None
+            for line in lines:
+                words = line.split()
+                if words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    dwidth = int(words[1])
+                elif words[0] == "BBX":
+                    bbx = [int(w) for w in words[1:5]]
+                elif words[0] == "BITMAP":
+                    break
+            w, h, xoff, yoff = bbx
+            rows = []
+            for _ in range(h):
+                bits = int(next(lines), 16)
+                nbits = ((w + 7) // 8) * 8
+                rows.append([(bits >> (nbits - 1 - x)) & 1 for x in range(w)])
+            glyphs[code] = (dwidth, rows, xoff, yoff)
+    return glyphs, ascent, descent
+
+
+def cell(glyph, ascent, height):
+    """The glyph bitmap in a font height cell: rows of pixels, the left offset, and the advance."""
+    dwidth, rows, xoff, yoff = glyph
+    w = len(rows[0]) if rows else 0
+    top = ascent - (yoff + len(rows))
+    bitmap = [[0] * w for _ in range(height)]
+    for y, row in enumerate(rows):
+        if 0 <= top + y < height:
+            bitmap[top + y] = list(row)
+    return bitmap, xoff, dwidth
+
+
+def trim(bitmap, left, advance):
+    """Proportional glyph: the empty columns are cut, the advance is the width, and one column of gap."""
+    w = len(bitmap[0]) if bitmap else 0
+    used = [x for x in range(w) if any(row[x] for row in bitmap)]
+    if not used:
+        return [[] for _ in bitmap], 0, max(2, advance // 2)
+    a, b = used[0], used[-1]
+    return [row[a:b + 1] for row in bitmap], 0, b - a + 2
+
+
+def scale(bitmap, n):
+    return [[p for p in row for _ in range(n)] for row in bitmap for _ in range(n)]
+
+
+def epx(bitmap):
+    """Scale2x (EPX): the double size bitmap, the diagonal steps become smooth edges."""
+    h, w = len(bitmap), len(bitmap[0]) if bitmap else 0
+    px = lambda x, y: bitmap[y][x] if 0 <= x < w and 0 <= y < h else 0
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            p, a, b, c, d = px(x, y), px(x, y - 1), px(x + 1, y), px(x - 1, y), px(x, y + 1)
+            out[2 * y][2 * x] = a if c == a and c != d and a != b else p
+            out[2 * y][2 * x + 1] = b if a == b and a != c and b != d else p
+            out[2 * y + 1][2 * x] = c if d == c and d != b and c != a else p
+            out[2 * y + 1][2 * x + 1] = d if b == d and b != a and d != c else p
+    return out
+
+
+def antialias(bitmap, n):
+    """4 bpp coverage of the n times scaled bitmap: 8x by EPX, and the average of the 8 / n size boxes."""
+    for _ in range(3):
+        bitmap = epx(bitmap)
+    box = 8 // n
+    h, w = len(bitmap) // box, (len(bitmap[0]) if bitmap else 0) // box
+    out = []
+    for y in range(h):
+        row = []
+        for x in range(w):
+            cover = sum(bitmap[y * box + j][x * box + i] for j in range(box) for i in range(box))
+            row.append((cover * 15 + box * box // 2) // (box * box))
+        out.append(row)
+    return out
+
+
+def pack(pixels, bpp):
+    """The pixel values MSB first, no padding at the row ends."""
+    out, acc, bits = [], 0, 0
+    for p in pixels:
+        acc = (acc << bpp) | p
+        bits += bpp
+        if bits == 8:
+            out.append(acc)
+            acc, bits = 0, 0
+    if bits:
+        out.append(acc << (8 - bits))
+    return out
+
+
+def rle(pixels, bpp):
+    """
+    1 bpp: a byte is a background run in the upper nibble, and the foreground run after it in the lower
+    nibble (0 .. 15 pixels both). 2, 4 bpp: a byte is the run length - 1 in the upper 8 - bpp bits, and
+    the value of the run.
+    """
+    out, i, longest = [], 0, 1 << (8 - bpp)
+    if bpp == 1:
+        while i < len(pixels):
+            bg = fg = 0
+            while i < len(pixels) and not pixels[i] and bg < 15:
+                bg, i = bg + 1, i + 1
+            while i < len(pixels) and pixels[i] and fg < 15:
+                fg, i = fg + 1, i + 1
+            out.append((bg << 4) | fg)
+        return out
+    while i < len(pixels):
+        n = 1
+        while i + n < len(pixels) and n < longest and pixels[i + n] == pixels[i]:
+            n += 1
+        out.append(((n - 1) << bpp) | pixels[i])
+        i += n
+    return out
+
+
+def parse_kern(path, scale):
+    pairs = {}
+    with open(path) as f:
+        for line in f:
+            if not line.strip() or line.startswith("#"):
+                continue
+            pair, adjust = line[:2], int(line[2:].split()[0])
+            pairs[(ord(pair[0]), ord(pair[1]))] = adjust * scale
+    return sorted(pairs.items())
+
+
+def c_char(code):
+    c = chr(code)
+    return "'\\''" if c == "'" else "'\\\\'" if c == "\\" else "'%s'" % c
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[1], formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("bdf")
+    ap.add_argument("name")
+    ap.add_argument("--first", type=int, default=32)
+    ap.add_argument("--last", type=int, default=126)
+    ap.add_argument("--scale", type=int, default=1)
+    ap.add_argument("--rle", action="store_true")
+    ap.add_argument("--proportional", action="store_true")
+    ap.add_argument("--kern")
+    ap.add_argument("--aa", action="store_true", help="4 bpp anti-aliased glyphs (scale 2, or 4)")
+    args = ap.parse_args()
+
+    glyphs, ascent, descent = parse_bdf(args.bdf)
+    height = (ascent + descent) * args.scale
+    bpp = 4 if args.aa else 1
+    data, index = [], []
+    for code in range(args.first, args.last + 1):
+        if code not in glyphs:
+            index.append((0, 0, 0, 0, code))
+            continue
+        bitmap, left, advance = cell(glyphs[code], ascent, ascent + descent)
+        if args.proportional:
+            bitmap, left, advance = trim(bitmap, left, advance)
+        bitmap = antialias(bitmap, args.scale) if args.aa else scale(bitmap, args.scale)
+        width = len(bitmap[0]) if bitmap else 0
+        pixels = [p for row in bitmap for p in row]
+        encoded = rle(pixels, bpp) if args.rle else pack(pixels, bpp)
+        index.append((len(data), width, advance * args.scale, left * args.scale, code))
+        data += encoded
+    kerning = parse_kern(args.kern, args.scale) if args.kern else []
+
+    name, base = args.name, os.path.basename(args.name)
+    source = os.path.basename(args.bdf)
+    with open(name + ".h", "w") as f:
+        guard = "ILI9341_SPI_FONTS_%s_H_" % base.upper()
+        f.write("/* Generated by mkfont.py from %s, do not edit. */\n\n" % source)
+        f.write("#ifndef %s\n#define %s\n\n#include \"ili9341_font.h\"\n\n" % (guard, guard))
+        f.write("extern const s_ili9341_font %s;\n\n#endif /* %s */\n" % (base, guard))
+    with open(name + ".c", "w") as f:
+        f.write("/* Generated by mkfont.py from %s, do not edit. */\n\n" % source)
+        f.write("#include <stdint.h>\n#include \"ili9341_font.h\"\n\n")
+        f.write("static const uint8_t %s_bitmaps[%d] = {\n" % (base, len(data)))
+        for i in range(0, len(data), 16):
+            f.write("\t" + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write("static const s_ili9341_glyph %s_glyphs[%d] = {\n" % (base, len(index)))
+        for offset, width, advance, left, code in index:
+            f.write("\t{%d, %d, %d, %d},\t// %s\n" % (offset, width, advance, left, c_char(code)))
+        f.write("};\n\n")
+        if kerning:
+            f.write("static const s_ili9341_kern %s_kerning[%d] = {\n" % (base, len(kerning)))
+            for (a, b), adjust in kerning:
+                f.write("\t{%s, %s, %d},\n" % (c_char(a), c_char(b), adjust))
+            f.write("};\n\n")
+        f.write("const s_ili9341_font %s = {\n" % base)
+        f.write("\t.height = %d,\n\t.bpp = %d,\n\t.rle = %d,\n" % (height, bpp, 1 if args.rle else 0))
+        f.write("\t.first = %d,\n\t.count = %d,\n" % (args.first, len(index)))
+        f.write("\t.glyphs = %s_glyphs,\n\t.bitmaps = %s_bitmaps,\n" % (base, base))
+        f.write("\t.kerning = %s,\n\t.kerning_count = %d\n};\n" % ("%s_kerning" % base if kerning else "NULL", len(kerning)))
+
+
+if __name__ == "__main__":
+    main()
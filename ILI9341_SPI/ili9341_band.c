@@ -0,0 +1,39 @@
+/*
+ * ili9341_band.c
+ *
+ * Band renderer on the display list of the frame.
+ */
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_dlist.h"
+#include "ili9341_band.h"
+
+static uint32_t band_arena[ILI9341_BAND_ARENA / sizeof(uint32_t)];
+static s_ili9341_dlist band_list;
+
+void ILI9341_BandBegin(t_color background)
+{
+	ILI9341_DListInit(&band_list, band_arena, sizeof(band_arena), background);
+}
+
+HAL_StatusTypeDef ILI9341_BandFill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color)
+{
+	return ILI9341_DListFill(&band_list, x, y, width, height, color);
+}
+
+HAL_StatusTypeDef ILI9341_BandImage(uint16_t x, uint16_t y, const s_image* image)
+{
+	return ILI9341_DListImage(&band_list, x, y, image);
+}
+
+HAL_StatusTypeDef ILI9341_BandRender(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	return ILI9341_DListRender(&band_list, x, y, width, height);
+}
+
+HAL_StatusTypeDef ILI9341_BandRedraw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* arg)
+{
+	return ILI9341_BandRender(x, y, width, height);
+}
@@ -0,0 +1,38 @@
+/*
+ * ili9341_band.h
+ *
+ * Band renderer. The frame is a list of draw operations, recorded between ILI9341_BandBegin(), and
+ * the render, into the display list of the frame (ili9341_dlist.h). The render rasterizes the list
+ * into one horizontal band at a time (as many full lines, as an ILI9341_STREAM_BUFFER_SIZE buffer
+ * holds), in the order of the recording, so every pixel goes to the display once, with its final
+ * color. The overlapping primitives do not flicker, and the RAM is the two stage buffers: one band
+ * goes out by DMA, while the next one is rendered.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_BAND_H_
+#define ILI9341_SPI_ILI9341_BAND_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+
+/* Bytes of the display list of a frame (64 fills, or images). */
+#define ILI9341_BAND_ARENA	1024
+
+/* @brief ILI9341_BandBegin(background) Start a new frame, the pixels without operation are the background. */
+void ILI9341_BandBegin(t_color background);
+
+/* @brief ILI9341_BandFill(x, y, width, height, color) Record a filled rectangle. @retval HAL_ERROR if the list is full. */
+HAL_StatusTypeDef ILI9341_BandFill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color);
+
+/* @brief ILI9341_BandImage(x, y, image) Record an image (RGB565, or RGB666, converted at the render). The image must
+ * be valid until the render. @retval HAL_ERROR if the list is full. */
+HAL_StatusTypeDef ILI9341_BandImage(uint16_t x, uint16_t y, const s_image* image);
+
+/* @brief ILI9341_BandRender(x, y, width, height) Render the window of the frame to the display. */
+HAL_StatusTypeDef ILI9341_BandRender(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/* @brief ILI9341_BandRedraw(x, y, width, height, arg) ILI9341_BandRender() as the redraw of ILI9341_DirtyFlush(). */
+HAL_StatusTypeDef ILI9341_BandRedraw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* arg);
+
+#endif /* ILI9341_SPI_ILI9341_BAND_H_ */
@@ -0,0 +1,93 @@
+/*
+ * ili9341_console.c
+ *
+ * Text console on the hardware vertical scrolling.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_font.h"
+#include "ili9341_console.h"
+
+HAL_StatusTypeDef ILI9341_ConsoleInit(s_ili9341_console* console, uint16_t top, uint16_t height,
+		const s_ili9341_font* font, t_color color, t_color background)
+{
+	if ((top >= ILI9341_HEIGHT) || !font->height) return HAL_ERROR;
+	if (height > ILI9341_HEIGHT - top) height = ILI9341_HEIGHT - top;
+	memset(console, 0, sizeof(*console));
+	console->font = font;
+	memcpy(console->color, color, sizeof(t_color));
+	memcpy(console->background, background, sizeof(t_color));
+	console->top = top;
+	console->rows = height / font->height;
+	if (console->rows > ILI9341_CONSOLE_ROWS) console->rows = ILI9341_CONSOLE_ROWS;
+	if (!console->rows) return HAL_ERROR;
+	height = console->rows * font->height;
+	if (ILI9341_ScrollArea(top, height) != HAL_OK) return HAL_ERROR;
+	if (ILI9341_ScrollStart(top) != HAL_OK) return HAL_ERROR;
+	return ILI9341_fillrectangle(0, top, ILI9341_WIDTH, height, background);
+}
+
+/*
+ * @brief ILI9341_ConsolePuts(console, text) The ring holds a screenful of lines: a full ring drops its oldest
+ * line, that line would scroll out at the flush anyway.
+ */
+
+void ILI9341_ConsolePuts(s_ili9341_console* console, const char* text)
+{	const char* end; uint16_t count; char* line;
+	do
+	{
+		end = strchr(text, '\n');
+		count = end ? end - text : strlen(text);
+		if (!end && !count) break;
+		if (console->pending == console->rows)
+		{
+			console->first = (console->first + 1) % console->rows;
+			console->pending--;
+			console->skipped++;
+		}
+		line = console->text[(console->first + console->pending) % console->rows];
+		if (count > ILI9341_CONSOLE_COLUMNS) count = ILI9341_CONSOLE_COLUMNS;
+		memcpy(line, text, count);
+		line[count] = 0;
+		console->pending++;
+		console->lines++;
+		text = end ? end + 1 : text + count;
+	} while (end && *text);
+}
+
+/*
+ * @brief ILI9341_ConsoleFlush(console) Each line is one window of a full row, the scroll start is sent once
+ * at the end.
+ */
+
+HAL_StatusTypeDef ILI9341_ConsoleFlush(s_ili9341_console* console)
+{	uint16_t row, scrolled = 0; const char* line;
+	while (console->pending)
+	{
+		if (console->shown < console->rows)
+		{
+			row = (console->scroll + console->shown++) % console->rows;
+		} else
+		{
+			row = console->scroll;
+			console->scroll = (console->scroll + 1) % console->rows;
+			scrolled = 1;
+		}
+		line = console->text[console->first];
+		if (ILI9341_DrawTextLine(0, console->top + row * console->font->height, ILI9341_WIDTH, console->font, line,
+				strlen(line), console->color, console->background) != HAL_OK) return HAL_ERROR;
+		console->first = (console->first + 1) % console->rows;
+		console->pending--;
+	}
+	if (!scrolled) return HAL_OK;
+	return ILI9341_ScrollStart(console->top + console->scroll * console->font->height);
+}
+
+HAL_StatusTypeDef ILI9341_ConsoleClose(s_ili9341_console* console)
+{
+	if (ILI9341_ScrollArea(0, ILI9341_HEIGHT) != HAL_OK) return HAL_ERROR;
+	return ILI9341_ScrollStart(0);
+}
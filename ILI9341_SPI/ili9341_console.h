@@ -0,0 +1,59 @@
+/*
+ * ili9341_console.h
+ *
+ * Text console with the hardware vertical scrolling of the ILI9341. The console is a scroll area of
+ * full width text rows (VSCRDEF), the lines above, and below it stay fixed. The frame memory rows of the
+ * area are a ring: a new line is drawn over the oldest row, then the scroll start (VSCRSADD) moves by a
+ * row, so the new line is at the bottom of the screen, and the rest of the area is not redrawn.
+ *
+ * ILI9341_ConsolePuts() queues the lines only, ILI9341_ConsoleFlush() draws them. Of a burst of lines
+ * only the last screenful is drawn: the older ones would scroll out before the flush ends.
+ *
+ * The scroll works in the portrait orientation (the memory pages are the screen lines), other drawing
+ * must not touch the area while the console is open.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_CONSOLE_H_
+#define ILI9341_SPI_ILI9341_CONSOLE_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_font.h"
+
+/* Most text rows of the area (the full screen with an 8 pixel font). */
+#define ILI9341_CONSOLE_ROWS		40
+/* Characters of a line, the longer lines are cut. */
+#define ILI9341_CONSOLE_COLUMNS		48
+
+typedef struct {
+	const s_ili9341_font* font;
+	t_color color, background;
+	uint16_t top;					// First screen line of the scroll area.
+	uint16_t rows;					// Text rows of the area.
+	uint16_t scroll;				// Memory row at the top of the area.
+	uint16_t shown;					// Rows with text, the area fills up before it scrolls.
+	uint16_t first, pending;		// The queued lines in the ring of text.
+	uint32_t lines;					// Lines put.
+	uint32_t skipped;				// Lines scrolled out before they were drawn.
+	char text[ILI9341_CONSOLE_ROWS][ILI9341_CONSOLE_COLUMNS + 1];
+} s_ili9341_console;
+
+/*
+ * @brief ILI9341_ConsoleInit(console, top, height, font, color, background) Open the console on the screen lines
+ * top .. top + height - 1, the area is the whole rows of the font (at most ILI9341_CONSOLE_ROWS). Clears the area.
+ */
+HAL_StatusTypeDef ILI9341_ConsoleInit(s_ili9341_console* console, uint16_t top, uint16_t height,
+		const s_ili9341_font* font, t_color color, t_color background);
+
+/* @brief ILI9341_ConsolePuts(console, text) Queue the '\n' separated lines of the text. The end of the text ends a line too. */
+void ILI9341_ConsolePuts(s_ili9341_console* console, const char* text);
+
+/* @brief ILI9341_ConsoleFlush(console) Draw the queued lines, and scroll them in. */
+HAL_StatusTypeDef ILI9341_ConsoleFlush(s_ili9341_console* console);
+
+/* @brief ILI9341_ConsoleClose(console) The whole screen is the scroll area again without scroll. The rows stay in the
+ * frame memory order. */
+HAL_StatusTypeDef ILI9341_ConsoleClose(s_ili9341_console* console);
+
+#endif /* ILI9341_SPI_ILI9341_CONSOLE_H_ */
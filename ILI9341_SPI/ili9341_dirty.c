@@ -0,0 +1,151 @@
+/*
+ * ili9341_dirty.c
+ *
+ * Dirty rectangle tracking, and merging with the window cost model.
+ */
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_dirty.h"
+
+static s_ili9341_rect dirty[ILI9341_DIRTY_MAX];
+static uint8_t dirty_count;
+
+static uint32_t ILI9341_RectArea(const s_ili9341_rect* r)
+{
+	return (uint32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+static void ILI9341_RectUnion(const s_ili9341_rect* a, const s_ili9341_rect* b, s_ili9341_rect* u)
+{
+	u->x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+	u->y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+	u->x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+	u->y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
+}
+
+/*
+ * @brief ILI9341_MergeCost(a, b) The cost change of the merge in pixels: the union window, less the two
+ * windows. Not positive, if the merge is worth it.
+ */
+
+static int32_t ILI9341_MergeCost(const s_ili9341_rect* a, const s_ili9341_rect* b)
+{	s_ili9341_rect u;
+	ILI9341_RectUnion(a, b, &u);
+	return (int32_t)ILI9341_RectArea(&u) - (int32_t)(ILI9341_RectArea(a) + ILI9341_RectArea(b) + ILI9341_DIRTY_WINDOW_COST);
+}
+
+static void ILI9341_DirtyRemove(uint8_t i)
+{
+	dirty[i] = dirty[--dirty_count];
+}
+
+/*
+ * @brief ILI9341_DirtyAdd(x, y, width, height) The new rectangle swallows the ones, it is worth to merge with,
+ * and it is checked again after every merge (the grown window may reach further ones).
+ */
+
+void ILI9341_DirtyAdd(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{	s_ili9341_rect r, u; uint8_t i, j, best_i = 0, best_j = 0; int32_t cost, best;
+
+	if ((x >= ILI9341_WIDTH) || (y >= ILI9341_HEIGHT) || !width || !height) return;
+	r.x1 = x;
+	r.y1 = y;
+	r.x2 = ((uint32_t)x + width > ILI9341_WIDTH) ? ILI9341_WIDTH - 1 : x + width - 1;
+	r.y2 = ((uint32_t)y + height > ILI9341_HEIGHT) ? ILI9341_HEIGHT - 1 : y + height - 1;
+
+	i = 0;
+	while (i < dirty_count)
+	{
+		if (ILI9341_MergeCost(&r, &dirty[i]) <= 0)
+		{
+			ILI9341_RectUnion(&r, &dirty[i], &r);
+			ILI9341_DirtyRemove(i);
+			i = 0;
+		} else i++;
+	}
+	if (dirty_count == ILI9341_DIRTY_MAX)
+	{
+		/* Full: merge the pair (the new one included) with the least cost. */
+		best = INT32_MAX;
+		for (i = 0; i < dirty_count; i++)
+		{
+			if ((cost = ILI9341_MergeCost(&r, &dirty[i])) < best)
+			{
+				best = cost;
+				best_i = i;
+				best_j = ILI9341_DIRTY_MAX;
+			}
+			for (j = i + 1; j < dirty_count; j++)
+			{
+				if ((cost = ILI9341_MergeCost(&dirty[i], &dirty[j])) < best)
+				{
+					best = cost;
+					best_i = i;
+					best_j = j;
+				}
+			}
+		}
+		if (best_j == ILI9341_DIRTY_MAX)
+		{
+			ILI9341_RectUnion(&r, &dirty[best_i], &dirty[best_i]);
+			return;
+		}
+		ILI9341_RectUnion(&dirty[best_i], &dirty[best_j], &u);
+		dirty[best_i] = u;
+		ILI9341_DirtyRemove(best_j);
+	}
+	dirty[dirty_count++] = r;
+}
+
+void ILI9341_DirtyAll()
+{
+	dirty_count = 0;
+	ILI9341_DirtyAdd(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT);
+}
+
+uint32_t ILI9341_DirtyPixels()
+{	uint32_t pixels = 0; uint8_t i;
+	for (i = 0; i < dirty_count; i++)
+	{
+		pixels += ILI9341_RectArea(&dirty[i]);
+	}
+	return pixels;
+}
+
+uint8_t ILI9341_DirtyCount()
+{
+	return dirty_count;
+}
+
+/*
+ * @brief ILI9341_DirtyFlush(redraw, arg) The windows go top down, the marks are cleared first, so the redraw
+ * may mark new changes for the next frame.
+ */
+
+HAL_StatusTypeDef ILI9341_DirtyFlush(ili9341_redraw redraw, void* arg)
+{	s_ili9341_rect frame[ILI9341_DIRTY_MAX], r; uint8_t count = dirty_count, i, j; HAL_StatusTypeDef result = HAL_OK;
+
+	for (i = 0; i < count; i++)
+	{
+		frame[i] = dirty[i];
+	}
+	dirty_count = 0;
+	/* Top down order, as the display refreshes. */
+	for (i = 1; i < count; i++)
+	{
+		r = frame[i];
+		for (j = i; (j > 0) && (frame[j - 1].y1 > r.y1); j--)
+		{
+			frame[j] = frame[j - 1];
+		}
+		frame[j] = r;
+	}
+	for (i = 0; i < count; i++)
+	{
+		if ((redraw(frame[i].x1, frame[i].y1, frame[i].x2 - frame[i].x1 + 1, frame[i].y2 - frame[i].y1 + 1, arg) != HAL_OK)
+				&& (result == HAL_OK)) result = HAL_ERROR;
+	}
+	return result;
+}
@@ -0,0 +1,53 @@
+/*
+ * ili9341_dirty.h
+ *
+ * Dirty rectangle tracking of the display. The drawing code marks the changed areas, and the
+ * frame flush redraws only them. There is no frame buffer (the screen is 150 kB in RGB565),
+ * so the flush calls back the owner of the screen content for every window.
+ *
+ * The rectangles are merged, when one window costs less than two. The cost of a window is
+ * its area, and ILI9341_DIRTY_WINDOW_COST: the window set, the RAMWR, and the DMA start take
+ * as long as so many pixels on the wire. So the overlapping, the adjacent, and the close small
+ * rectangles become one window, the distant ones stay apart.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_DIRTY_H_
+#define ILI9341_SPI_ILI9341_DIRTY_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/* Rectangles of a frame. On overflow the cheapest pair is merged. */
+#define ILI9341_DIRTY_MAX	16
+
+/* The setup of a window in pixel time (CASET, PASET, RAMWR, and the DMA start, about 15 us at 18 MHz). */
+#define ILI9341_DIRTY_WINDOW_COST	16
+
+/* @brief Dirty rectangle, inclusive corners. */
+typedef struct {
+	uint16_t x1, y1;
+	uint16_t x2, y2;
+} s_ili9341_rect;
+
+/* @brief Redraw callback of the flush. Draw the window of the screen content. @retval HAL_OK, or the error. */
+typedef HAL_StatusTypeDef (*ili9341_redraw)(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* arg);
+
+/* @brief ILI9341_DirtyAdd(x, y, width, height) Mark the area changed. It is clipped to the screen. */
+void ILI9341_DirtyAdd(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/* @brief ILI9341_DirtyAll() Mark the whole screen changed. */
+void ILI9341_DirtyAll();
+
+/* @brief ILI9341_DirtyPixels() The pixels of the marked windows, the flush sends so many pixels. */
+uint32_t ILI9341_DirtyPixels();
+
+/* @brief ILI9341_DirtyCount() The number of the marked windows. */
+uint8_t ILI9341_DirtyCount();
+
+/*
+ * @brief ILI9341_DirtyFlush(redraw, arg) Call the redraw for every marked window, and clear the marks.
+ * @retval HAL_OK, or the first error of the redraws (the marks are cleared anyway).
+ */
+HAL_StatusTypeDef ILI9341_DirtyFlush(ili9341_redraw redraw, void* arg);
+
+#endif /* ILI9341_SPI_ILI9341_DIRTY_H_ */
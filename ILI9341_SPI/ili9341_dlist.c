@@ -0,0 +1,415 @@
+/*
+ * ili9341_dlist.c
+ *
+ * Display list recording, and the band replay on the pixel streaming stage of the display driver.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_dirty.h"
+#include "ili9341_dlist.h"
+
+typedef enum {
+	DLIST_FILL,
+	DLIST_LINE,
+	DLIST_TEXT,
+	DLIST_IMAGE,
+	DLIST_BLOCKS,
+	DLIST_CLIP,
+	DLIST_UNCLIP
+} e_dlist_op;
+
+/* DLIST_LINE flag: the line goes from the right top to the left bottom. */
+#define DLIST_LINE_LEFT		0x01
+
+/* @brief Header of the operations: the bounding box (inclusive corners), and the record length (ILI9341_DLIST_ALIGN bytes aligned). */
+typedef struct {
+	uint8_t type;			// e_dlist_op
+	uint8_t flags;			// DLIST_LINE_LEFT, or the bytes per pixel of DLIST_BLOCKS.
+	uint16_t length;
+	uint16_t x1, y1, x2, y2;
+} s_dlist_head;
+
+/* @brief DLIST_FILL, and DLIST_LINE. */
+typedef struct {
+	s_dlist_head head;
+	t_color color;
+} s_dlist_fill;
+
+typedef struct {
+	s_dlist_head head;
+	t_color color;
+	t_color background;
+	const s_ili9341_font* font;
+	uint16_t count;
+	char text[];
+} s_dlist_text;
+
+typedef struct {
+	s_dlist_head head;
+	const s_image* image;
+} s_dlist_image;
+
+typedef struct {
+	s_dlist_head head;
+	uint32_t block;
+	uint16_t width;
+} s_dlist_blocks;
+
+/* @brief Replay state: the window, and the next line. */
+typedef struct {
+	const s_ili9341_dlist* list;
+	uint16_t x1, x2;
+	uint16_t y;
+	uint16_t width;
+	uint8_t background[ILI9341_MAX_BYTES_PER_PIXEL];
+} s_dlist_render;
+
+/* The last block of the block blits. */
+static uint8_t dlist_block[ILI9341_DLIST_BLOCK_SIZE];
+static uint32_t dlist_block_num;
+static uint8_t dlist_block_valid;
+
+void ILI9341_DListInit(s_ili9341_dlist* list, void* arena, uint16_t size, t_color background)
+{	uint8_t skip = (-(uintptr_t)arena) & (ILI9341_DLIST_ALIGN - 1);
+	list->arena = (uint8_t*)arena + skip;
+	list->size = (size > skip) ? size - skip : 0;
+	list->length = 0;
+	list->depth = 0;
+	memcpy(list->background, background, sizeof(t_color));
+	list->read_block = NULL;
+}
+
+/*
+ * @brief ILI9341_DListAdd(list, type, size, x1, y1, x2, y2) Append an operation of size bytes (with the header).
+ * @retval The header, NULL if the arena is full.
+ */
+
+static s_dlist_head* ILI9341_DListAdd(s_ili9341_dlist* list, uint8_t type, uint32_t size, uint16_t x1, uint16_t y1,
+		uint16_t x2, uint16_t y2)
+{	s_dlist_head* head;
+	size = (size + ILI9341_DLIST_ALIGN - 1) & ~(uint32_t)(ILI9341_DLIST_ALIGN - 1);
+	if ((uint32_t)list->length + size > list->size) return NULL;
+	head = (s_dlist_head*)&list->arena[list->length];
+	list->length += size;
+	head->type = type;
+	head->flags = 0;
+	head->length = size;
+	head->x1 = x1;
+	head->y1 = y1;
+	head->x2 = x2;
+	head->y2 = y2;
+	return head;
+}
+
+/* @brief ILI9341_DListBox(list, type, size, x, y, width, height) Append an operation on a rectangle, clipped to the screen. */
+
+static HAL_StatusTypeDef ILI9341_DListBox(s_ili9341_dlist* list, uint8_t type, uint32_t size, uint16_t x, uint16_t y,
+		uint32_t width, uint32_t height, s_dlist_head** head)
+{
+	*head = NULL;
+	if ((x >= ILI9341_WIDTH) || (y >= ILI9341_HEIGHT) || !width || !height) return HAL_OK;
+	*head = ILI9341_DListAdd(list, type, size, x, y, (x + width > ILI9341_WIDTH) ? ILI9341_WIDTH - 1 : x + width - 1,
+			(y + height > ILI9341_HEIGHT) ? ILI9341_HEIGHT - 1 : y + height - 1);
+	return (*head) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef ILI9341_DListFill(s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color)
+{	s_dlist_head* head;
+	HAL_StatusTypeDef result = ILI9341_DListBox(list, DLIST_FILL, sizeof(s_dlist_fill), x, y, width, height, &head);
+	if (head) memcpy(((s_dlist_fill*)head)->color, color, sizeof(t_color));
+	return result;
+}
+
+HAL_StatusTypeDef ILI9341_DListLine(s_ili9341_dlist* list, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, t_color color)
+{	s_dlist_head* head; uint16_t t;
+	if ((x1 == x2) || (y1 == y2))
+	{
+		return ILI9341_DListFill(list, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, ((x1 < x2) ? x2 - x1 : x1 - x2) + 1,
+				((y1 < y2) ? y2 - y1 : y1 - y2) + 1, color);
+	}
+	/* The line goes downwards, the flag tells the direction of x. */
+	if (y1 > y2)
+	{
+		t = x1; x1 = x2; x2 = t;
+		t = y1; y1 = y2; y2 = t;
+	}
+	if ((head = ILI9341_DListAdd(list, DLIST_LINE, sizeof(s_dlist_fill), (x1 < x2) ? x1 : x2, y1, (x1 < x2) ? x2 : x1, y2)) == NULL)
+	{
+		return HAL_ERROR;
+	}
+	if (x1 > x2) head->flags = DLIST_LINE_LEFT;
+	memcpy(((s_dlist_fill*)head)->color, color, sizeof(t_color));
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ILI9341_DListText(s_ili9341_dlist* list, uint16_t x, uint16_t y, const s_ili9341_font* font, t_color color,
+		t_color background, const char* text)
+{	s_dlist_head* head; s_dlist_text* op; uint16_t count = strlen(text);
+	HAL_StatusTypeDef result = ILI9341_DListBox(list, DLIST_TEXT, sizeof(s_dlist_text) + count, x, y,
+			ILI9341_TextWidth(font, text, count), font->height, &head);
+	if (!head) return result;
+	op = (s_dlist_text*)head;
+	memcpy(op->color, color, sizeof(t_color));
+	memcpy(op->background, background, sizeof(t_color));
+	op->font = font;
+	op->count = count;
+	memcpy(op->text, text, count);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ILI9341_DListImage(s_ili9341_dlist* list, uint16_t x, uint16_t y, const s_image* image)
+{	s_dlist_head* head;
+	HAL_StatusTypeDef result = ILI9341_DListBox(list, DLIST_IMAGE, sizeof(s_dlist_image), x, y, image->width, image->height, &head);
+	if (head) ((s_dlist_image*)head)->image = image;
+	return result;
+}
+
+HAL_StatusTypeDef ILI9341_DListBlocks(s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t bpp,
+		uint32_t first_block)
+{	s_dlist_head* head;
+	HAL_StatusTypeDef result = ILI9341_DListBox(list, DLIST_BLOCKS, sizeof(s_dlist_blocks), x, y, width, height, &head);
+	if (!head) return result;
+	head->flags = bpp;
+	((s_dlist_blocks*)head)->block = first_block;
+	((s_dlist_blocks*)head)->width = width;
+	return HAL_OK;
+}
+
+/* The clip off the screen is an empty box (x1 > x2), all operations are culled in it. */
+
+HAL_StatusTypeDef ILI9341_DListClip(s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{	s_dlist_head* head;
+	if (list->depth == ILI9341_DLIST_CLIP_DEPTH) return HAL_ERROR;
+	if (ILI9341_DListBox(list, DLIST_CLIP, sizeof(s_dlist_head), x, y, width, height, &head) != HAL_OK) return HAL_ERROR;
+	if (!head && ((head = ILI9341_DListAdd(list, DLIST_CLIP, sizeof(s_dlist_head), 1, 1, 0, 0)) == NULL)) return HAL_ERROR;
+	list->depth++;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ILI9341_DListUnclip(s_ili9341_dlist* list)
+{
+	if (!list->depth || !ILI9341_DListAdd(list, DLIST_UNCLIP, sizeof(s_dlist_head), 0, 0, 0, 0)) return HAL_ERROR;
+	list->depth--;
+	return HAL_OK;
+}
+
+/* ------------------------------------------ Replay ------------------------------------------ */
+
+/* @brief Band of the replay: the buffer, its first line, and the stride. */
+typedef struct {
+	uint8_t* buffer;
+	uint16_t x1, y1;
+	uint32_t stride;
+	uint8_t bpp;
+} s_dlist_band;
+
+static inline uint8_t* ILI9341_DListAt(const s_dlist_band* band, uint16_t x, uint16_t y)
+{
+	return band->buffer + (y - band->y1) * band->stride + (x - band->x1) * band->bpp;
+}
+
+/* @brief ILI9341_DListDrawLine(band, op, box) Bresenham, the points in the box only. */
+
+static void ILI9341_DListDrawLine(const s_dlist_band* band, const s_dlist_fill* op, const s_ili9341_rect* box)
+{	const s_dlist_head* head = &op->head; uint8_t pixel[ILI9341_MAX_BYTES_PER_PIXEL];
+	int32_t x = (head->flags & DLIST_LINE_LEFT) ? head->x2 : head->x1, x_end = (head->flags & DLIST_LINE_LEFT) ? head->x1 : head->x2;
+	int32_t y = head->y1, dx = head->x2 - head->x1, dy = head->y2 - head->y1, sx = (head->flags & DLIST_LINE_LEFT) ? -1 : 1;
+	int32_t err = dx - dy, e2;
+
+	ILI9341_pixel(op->color, pixel);
+	while (y <= box->y2)
+	{
+		if ((y >= box->y1) && (x >= box->x1) && (x <= box->x2)) memcpy(ILI9341_DListAt(band, x, y), pixel, band->bpp);
+		if ((x == x_end) && (y == head->y2)) break;
+		e2 = 2 * err;
+		if (e2 > -dy)
+		{
+			err -= dy;
+			x += sx;
+		}
+		if (e2 < dx)
+		{
+			err += dx;
+			y++;
+		}
+	}
+}
+
+static void ILI9341_DListDrawText(const s_dlist_band* band, const s_dlist_text* op, const s_ili9341_rect* box)
+{	s_ili9341_raster raster;
+	raster.buffer = band->buffer;
+	raster.x = band->x1;
+	raster.y = band->y1;
+	raster.stride = band->stride;
+	raster.bpp = band->bpp;
+	raster.x1 = box->x1;
+	raster.y1 = box->y1;
+	raster.x2 = box->x2;
+	raster.y2 = box->y2;
+	ILI9341_TextRaster(&raster, op->head.x1, op->head.y1, op->font, op->text, op->count,
+			ILI9341_FontLevels(op->font, op->color, op->background));
+}
+
+static void ILI9341_DListDrawImage(const s_dlist_band* band, const s_dlist_image* op, const s_ili9341_rect* box)
+{	const s_image* image = op->image; const uint8_t* src; uint16_t y, pixels = box->x2 - box->x1 + 1;
+	for (y = box->y1; y <= box->y2; y++)
+	{
+		src = &image->pixel_data[((uint32_t)(y - op->head.y1) * image->width + (box->x1 - op->head.x1)) * image->bytes_per_pixel];
+		if (image->bytes_per_pixel == band->bpp) memcpy(ILI9341_DListAt(band, box->x1, y), src, pixels * band->bpp);
+		else ILI9341_convert(src, image->bytes_per_pixel, ILI9341_DListAt(band, box->x1, y), pixels);
+	}
+}
+
+/* @brief ILI9341_DListRead(list, block, offset, dst, size) Read the bytes at the offset of the blocks from the first block. */
+
+static uint8_t ILI9341_DListRead(const s_ili9341_dlist* list, uint32_t block, uint32_t offset, uint8_t* dst, uint16_t size)
+{	uint16_t n;
+	block += offset / ILI9341_DLIST_BLOCK_SIZE;
+	offset %= ILI9341_DLIST_BLOCK_SIZE;
+	while (size)
+	{
+		if (!dlist_block_valid || (dlist_block_num != block))
+		{
+			if (!list->read_block || !list->read_block(block, dlist_block)) return 0;
+			dlist_block_num = block;
+			dlist_block_valid = 1;
+		}
+		n = (size < ILI9341_DLIST_BLOCK_SIZE - offset) ? size : ILI9341_DLIST_BLOCK_SIZE - offset;
+		memcpy(dst, &dlist_block[offset], n);
+		dst += n;
+		size -= n;
+		offset = 0;
+		block++;
+	}
+	return 1;
+}
+
+/* The pixels of the other format are converted by 16. */
+#define DLIST_CONVERT_PIXELS	16
+
+static uint8_t ILI9341_DListDrawBlocks(const s_ili9341_dlist* list, const s_dlist_band* band, const s_dlist_blocks* op,
+		const s_ili9341_rect* box)
+{	uint8_t bpp = op->head.flags, convert[DLIST_CONVERT_PIXELS * ILI9341_MAX_BYTES_PER_PIXEL]; uint8_t* dst; uint32_t offset;
+	uint16_t y, pixels, n;
+	for (y = box->y1; y <= box->y2; y++)
+	{
+		offset = ((uint32_t)(y - op->head.y1) * op->width + (box->x1 - op->head.x1)) * bpp;
+		dst = ILI9341_DListAt(band, box->x1, y);
+		pixels = box->x2 - box->x1 + 1;
+		if (bpp == band->bpp)
+		{
+			if (!ILI9341_DListRead(list, op->block, offset, dst, pixels * bpp)) return 0;
+			continue;
+		}
+		for (; pixels; pixels -= n)
+		{
+			n = (pixels < DLIST_CONVERT_PIXELS) ? pixels : DLIST_CONVERT_PIXELS;
+			if (!ILI9341_DListRead(list, op->block, offset, convert, n * bpp)) return 0;
+			ILI9341_convert(convert, bpp, dst, n);
+			offset += n * bpp;
+			dst += n * band->bpp;
+		}
+	}
+	return 1;
+}
+
+/*
+ * @brief ILI9341_DListSource(buffer, pixels, arg) Pixel source of the stage: replay the list into the next lines of
+ * the window. The background first, then the operations in the recording order, in the intersection of their box,
+ * the band, and the clips.
+ */
+
+static uint8_t ILI9341_DListSource(void* buffer, uint16_t pixels, void* arg)
+{	s_dlist_render* r = arg; const s_ili9341_dlist* list = r->list; const s_dlist_head* head; s_dlist_band band;
+	s_ili9341_rect clip[ILI9341_DLIST_CLIP_DEPTH + 1], box; uint8_t depth = 0, pixel[ILI9341_MAX_BYTES_PER_PIXEL];
+	uint16_t lines = pixels / r->width, y, offset;
+
+	band.buffer = buffer;
+	band.x1 = r->x1;
+	band.y1 = r->y;
+	band.bpp = ILI9341_BytesPerPixel();
+	band.stride = (uint32_t)r->width * band.bpp;
+	for (y = 0; y < lines; y++)
+	{
+		ILI9341_span(band.buffer + y * band.stride, r->background, r->width);
+	}
+	clip[0].x1 = r->x1;
+	clip[0].x2 = r->x2;
+	clip[0].y1 = r->y;
+	clip[0].y2 = r->y + lines - 1;
+	r->y += lines;
+	for (offset = 0; offset < list->length; offset += head->length)
+	{
+		head = (const s_dlist_head*)&list->arena[offset];
+		if (head->type == DLIST_UNCLIP)
+		{
+			if (depth) depth--;
+			continue;
+		}
+		box.x1 = (head->x1 > clip[depth].x1) ? head->x1 : clip[depth].x1;
+		box.y1 = (head->y1 > clip[depth].y1) ? head->y1 : clip[depth].y1;
+		box.x2 = (head->x2 < clip[depth].x2) ? head->x2 : clip[depth].x2;
+		box.y2 = (head->y2 < clip[depth].y2) ? head->y2 : clip[depth].y2;
+		if (head->type == DLIST_CLIP)
+		{
+			clip[++depth] = box;
+			continue;
+		}
+		if ((box.x1 > box.x2) || (box.y1 > box.y2)) continue;
+		switch (head->type)
+		{
+		case DLIST_FILL:
+			ILI9341_pixel(((const s_dlist_fill*)head)->color, pixel);
+			for (y = box.y1; y <= box.y2; y++)
+			{
+				ILI9341_span(ILI9341_DListAt(&band, box.x1, y), pixel, box.x2 - box.x1 + 1);
+			}
+			break;
+		case DLIST_LINE:
+			ILI9341_DListDrawLine(&band, (const s_dlist_fill*)head, &box);
+			break;
+		case DLIST_TEXT:
+			ILI9341_DListDrawText(&band, (const s_dlist_text*)head, &box);
+			break;
+		case DLIST_IMAGE:
+			ILI9341_DListDrawImage(&band, (const s_dlist_image*)head, &box);
+			break;
+		case DLIST_BLOCKS:
+			if (!ILI9341_DListDrawBlocks(list, &band, (const s_dlist_blocks*)head, &box)) return 0;
+			break;
+		}
+	}
+	return 1;
+}
+
+/*
+ * @brief ILI9341_DListRender(list, x, y, width, height) The band is the most full lines of the window, that fit
+ * to a stage buffer.
+ */
+
+HAL_StatusTypeDef ILI9341_DListRender(const s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{	s_dlist_render render; uint16_t lines;
+
+	if ((x >= ILI9341_WIDTH) || (y >= ILI9341_HEIGHT) || !width || !height) return HAL_OK;
+	if ((uint32_t)x + width > ILI9341_WIDTH) width = ILI9341_WIDTH - x;
+	if ((uint32_t)y + height > ILI9341_HEIGHT) height = ILI9341_HEIGHT - y;
+	render.list = list;
+	render.x1 = x;
+	render.x2 = x + width - 1;
+	render.y = y;
+	render.width = width;
+	ILI9341_pixel(list->background, render.background);
+	/* The block device may have changed since the last replay. */
+	dlist_block_valid = 0;
+	lines = ILI9341_STREAM_BUFFER_SIZE / ((uint32_t)width * ILI9341_BytesPerPixel());
+	if (lines > height) lines = height;
+	return ILI9341_stream_chunks(x, y, width, height, lines * width, ILI9341_DListSource, &render);
+}
+
+HAL_StatusTypeDef ILI9341_DListRedraw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* arg)
+{
+	return ILI9341_DListRender(arg, x, y, width, height);
+}
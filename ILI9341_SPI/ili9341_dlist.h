@@ -0,0 +1,80 @@
+/*
+ * ili9341_dlist.h
+ *
+ * Display list. The draw operations of a screen are recorded once into an arena (a compact binary
+ * format: a 12 byte header with the bounding box, and the payload of the operation), and replayed
+ * later as many times as needed, against the whole panel, or against any window of it. So a static
+ * screen is redrawn for a damaged region without running the application code again.
+ *
+ * The replay rasterizes the list into horizontal bands of the window through the pixel streaming
+ * stage of the driver, in the recording order (every pixel goes to the display once). The operations,
+ * whose bounding box is out of the band, the window, or the clip, are skipped on their header.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_DLIST_H_
+#define ILI9341_SPI_ILI9341_DLIST_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_font.h"
+
+/* Nesting of the clip rectangles. */
+#define ILI9341_DLIST_CLIP_DEPTH	4
+
+/* Block size of the block device of the blits (the SD card). */
+#define ILI9341_DLIST_BLOCK_SIZE	512
+
+/* @brief Block read of the blits (ILI9341_DLIST_BLOCK_SIZE bytes). @retval 1, or 0 on error. */
+typedef uint8_t (*ili9341_block_reader)(uint32_t block, uint8_t* buffer);
+
+/* Alignment of the arena, and of the records: the records hold pointers (the fonts, and the images). */
+#define ILI9341_DLIST_ALIGN	sizeof(void*)
+
+/* @brief Display list on an arena. The members are of the recording, do not change them directly. */
+typedef struct {
+	uint8_t* arena;						// ILI9341_DLIST_ALIGN bytes aligned.
+	uint16_t size;						// Bytes of the arena.
+	uint16_t length;					// Bytes of the recorded operations.
+	uint8_t depth;						// The open clips of the recording.
+	t_color background;					// The pixels without operation.
+	ili9341_block_reader read_block;	// Of the block blits, NULL if there is none.
+} s_ili9341_dlist;
+
+/* @brief ILI9341_DListInit(list, arena, size, background) Start an empty list on the arena. */
+void ILI9341_DListInit(s_ili9341_dlist* list, void* arena, uint16_t size, t_color background);
+
+/* @brief ILI9341_DListFill(list, x, y, width, height, color) Record a filled rectangle. @retval HAL_ERROR if the arena is full. */
+HAL_StatusTypeDef ILI9341_DListFill(s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color);
+
+/* @brief ILI9341_DListLine(list, x1, y1, x2, y2, color) Record a line (the horizontal, and vertical lines are fills). */
+HAL_StatusTypeDef ILI9341_DListLine(s_ili9341_dlist* list, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, t_color color);
+
+/* @brief ILI9341_DListText(list, x, y, font, color, background, text) Record a text run (ili9341_font.h). The background
+ * pixels of the glyphs are not drawn, the anti-aliased edges are blended to the background. */
+HAL_StatusTypeDef ILI9341_DListText(s_ili9341_dlist* list, uint16_t x, uint16_t y, const s_ili9341_font* font, t_color color,
+		t_color background, const char* text);
+
+/* @brief ILI9341_DListImage(list, x, y, image) Record an image from the memory (the flash). It must be valid until the replay. */
+HAL_StatusTypeDef ILI9341_DListImage(s_ili9341_dlist* list, uint16_t x, uint16_t y, const s_image* image);
+
+/*
+ * @brief ILI9341_DListBlocks(list, x, y, width, height, bpp, first_block) Record an image from the block device
+ * (list->read_block): the pixels (RGB565, or RGB666) row by row from the first_block, and the next blocks.
+ */
+HAL_StatusTypeDef ILI9341_DListBlocks(s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t bpp,
+		uint32_t first_block);
+
+/* @brief ILI9341_DListClip(list, x, y, width, height) Push a clip rectangle, the operations draw in the intersection of the clips. */
+HAL_StatusTypeDef ILI9341_DListClip(s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/* @brief ILI9341_DListUnclip(list) Pop the last clip rectangle. @retval HAL_ERROR without clip. */
+HAL_StatusTypeDef ILI9341_DListUnclip(s_ili9341_dlist* list);
+
+/* @brief ILI9341_DListRender(list, x, y, width, height) Replay the list into the window of the display. */
+HAL_StatusTypeDef ILI9341_DListRender(const s_ili9341_dlist* list, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/* @brief ILI9341_DListRedraw(x, y, width, height, arg) ILI9341_DListRender() of the list (arg) as the redraw of ILI9341_DirtyFlush(). */
+HAL_StatusTypeDef ILI9341_DListRedraw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* arg);
+
+#endif /* ILI9341_SPI_ILI9341_DLIST_H_ */
@@ -0,0 +1,275 @@
+/*
+ * ili9341_font.c
+ *
+ * Font engine: the glyph decoders, and the text lines on the pixel streaming stage.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_font.h"
+
+const s_ili9341_glyph* ILI9341_Glyph(const s_ili9341_font* font, char c)
+{	uint8_t i = (uint8_t)c - font->first;
+	return (i < font->count) ? &font->glyphs[i] : NULL;
+}
+
+/* @brief ILI9341_Kerning(font, left, right) Binary search in the sorted pairs. */
+
+int8_t ILI9341_Kerning(const s_ili9341_font* font, char left, char right)
+{	uint16_t lo = 0, hi = font->kerning_count, mid, key = ((uint8_t)left << 8) | (uint8_t)right, pair;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		pair = (font->kerning[mid].left << 8) | font->kerning[mid].right;
+		if (pair == key) return font->kerning[mid].adjust;
+		if (pair < key) lo = mid + 1;
+		else hi = mid;
+	}
+	return 0;
+}
+
+uint16_t ILI9341_TextWidth(const s_ili9341_font* font, const char* text, uint16_t count)
+{	const s_ili9341_glyph* glyph; int32_t width = 0; uint16_t i;
+	for (i = 0; i < count; i++)
+	{
+		if ((glyph = ILI9341_Glyph(font, text[i])) == NULL) continue;
+		width += glyph->advance;
+		if (i + 1 < count) width += ILI9341_Kerning(font, text[i], text[i + 1]);
+	}
+	return (width > 0) ? width : 0;
+}
+
+/* @brief Blend table of a color, and background pair in a pixel format. */
+typedef struct {
+	t_color color, background;
+	uint8_t format;				// e_ili9341_format
+	uint8_t levels;				// Pixel values of the table.
+	uint8_t pixels[ILI9341_FONT_LEVELS * ILI9341_MAX_BYTES_PER_PIXEL];
+} s_blend_table;
+
+static s_blend_table blend_tables[ILI9341_BLEND_CACHE];
+static uint8_t blend_count, blend_next;
+
+/*
+ * @brief ILI9341_FontLevels(font, color, background) The cached table of the pair, or a new one in the place of the
+ * oldest table. The value i of n levels is background + (color - background) * i / (n - 1) per channel, rounded.
+ */
+
+const uint8_t* ILI9341_FontLevels(const s_ili9341_font* font, const t_color color, const t_color background)
+{	uint8_t n = 1 << font->bpp, i, ch, bpp = ILI9341_BytesPerPixel(); s_blend_table* table; t_color blend; int16_t d;
+
+	for (i = 0; i < blend_count; i++)
+	{
+		table = &blend_tables[i];
+		if ((table->levels == n) && (table->format == ili9341_format) && !memcmp(table->color, color, sizeof(t_color)) &&
+				!memcmp(table->background, background, sizeof(t_color))) return table->pixels;
+	}
+	table = &blend_tables[blend_next];
+	blend_next = (blend_next + 1) % ILI9341_BLEND_CACHE;
+	if (blend_count < ILI9341_BLEND_CACHE) blend_count++;
+	memcpy(table->color, color, sizeof(t_color));
+	memcpy(table->background, background, sizeof(t_color));
+	table->format = ili9341_format;
+	table->levels = n;
+	for (i = 0; i < n; i++)
+	{
+		for (ch = 0; ch < 3; ch++)
+		{
+			d = color[ch] - background[ch];
+			blend[ch] = background[ch] + (d * i + ((d < 0) ? -(n - 1) / 2 : (n - 1) / 2)) / (n - 1);
+		}
+		ILI9341_pixel(blend, &table->pixels[i * bpp]);
+	}
+	return table->pixels;
+}
+
+/* @brief Glyph decoder state: the next run of the bitmap. */
+typedef struct {
+	const uint8_t* data;
+	uint32_t pos;				// Pixel of the packed bitmap.
+	uint8_t fg;					// 1 bpp RLE: the foreground run of the byte is the next one.
+	uint8_t bpp, rle;
+} s_glyph_decoder;
+
+/*
+ * @brief ILI9341_GlyphRun(decoder, value, limit) The next run of the same value, max. limit pixels of the packed
+ * bitmaps. @retval The length of the run (0 at the 1 bpp RLE bytes without the run).
+ */
+
+static uint16_t ILI9341_GlyphRun(s_glyph_decoder* d, uint8_t* value, uint16_t limit)
+{	uint8_t mask = (1 << d->bpp) - 1, byte; uint16_t n;
+	if (d->rle)
+	{
+		byte = *d->data;
+		if (d->bpp == 1)
+		{
+			if (d->fg)
+			{
+				d->fg = 0;
+				d->data++;
+				*value = 1;
+				return byte & 0x0F;
+			}
+			d->fg = 1;
+			*value = 0;
+			return byte >> 4;
+		}
+		d->data++;
+		*value = byte & mask;
+		return (byte >> d->bpp) + 1;
+	}
+#define GLYPH_PIXEL(p)	((d->data[((p) * d->bpp) >> 3] >> (8 - d->bpp - (((p) * d->bpp) & 7))) & mask)
+	*value = GLYPH_PIXEL(d->pos);
+	for (n = 1; (n < limit) && (GLYPH_PIXEL(d->pos + n) == *value); n++);
+#undef GLYPH_PIXEL
+	d->pos += n;
+	return n;
+}
+
+/*
+ * @brief ILI9341_GlyphRaster(raster, glyph, x, y, font, levels) Render the runs of the glyph at x, y. The rows
+ * above the box are decoded only (the packed bitmaps skip them), the rows under it are not.
+ */
+
+static void ILI9341_GlyphRaster(const s_ili9341_raster* raster, const s_ili9341_glyph* glyph, int16_t x, uint16_t y,
+		const s_ili9341_font* font, const uint8_t* levels)
+{	s_glyph_decoder d; uint8_t width = glyph->width, value; uint16_t row, col = 0, n, len;
+	int32_t row_first, row_last, c1, c2; uint32_t p, end;
+
+	if (!width) return;
+	row_first = ((int32_t)raster->y1 > y) ? raster->y1 - y : 0;
+	row_last = ((int32_t)y + font->height - 1 > raster->y2) ? raster->y2 - y : font->height - 1;
+	if ((row_first > row_last) || (x + width - 1 < raster->x1) || (x > raster->x2)) return;
+	d.data = &font->bitmaps[glyph->offset];
+	d.pos = 0;
+	d.fg = 0;
+	d.bpp = font->bpp;
+	d.rle = font->rle;
+	p = 0;
+	row = 0;
+	if (!d.rle)
+	{
+		row = row_first;
+		p = d.pos = (uint32_t)row_first * width;
+	}
+	end = (uint32_t)(row_last + 1) * width;
+	while (p < end)
+	{
+		len = ILI9341_GlyphRun(&d, &value, end - p);
+		p += len;
+		if (!value)
+		{
+			col += len;
+			row += col / width;
+			col %= width;
+			continue;
+		}
+		/* The run may span rows. */
+		while (len)
+		{
+			n = (len < width - col) ? len : width - col;
+			if (row >= row_first)
+			{
+				c1 = ((int32_t)x + col > raster->x1) ? x + col : raster->x1;
+				c2 = ((int32_t)x + col + n - 1 < raster->x2) ? x + col + n - 1 : raster->x2;
+				if ((c1 <= c2) && (row <= row_last))
+				{
+					ILI9341_span(raster->buffer + (y + row - raster->y) * raster->stride + (c1 - raster->x) * raster->bpp,
+							&levels[value * raster->bpp], c2 - c1 + 1);
+				}
+			}
+			len -= n;
+			col += n;
+			if (col == width)
+			{
+				col = 0;
+				row++;
+			}
+		}
+	}
+}
+
+void ILI9341_TextRaster(const s_ili9341_raster* raster, int16_t x, uint16_t y, const s_ili9341_font* font, const char* text,
+		uint16_t count, const uint8_t* levels)
+{	const s_ili9341_glyph* glyph; uint16_t i;
+	for (i = 0; (i < count) && (x <= raster->x2); i++)
+	{
+		if ((glyph = ILI9341_Glyph(font, text[i])) == NULL) continue;
+		ILI9341_GlyphRaster(raster, glyph, x + glyph->left, y, font, levels);
+		x += glyph->advance;
+		if (i + 1 < count) x += ILI9341_Kerning(font, text[i], text[i + 1]);
+	}
+}
+
+/* @brief Text line of the streaming stage: the window, and the next line. */
+typedef struct {
+	const s_ili9341_font* font;
+	const char* text;
+	uint16_t count;
+	uint16_t x1, x2;
+	uint16_t y0, y;				// The top of the text, and the next line of the window.
+	uint16_t width;
+	const uint8_t* levels;		// The blend table.
+} s_text_line;
+
+/* @brief ILI9341_TextSource(buffer, pixels, arg) Pixel source of the stage: the next lines of the text window. */
+
+static uint8_t ILI9341_TextSource(void* buffer, uint16_t pixels, void* arg)
+{	s_text_line* line = arg; s_ili9341_raster raster; uint16_t lines = pixels / line->width, i;
+
+	raster.buffer = buffer;
+	raster.x = raster.x1 = line->x1;
+	raster.x2 = line->x2;
+	raster.y = raster.y1 = line->y;
+	raster.y2 = line->y + lines - 1;
+	raster.bpp = ILI9341_BytesPerPixel();
+	raster.stride = (uint32_t)line->width * raster.bpp;
+	for (i = 0; i < lines; i++)
+	{
+		ILI9341_span(raster.buffer + i * raster.stride, line->levels, line->width);
+	}
+	ILI9341_TextRaster(&raster, line->x1, line->y0, line->font, line->text, line->count, line->levels);
+	line->y += lines;
+	return 1;
+}
+
+/*
+ * @brief ILI9341_DrawTextLine(x, y, width, font, text, count, color, background) The band of the line is the most
+ * text rows, that fit to a stage buffer.
+ */
+
+HAL_StatusTypeDef ILI9341_DrawTextLine(uint16_t x, uint16_t y, uint16_t width, const s_ili9341_font* font, const char* text,
+		uint16_t count, t_color color, t_color background)
+{	static s_text_line line; uint16_t height, lines;
+
+	if (!width || (x >= ILI9341_WIDTH) || (y >= ILI9341_HEIGHT)) return HAL_OK;
+	if ((uint32_t)x + width > ILI9341_WIDTH) width = ILI9341_WIDTH - x;
+	height = ((uint32_t)y + font->height > ILI9341_HEIGHT) ? ILI9341_HEIGHT - y : font->height;
+	line.levels = ILI9341_FontLevels(font, color, background);
+	line.font = font;
+	line.text = text;
+	line.count = count;
+	line.x1 = x;
+	line.x2 = x + width - 1;
+	line.y0 = line.y = y;
+	line.width = width;
+	lines = ILI9341_STREAM_BUFFER_SIZE / ((uint32_t)width * ILI9341_BytesPerPixel());
+	if (lines > height) lines = height;
+	return ILI9341_stream_chunks(x, y, width, height, lines * width, ILI9341_TextSource, &line);
+}
+
+HAL_StatusTypeDef ILI9341_DrawText(uint16_t x, uint16_t y, const s_ili9341_font* font, const char* text, t_color color,
+		t_color background)
+{	const char* end; uint16_t count; HAL_StatusTypeDef result = HAL_OK;
+
+	for (; *text && (y < ILI9341_HEIGHT) && (result == HAL_OK); y += font->height)
+	{
+		end = strchr(text, '\n');
+		count = end ? end - text : strlen(text);
+		result = ILI9341_DrawTextLine(x, y, ILI9341_TextWidth(font, text, count), font, text, count, color, background);
+		text += count + (end ? 1 : 0);
+	}
+	return result;
+}
@@ -0,0 +1,106 @@
+/*
+ * ili9341_font.h
+ *
+ * Font engine. The fonts are const tables in the flash, made by fonts/mkfont.py from BDF fonts: the
+ * glyph index (first .. first + count - 1 characters), the glyph bitmaps, and the sorted kerning pairs.
+ * The glyph bitmaps are the pixels of the font height, and the glyph width, row by row, the pixel values
+ * have 1, 2, or 4 bits (the level of the foreground):
+ *  - packed: the values MSB first, without padding at the row ends.
+ *  - run length encoded, 1 bpp: a byte is a background run (upper nibble), then a foreground run (lower
+ *    nibble), 0 .. 15 pixels both. 2, 4 bpp: a byte is the run length - 1 (upper 8 - bpp bits), and the value.
+ *
+ * A line of text is one window of the display. The text is rendered into the stage buffers of the pixel
+ * streaming stage: the background, then the foreground runs of the glyphs as spans of the same pixel.
+ *
+ * The 2, and 4 bpp (anti-aliased) glyphs are drawn against a known background color: the pixel values
+ * index a blend table of the color, and the background pair in the display format. The tables of the
+ * last ILI9341_BLEND_CACHE pairs are kept, so the blend is computed once per pair, not per pixel.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_FONT_H_
+#define ILI9341_SPI_ILI9341_FONT_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+
+/* Levels of the pixel values (4 bpp). */
+#define ILI9341_FONT_LEVELS		16
+
+/* Blend tables of the last color, and background pairs. */
+#define ILI9341_BLEND_CACHE		4
+
+/* @brief Glyph of the index. The bitmap is width x height of the font, left pixels right of the pen. */
+typedef struct {
+	uint16_t offset;		// Of the bitmap in the bitmaps of the font.
+	uint8_t width;
+	uint8_t advance;		// Of the pen.
+	int8_t left;
+} s_ili9341_glyph;
+
+/* @brief Kerning pair, the adjust of the advance between the left, and the right character. */
+typedef struct {
+	uint8_t left, right;
+	int8_t adjust;
+} s_ili9341_kern;
+
+typedef struct {
+	uint8_t height;						// Pixels of the glyphs, and the lines.
+	uint8_t bpp;						// Bits per pixel: 1, 2, or 4.
+	uint8_t rle;						// The bitmaps are run length encoded.
+	uint8_t first, count;				// The characters of the index.
+	const s_ili9341_glyph* glyphs;
+	const uint8_t* bitmaps;
+	const s_ili9341_kern* kerning;		// Sorted by the left, then the right character.
+	uint16_t kerning_count;
+} s_ili9341_font;
+
+/*
+ * @brief Raster target: pixels in the display format (bpp bytes per pixel), the top left pixel is at the x, y
+ * of the screen. Only the pixels of the box (x1, y1 .. x2, y2 inclusive) are written.
+ */
+typedef struct {
+	uint8_t* buffer;
+	uint16_t x, y;
+	uint32_t stride;
+	uint8_t bpp;
+	uint16_t x1, y1, x2, y2;
+} s_ili9341_raster;
+
+/* @brief ILI9341_Glyph(font, c) The glyph of the character, NULL if it is not in the font. */
+const s_ili9341_glyph* ILI9341_Glyph(const s_ili9341_font* font, char c);
+
+/* @brief ILI9341_Kerning(font, left, right) The advance adjust of the character pair. */
+int8_t ILI9341_Kerning(const s_ili9341_font* font, char left, char right);
+
+/* @brief ILI9341_TextWidth(font, text, count) The advance of the first count characters (kerning included). */
+uint16_t ILI9341_TextWidth(const s_ili9341_font* font, const char* text, uint16_t count);
+
+/*
+ * @brief ILI9341_FontLevels(font, color, background) The blend table of the pixel values: (1 << font->bpp) pixels
+ * of ILI9341_BytesPerPixel() bytes, from the background to the color. It is valid until the next call.
+ */
+const uint8_t* ILI9341_FontLevels(const s_ili9341_font* font, const t_color color, const t_color background);
+
+/*
+ * @brief ILI9341_TextRaster(raster, x, y, font, text, count, levels) Render the count characters, the pen starts
+ * at the x, y. The pixel value 0 is not written, so the text is transparent.
+ */
+void ILI9341_TextRaster(const s_ili9341_raster* raster, int16_t x, uint16_t y, const s_ili9341_font* font, const char* text,
+		uint16_t count, const uint8_t* levels);
+
+/*
+ * @brief ILI9341_DrawTextLine(x, y, width, font, text, count, color, background) Draw the count characters in a window
+ * of the width, and the font height. The text is clipped to the window, the rest of the window is the background.
+ */
+HAL_StatusTypeDef ILI9341_DrawTextLine(uint16_t x, uint16_t y, uint16_t width, const s_ili9341_font* font, const char* text,
+		uint16_t count, t_color color, t_color background);
+
+/*
+ * @brief ILI9341_DrawText(x, y, font, text, color, background) Draw the text, the lines (separated by '\n') are
+ * windows of the text width, and the font height. The characters out of the font are skipped.
+ */
+HAL_StatusTypeDef ILI9341_DrawText(uint16_t x, uint16_t y, const s_ili9341_font* font, const char* text, t_color color,
+		t_color background);
+
+#endif /* ILI9341_SPI_ILI9341_FONT_H_ */
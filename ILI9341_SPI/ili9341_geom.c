@@ -0,0 +1,308 @@
+/*
+ * ili9341_geom.c
+ *
+ * Geometry primitives as spans of windows.
+ */
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+#include "ili9341_geom.h"
+
+/* @brief Run of the rows of the same span, going up, or down. The rows are merged into one window. */
+typedef struct {
+	int32_t x, y;
+	int32_t width, height;		// 0 height: no run.
+} s_geom_run;
+
+/* @brief ILI9341_GeomFill(x, y, width, height, color) The span clipped to the screen, one window, and one fill. */
+
+static HAL_StatusTypeDef ILI9341_GeomFill(int32_t x, int32_t y, int32_t width, int32_t height, t_color color)
+{
+	if (x < 0)
+	{
+		width += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		height += y;
+		y = 0;
+	}
+	if (x + width > ILI9341_WIDTH) width = ILI9341_WIDTH - x;
+	if (y + height > ILI9341_HEIGHT) height = ILI9341_HEIGHT - y;
+	if ((width <= 0) || (height <= 0)) return HAL_OK;
+	return ILI9341_fillrectangle(x, y, width, height, color);
+}
+
+/* @brief ILI9341_GeomSpan(x1, x2, y1, y2, color) The span of the inclusive ranges in any order. */
+
+static HAL_StatusTypeDef ILI9341_GeomSpan(int32_t x1, int32_t x2, int32_t y1, int32_t y2, t_color color)
+{	int32_t t;
+	if (x1 > x2)
+	{
+		t = x1;
+		x1 = x2;
+		x2 = t;
+	}
+	if (y1 > y2)
+	{
+		t = y1;
+		y1 = y2;
+		y2 = t;
+	}
+	return ILI9341_GeomFill(x1, y1, x2 - x1 + 1, y2 - y1 + 1, color);
+}
+
+static HAL_StatusTypeDef ILI9341_GeomFlush(s_geom_run* run, t_color color)
+{	int32_t height = run->height;
+	if (!height) return HAL_OK;
+	run->height = 0;
+	return ILI9341_GeomFill(run->x, run->y, run->width, height, color);
+}
+
+/* @brief ILI9341_GeomRow(run, x, y, width, color) Add the row to the run, or send the run, and start a new one. */
+
+static HAL_StatusTypeDef ILI9341_GeomRow(s_geom_run* run, int32_t x, int32_t y, int32_t width, t_color color)
+{	HAL_StatusTypeDef result;
+	if (run->height && (x == run->x) && (width == run->width))
+	{
+		if (y == run->y + run->height)
+		{
+			run->height++;
+			return HAL_OK;
+		}
+		if (y == run->y - 1)
+		{
+			run->y--;
+			run->height++;
+			return HAL_OK;
+		}
+	}
+	result = ILI9341_GeomFlush(run, color);
+	run->x = x;
+	run->y = y;
+	run->width = width;
+	run->height = 1;
+	return result;
+}
+
+HAL_StatusTypeDef ILI9341_DrawHLine(int16_t x, int16_t y, uint16_t length, t_color color)
+{
+	return ILI9341_GeomFill(x, y, length, 1, color);
+}
+
+HAL_StatusTypeDef ILI9341_DrawVLine(int16_t x, int16_t y, uint16_t length, t_color color)
+{
+	return ILI9341_GeomFill(x, y, 1, length, color);
+}
+
+/*
+ * @brief ILI9341_DrawLine(x1, y1, x2, y2, color) Bresenham line, the error steps of the minor axis end the runs
+ * along the major axis.
+ */
+
+HAL_StatusTypeDef ILI9341_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, t_color color)
+{	int32_t dx = (x2 > x1) ? x2 - x1 : x1 - x2, dy = (y2 > y1) ? y2 - y1 : y1 - y2, sx = (x2 > x1) ? 1 : -1, sy = (y2 > y1) ? 1 : -1;
+	int32_t x = x1, y = y1, start, err; HAL_StatusTypeDef result = HAL_OK;
+
+	if (dx >= dy)
+	{
+		err = dx / 2;
+		for (start = x; (x != x2) && (result == HAL_OK); x += sx)
+		{
+			if ((err -= dy) < 0)
+			{
+				result = ILI9341_GeomSpan(start, x, y, y, color);
+				y += sy;
+				err += dx;
+				start = x + sx;
+			}
+		}
+	} else
+	{
+		err = dy / 2;
+		for (start = y; (y != y2) && (result == HAL_OK); y += sy)
+		{
+			if ((err -= dx) < 0)
+			{
+				result = ILI9341_GeomSpan(x, x, start, y, color);
+				x += sx;
+				err += dy;
+				start = y + sy;
+			}
+		}
+	}
+	if (result != HAL_OK) return result;
+	return (dx >= dy) ? ILI9341_GeomSpan(start, x, y, y, color) : ILI9341_GeomSpan(x, x, start, y, color);
+}
+
+/*
+ * @brief ILI9341_GeomArcRun(x1, y1, x2, y2, r, xs, xe, y, color) A run of the octant (xs .. xe at the y) of the arcs
+ * around the corner centers x1, y1 (top left), x2, y2 (bottom right), mirrored to the 8 octants: rows at the top, and
+ * the bottom, columns at the left, and the right. The run from the 0 joins the left, and the right arcs (the straight
+ * edge).
+ */
+
+static HAL_StatusTypeDef ILI9341_GeomArcRun(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t xs, int32_t xe, int32_t y,
+		t_color color)
+{	HAL_StatusTypeDef result;
+	if (xs == 0)
+	{
+		result = ILI9341_GeomSpan(x1 - xe, x2 + xe, y1 - y, y1 - y, color);
+		if ((result == HAL_OK) && (y2 + y != y1 - y)) result = ILI9341_GeomSpan(x1 - xe, x2 + xe, y2 + y, y2 + y, color);
+		if (result == HAL_OK) result = ILI9341_GeomSpan(x1 - y, x1 - y, y1 - xe, y2 + xe, color);
+		if ((result == HAL_OK) && (x2 + y != x1 - y)) result = ILI9341_GeomSpan(x2 + y, x2 + y, y1 - xe, y2 + xe, color);
+		return result;
+	}
+	result = ILI9341_GeomSpan(x1 - xe, x1 - xs, y1 - y, y1 - y, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x2 + xs, x2 + xe, y1 - y, y1 - y, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x1 - xe, x1 - xs, y2 + y, y2 + y, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x2 + xs, x2 + xe, y2 + y, y2 + y, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x1 - y, x1 - y, y1 - xe, y1 - xs, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x1 - y, x1 - y, y2 + xs, y2 + xe, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x2 + y, x2 + y, y1 - xe, y1 - xs, color);
+	if (result == HAL_OK) result = ILI9341_GeomSpan(x2 + y, x2 + y, y2 + xs, y2 + xe, color);
+	return result;
+}
+
+/* @brief ILI9341_GeomArcs(x1, y1, x2, y2, r, color) The outline of the rounded box: the midpoint circle of the octant. */
+
+static HAL_StatusTypeDef ILI9341_GeomArcs(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t r, t_color color)
+{	int32_t x = 0, y = r, d = 1 - r, start = 0; HAL_StatusTypeDef result = HAL_OK;
+	while ((x <= y) && (result == HAL_OK))
+	{
+		if (d < 0)
+		{
+			d += 2 * x + 3;
+		} else
+		{
+			result = ILI9341_GeomArcRun(x1, y1, x2, y2, start, x, y, color);
+			d += 2 * (x - y) + 5;
+			y--;
+			start = x + 1;
+		}
+		x++;
+	}
+	if ((result == HAL_OK) && (start < x)) result = ILI9341_GeomArcRun(x1, y1, x2, y2, start, x - 1, y, color);
+	return result;
+}
+
+/*
+ * @brief ILI9341_GeomFillArcs(x1, y1, x2, y2, r, color) The filled rounded box. The rows of the steps in the x go
+ * out from the middle with the same span often (near to the left, and right ends): they are merged. The rows of the
+ * y steps are wider each time. The middle between the corner centers is one window.
+ */
+
+static HAL_StatusTypeDef ILI9341_GeomFillArcs(int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t r, t_color color)
+{	int32_t x = 0, y = r, d = 1 - r; s_geom_run top = {0}, bottom = {0}; HAL_StatusTypeDef result = HAL_OK;
+	if (y2 - y1 > 1) result = ILI9341_GeomSpan(x1 - r, x2 + r, y1 + 1, y2 - 1, color);
+	while ((x <= y) && (result == HAL_OK))
+	{
+		result = ILI9341_GeomRow(&top, x1 - y, y1 - x, x2 - x1 + 2 * y + 1, color);
+		if ((result == HAL_OK) && (y2 + x != y1 - x)) result = ILI9341_GeomRow(&bottom, x1 - y, y2 + x, x2 - x1 + 2 * y + 1, color);
+		if (d < 0)
+		{
+			d += 2 * x + 3;
+		} else
+		{
+			if ((result == HAL_OK) && (y != x)) result = ILI9341_GeomSpan(x1 - x, x2 + x, y1 - y, y1 - y, color);
+			if ((result == HAL_OK) && (y != x)) result = ILI9341_GeomSpan(x1 - x, x2 + x, y2 + y, y2 + y, color);
+			d += 2 * (x - y) + 5;
+			y--;
+		}
+		x++;
+	}
+	if (result == HAL_OK) result = ILI9341_GeomFlush(&top, color);
+	if (result == HAL_OK) result = ILI9341_GeomFlush(&bottom, color);
+	return result;
+}
+
+HAL_StatusTypeDef ILI9341_DrawCircle(int16_t x, int16_t y, uint16_t r, t_color color)
+{
+	return ILI9341_GeomArcs(x, y, x, y, r, color);
+}
+
+HAL_StatusTypeDef ILI9341_FillCircle(int16_t x, int16_t y, uint16_t r, t_color color)
+{
+	return ILI9341_GeomFillArcs(x, y, x, y, r, color);
+}
+
+HAL_StatusTypeDef ILI9341_DrawRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t r, t_color color)
+{
+	if (!width || !height) return HAL_OK;
+	if (2 * r > width) r = width / 2;
+	if (2 * r > height) r = height / 2;
+	return ILI9341_GeomArcs(x + r, y + r, x + width - 1 - r, y + height - 1 - r, r, color);
+}
+
+HAL_StatusTypeDef ILI9341_FillRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t r, t_color color)
+{
+	if (!width || !height) return HAL_OK;
+	if (2 * r > width) r = width / 2;
+	if (2 * r > height) r = height / 2;
+	return ILI9341_GeomFillArcs(x + r, y + r, x + width - 1 - r, y + height - 1 - r, r, color);
+}
+
+/* @brief ILI9341_GeomDiv(num, den) The rounded quotient. */
+
+static int32_t ILI9341_GeomDiv(int32_t num, int32_t den)
+{
+	if (den < 0)
+	{
+		num = -num;
+		den = -den;
+	}
+	return (num >= 0) ? (2 * num + den) / (2 * den) : -((-2 * num + den) / (2 * den));
+}
+
+/*
+ * @brief ILI9341_FillPolygon(points, count, color) A convex polygon has one span per row: from the leftmost to the
+ * rightmost edge crossing. The rows of the same span (vertical edges) are one window.
+ */
+
+HAL_StatusTypeDef ILI9341_FillPolygon(const s_ili9341_point* points, uint8_t count, t_color color)
+{	const s_ili9341_point *a, *b; int32_t top, bottom, y, left, right, xa, xb; uint8_t i; s_geom_run run = {0};
+	HAL_StatusTypeDef result = HAL_OK;
+
+	if (!count) return HAL_OK;
+	top = bottom = points[0].y;
+	for (i = 1; i < count; i++)
+	{
+		if (points[i].y < top) top = points[i].y;
+		if (points[i].y > bottom) bottom = points[i].y;
+	}
+	if (top < 0) top = 0;
+	if (bottom >= ILI9341_HEIGHT) bottom = ILI9341_HEIGHT - 1;
+	for (y = top; (y <= bottom) && (result == HAL_OK); y++)
+	{
+		left = INT32_MAX;
+		right = INT32_MIN;
+		for (i = 0; i < count; i++)
+		{
+			a = &points[i];
+			b = &points[(i + 1 < count) ? i + 1 : 0];
+			if (((y < a->y) && (y < b->y)) || ((y > a->y) && (y > b->y))) continue;
+			if (a->y == b->y)
+			{
+				xa = a->x;
+				xb = b->x;
+			} else
+			{
+				xa = xb = a->x + ILI9341_GeomDiv((y - a->y) * (b->x - a->x), b->y - a->y);
+			}
+			if (xa > xb)
+			{
+				left = (xb < left) ? xb : left;
+				right = (xa > right) ? xa : right;
+			} else
+			{
+				left = (xa < left) ? xa : left;
+				right = (xb > right) ? xb : right;
+			}
+		}
+		if (left <= right) result = ILI9341_GeomRow(&run, left, y, right - left + 1, color);
+	}
+	if (result == HAL_OK) result = ILI9341_GeomFlush(&run, color);
+	return result;
+}
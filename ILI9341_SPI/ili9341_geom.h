@@ -0,0 +1,53 @@
+/*
+ * ili9341_geom.h
+ *
+ * Geometry primitives as spans. A primitive is rasterized into horizontal, or vertical runs of the same
+ * pixel, and every run is one window, and one fill of the driver (ILI9341_fillrectangle(): a DMA fill
+ * of the pixel), never a window per pixel:
+ *  - the horizontal, and vertical lines are one run,
+ *  - the Bresenham lines are the runs of their steps: horizontal runs of the flat lines, vertical ones
+ *    of the steep lines,
+ *  - the circles, and the rounded rectangles are the octant runs of the midpoint circle, mirrored. The
+ *    straight edges of the rounded rectangles join the runs of the top, bottom, left, and right arcs,
+ *  - the filled shapes are scanline spans, the rows of the same span are merged into one window.
+ *
+ * The coordinates are signed, the primitives are clipped to the screen.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_GEOM_H_
+#define ILI9341_SPI_ILI9341_GEOM_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+
+typedef struct {
+	int16_t x, y;
+} s_ili9341_point;
+
+/* @brief ILI9341_DrawHLine(x, y, length, color) Horizontal line from the x, y to the right. */
+HAL_StatusTypeDef ILI9341_DrawHLine(int16_t x, int16_t y, uint16_t length, t_color color);
+
+/* @brief ILI9341_DrawVLine(x, y, length, color) Vertical line from the x, y down. */
+HAL_StatusTypeDef ILI9341_DrawVLine(int16_t x, int16_t y, uint16_t length, t_color color);
+
+/* @brief ILI9341_DrawLine(x1, y1, x2, y2, color) Line with both of the end points. */
+HAL_StatusTypeDef ILI9341_DrawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, t_color color);
+
+/* @brief ILI9341_DrawCircle(x, y, r, color) Circle of the radius around the center x, y. */
+HAL_StatusTypeDef ILI9341_DrawCircle(int16_t x, int16_t y, uint16_t r, t_color color);
+
+/* @brief ILI9341_FillCircle(x, y, r, color) Filled circle of the radius around the center x, y. */
+HAL_StatusTypeDef ILI9341_FillCircle(int16_t x, int16_t y, uint16_t r, t_color color);
+
+/* @brief ILI9341_DrawRoundRect(x, y, width, height, r, color) Rectangle with the corner arcs of the radius (cut to the
+ * half of the shorter side). */
+HAL_StatusTypeDef ILI9341_DrawRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t r, t_color color);
+
+/* @brief ILI9341_FillRoundRect(x, y, width, height, r, color) Filled rectangle with the corner arcs of the radius. */
+HAL_StatusTypeDef ILI9341_FillRoundRect(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t r, t_color color);
+
+/* @brief ILI9341_FillPolygon(points, count, color) Filled convex polygon of the vertices (in any order of the turn). */
+HAL_StatusTypeDef ILI9341_FillPolygon(const s_ili9341_point* points, uint8_t count, t_color color);
+
+#endif /* ILI9341_SPI_ILI9341_GEOM_H_ */
@@ -0,0 +1,328 @@
+/*
+ * ili9341_image.c
+ *
+ * Flash images, the run length decoder.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "spi.h"
+#include "spi_sched.h"
+#include "ili9341_spi.h"
+#include "ili9341_image.h"
+
+/* @brief Decoder state: the token under decode. */
+typedef struct {
+	const uint8_t* data;		// The pixels of the literal, or the next token.
+	const uint8_t* end;
+	uint16_t count;				// Pixels left of the token.
+	uint8_t literal;
+	uint8_t raw;				// ILI9341_IMAGE_RGB565: the data is literals only.
+	uint8_t pixel[ILI9341_MAX_BYTES_PER_PIXEL];	// Of the run, in the display format.
+} s_image_decoder;
+
+/* @brief ILI9341_ImageToken(decoder) Load the next token, if the last one is done. @retval 0 at the end of the data. */
+
+static uint8_t ILI9341_ImageToken(s_image_decoder* decoder)
+{	uint8_t token;
+	if (decoder->count) return 1;
+	if (decoder->data + 1 >= decoder->end) return 0;
+	if (decoder->raw)
+	{
+		decoder->literal = 1;
+		decoder->count = ((decoder->end - decoder->data) / 2 < 0xFFFF) ? (decoder->end - decoder->data) / 2 : 0xFFFF;
+		return 1;
+	}
+	token = *decoder->data++;
+	if (token < 0x80)
+	{
+		decoder->literal = 1;
+		decoder->count = token + 1;
+		return 1;
+	}
+	decoder->literal = 0;
+	if (token < 0xC0) decoder->count = (token & 0x3F) + 1;
+	else decoder->count = (((token & 0x3F) << 8) | *decoder->data++) + 1;
+	ILI9341_convert(decoder->data, 2, decoder->pixel, 1);
+	decoder->data += 2;
+	return 1;
+}
+
+/* @brief ILI9341_ImageFillable(decoder) The token is a run for a DMA fill. */
+
+static uint8_t ILI9341_ImageFillable(const s_image_decoder* decoder)
+{
+	if (decoder->literal || (decoder->count < ILI9341_IMAGE_FILL_MIN)) return 0;
+	/* The RGB666 pixel is 3 byte frames: only the gray ones are a fixed source. */
+	return (ili9341_format == ILI9341_RGB565) || ((decoder->pixel[0] == decoder->pixel[1]) && (decoder->pixel[1] == decoder->pixel[2]));
+}
+
+/*
+ * @brief ILI9341_ImageDecode(decoder, buffer, pixels, fills) Decode the next pixels into the buffer in the display format.
+ * If fills, it stops before a run of a DMA fill. @retval The decoded pixels.
+ */
+
+static uint16_t ILI9341_ImageDecode(s_image_decoder* decoder, uint8_t* buffer, uint16_t pixels, uint8_t fills)
+{	uint16_t done = 0, n; uint8_t bpp = ILI9341_BytesPerPixel();
+	while ((done < pixels) && ILI9341_ImageToken(decoder))
+	{
+		if (fills && ILI9341_ImageFillable(decoder)) break;
+		n = (decoder->count < pixels - done) ? decoder->count : pixels - done;
+		if (!decoder->literal) ILI9341_span(buffer + done * bpp, decoder->pixel, n);
+		else
+		{
+			if (bpp == 2) memcpy(buffer + done * 2, decoder->data, n * 2);
+			else ILI9341_convert(decoder->data, 2, buffer + done * 3, n);
+			decoder->data += n * 2;
+		}
+		decoder->count -= n;
+		done += n;
+	}
+	return done;
+}
+
+static uint8_t ILI9341_image_source(void* buffer, uint16_t pixels, void* arg)
+{
+	return ILI9341_ImageDecode(arg, buffer, pixels, 0) == pixels;
+}
+
+/* @brief Lookup table of the palette: the display format pixels of the colors. */
+static struct {
+	const t_color* palette;
+	uint16_t colors;
+	e_ili9341_format format;
+	union {
+		uint16_t p565[ILI9341_IMAGE_COLORS];
+		uint8_t p666[ILI9341_IMAGE_COLORS * 3];
+	} pixels;
+} image_lut;
+
+/* @brief Expansion state of an indexed image. */
+typedef struct {
+	const uint8_t* row;			// The indexes of the current row.
+	uint16_t x;					// Pixel of the row.
+	uint16_t width;
+	uint16_t stride;			// Bytes of a row.
+	uint8_t bpp;
+} s_image_indexes;
+
+/* @brief ILI9341_ImageLUT(image) The palette in the display format, it is converted, if it is not the last one. */
+
+static void ILI9341_ImageLUT(const s_ili9341_image* image)
+{	uint16_t i, colors = (image->colors < ILI9341_IMAGE_COLORS) ? image->colors : ILI9341_IMAGE_COLORS;
+	if ((image_lut.palette == image->palette) && (image_lut.colors == colors) && (image_lut.format == ili9341_format)) return;
+	for (i = 0; i < colors; i++)
+	{
+		ILI9341_pixel(image->palette[i], (ili9341_format == ILI9341_RGB565) ? (uint8_t*)&image_lut.pixels.p565[i] : &image_lut.pixels.p666[i * 3]);
+	}
+	/* The indexes out of the palette are the first color. */
+	for (; i < ILI9341_IMAGE_COLORS; i++)
+	{
+		if (ili9341_format == ILI9341_RGB565) image_lut.pixels.p565[i] = image_lut.pixels.p565[0];
+		else memcpy(&image_lut.pixels.p666[i * 3], image_lut.pixels.p666, 3);
+	}
+	image_lut.palette = image->palette;
+	image_lut.colors = colors;
+	image_lut.format = ili9341_format;
+}
+
+/*
+ * @brief ILI9341_ImageExpand565(src, x, bpp, dst, n) The n pixels of the row from the pixel x. The byte aligned 8, and
+ * 4 bpp indexes are read a byte at once, the others bit by bit.
+ */
+
+static void ILI9341_ImageExpand565(const uint8_t* src, uint16_t x, uint8_t bpp, uint16_t* dst, uint16_t n)
+{	const uint16_t* lut = image_lut.pixels.p565; uint8_t mask = (1 << bpp) - 1, shift; uint8_t b;
+	if (bpp == 8)
+	{
+		for (src += x; n; n--) *dst++ = lut[*src++];
+		return;
+	}
+	src += (x * bpp) >> 3;
+	if ((bpp == 4) && !(x & 1))
+	{
+		for (; n >= 2; n -= 2)
+		{
+			b = *src++;
+			*dst++ = lut[b >> 4];
+			*dst++ = lut[b & 0x0F];
+		}
+		if (n) *dst = lut[*src >> 4];
+		return;
+	}
+	shift = 8 - bpp - ((x * bpp) & 7);
+	for (; n; n--)
+	{
+		*dst++ = lut[(*src >> shift) & mask];
+		if (shift) shift -= bpp;
+		else
+		{
+			shift = 8 - bpp;
+			src++;
+		}
+	}
+}
+
+static void ILI9341_ImageExpand666(const uint8_t* src, uint16_t x, uint8_t bpp, uint8_t* dst, uint16_t n)
+{	const uint8_t* lut = image_lut.pixels.p666; const uint8_t* p; uint8_t mask = (1 << bpp) - 1, shift;
+	src += (x * bpp) >> 3;
+	shift = 8 - bpp - ((x * bpp) & 7);
+	for (; n; n--, dst += 3)
+	{
+		p = &lut[((*src >> shift) & mask) * 3];
+		dst[0] = p[0];
+		dst[1] = p[1];
+		dst[2] = p[2];
+		if (shift) shift -= bpp;
+		else
+		{
+			shift = 8 - bpp;
+			src++;
+		}
+	}
+}
+
+static uint8_t ILI9341_indexed_source(void* buffer, uint16_t pixels, void* arg)
+{	s_image_indexes* image = arg; uint8_t* dst = buffer; uint16_t n; uint8_t bpp = ILI9341_BytesPerPixel();
+	while (pixels)
+	{
+		n = (image->width - image->x < pixels) ? image->width - image->x : pixels;
+		if (bpp == 2) ILI9341_ImageExpand565(image->row, image->x, image->bpp, (uint16_t*)dst, n);
+		else ILI9341_ImageExpand666(image->row, image->x, image->bpp, dst, n);
+		dst += n * bpp;
+		pixels -= n;
+		if ((image->x += n) == image->width)
+		{
+			image->x = 0;
+			image->row += image->stride;
+		}
+	}
+	return 1;
+}
+
+#if defined (ILI9341_DMA)
+
+/*
+ * The DMA blit: the decoded buffers (the two stage buffers), and the fills are the transfers of the display
+ * queue in the order of the pixels. The memory write goes on over them.
+ */
+
+static struct {
+	s_spi_xfer xfer[SPI_PIPE_SLOTS];
+	volatile uint8_t busy[SPI_PIPE_SLOTS];
+	s_spi_xfer fill[ILI9341_IMAGE_FILLS];
+	volatile uint8_t fill_busy[ILI9341_IMAGE_FILLS];
+	/* The pixels of the fills. Half-word aligned: the 16 bit DMA ignores the lowest address bit. */
+	uint16_t frame[ILI9341_IMAGE_FILLS][(ILI9341_MAX_BYTES_PER_PIXEL + 1) / 2];
+	volatile uint8_t error;
+} image_dma;
+
+static void ILI9341_image_done(s_spi_xfer* xfer, e_dma_transfer_state state)
+{
+	if (state != TRANSFER_COMPLETE) image_dma.error = 1;
+	*(volatile uint8_t*)xfer->arg = 0;
+}
+
+/* @brief ILI9341_ImageWait(busy, tickstart) Wait for the transfer of the flag. */
+
+static HAL_StatusTypeDef ILI9341_ImageWait(volatile uint8_t* busy, uint32_t tickstart)
+{
+	while (*busy && !image_dma.error)
+	{
+		if ((HAL_GetTick() - tickstart) > ILI9341_STREAM_TIMEOUT)
+		{
+			SPI_QueueAbort(&display_spi1_bus);
+			return HAL_TIMEOUT;
+		}
+	}
+	return image_dma.error ? HAL_ERROR : HAL_OK;
+}
+
+static HAL_StatusTypeDef ILI9341_ImageDMA(s_image_decoder* decoder, uint32_t remain)
+{	uint8_t slot = 0, fill = 0, bpp = ILI9341_BytesPerPixel(); uint16_t pixels, chunk = ILI9341_STREAM_BUFFER_SIZE / bpp;
+	uint32_t tickstart = HAL_GetTick(); HAL_StatusTypeDef result = HAL_OK; uint8_t* buffer; int i;
+
+	image_dma.error = 0;
+	while (remain && (result == HAL_OK))
+	{
+		if (!ILI9341_ImageToken(decoder))
+		{
+			result = HAL_ERROR;
+			break;
+		}
+		if (ILI9341_ImageFillable(decoder))
+		{
+			pixels = (decoder->count < remain) ? decoder->count : remain;
+			if ((result = ILI9341_ImageWait(&image_dma.fill_busy[fill], tickstart)) != HAL_OK) break;
+			memcpy(image_dma.frame[fill], decoder->pixel, bpp);
+			image_dma.fill_busy[fill] = 1;
+			SPI_XferInit(&image_dma.fill[fill], image_dma.frame[fill], (bpp == 2) ? pixels : pixels * 3,
+					ILI9341_PixelXfer() | SPI_XFER_FIXED, ILI9341_image_done, (void*)&image_dma.fill_busy[fill]);
+			SPI_QueueSubmit(&display_spi1_bus, &image_dma.fill[fill]);
+			fill = (fill + 1) % ILI9341_IMAGE_FILLS;
+			decoder->count -= pixels;
+			remain -= pixels;
+			continue;
+		}
+		if ((result = ILI9341_ImageWait(&image_dma.busy[slot], tickstart)) != HAL_OK) break;
+		buffer = ILI9341_stream_buffer(slot);
+		pixels = ILI9341_ImageDecode(decoder, buffer, (remain < chunk) ? remain : chunk, 1);
+		if (!pixels)
+		{
+			result = HAL_ERROR;
+			break;
+		}
+		image_dma.busy[slot] = 1;
+		ILI9341_buf_to_disp_async(&image_dma.xfer[slot], buffer, pixels * bpp, ILI9341_image_done, (void*)&image_dma.busy[slot]);
+		slot = (slot + 1) % SPI_PIPE_SLOTS;
+		remain -= pixels;
+	}
+	/* The buffers, and the frames are in use until the end. */
+	for (i = 0; (i < SPI_PIPE_SLOTS) && (result == HAL_OK); i++)
+	{
+		result = ILI9341_ImageWait(&image_dma.busy[i], tickstart);
+	}
+	for (i = 0; (i < ILI9341_IMAGE_FILLS) && (result == HAL_OK); i++)
+	{
+		result = ILI9341_ImageWait(&image_dma.fill_busy[i], tickstart);
+	}
+	if (result != HAL_OK) ILI9341_wait();
+	return result;
+}
+
+#endif
+
+HAL_StatusTypeDef ILI9341_DrawImage(uint16_t x, uint16_t y, const s_ili9341_image* image)
+{	static s_image_decoder decoder; static s_image_indexes indexes;
+	uint32_t pixels = (uint32_t)image->width * image->height; uint16_t lines;
+
+	if (!pixels || ((uint32_t)x + image->width > ILI9341_WIDTH) || ((uint32_t)y + image->height > ILI9341_HEIGHT)) return HAL_ERROR;
+	lines = ILI9341_STREAM_BUFFER_SIZE / ((uint32_t)image->width * ILI9341_BytesPerPixel());
+	if (lines > image->height) lines = image->height;
+	if (image->format >= ILI9341_IMAGE_INDEXED1)
+	{
+		if (!image->palette || !image->colors) return HAL_ERROR;
+		indexes.bpp = 1 << (image->format - ILI9341_IMAGE_INDEXED1);
+		indexes.row = image->data;
+		indexes.x = 0;
+		indexes.width = image->width;
+		indexes.stride = ((uint32_t)image->width * indexes.bpp + 7) / 8;
+		if ((uint32_t)indexes.stride * image->height > image->size) return HAL_ERROR;
+		ILI9341_ImageLUT(image);
+		return ILI9341_stream_chunks(x, y, image->width, image->height, lines * image->width, ILI9341_indexed_source, &indexes);
+	}
+	decoder.data = image->data;
+	decoder.end = image->data + image->size;
+	decoder.count = 0;
+	decoder.raw = image->format == ILI9341_IMAGE_RGB565;
+#if defined (ILI9341_DMA)
+	if (image->format == ILI9341_IMAGE_RLE565)
+	{
+		ILI9341_setaddr(x, y, x + image->width - 1, y + image->height - 1);
+		ILI9341_writecmd(ILI9341_RAMWR);
+		return ILI9341_ImageDMA(&decoder, pixels);
+	}
+#endif
+	return ILI9341_stream_chunks(x, y, image->width, image->height, lines * image->width, ILI9341_image_source, &decoder);
+}
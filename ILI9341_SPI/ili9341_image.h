@@ -0,0 +1,64 @@
+/*
+ * ili9341_image.h
+ *
+ * Flash images of any size. The s_ili9341_image points to its pixel data (a const table made by
+ * images/mkimage.py), so an image takes its own bytes only, not the fixed s_image array.
+ *
+ * The run length encoded images (ILI9341_IMAGE_RLE565) are decoded straight into the stage buffers of
+ * the pixel streaming stage: the literal pixels are copied, or converted, the short runs are spans. With
+ * DMA a run of ILI9341_IMAGE_FILL_MIN pixels, or more is not decoded at all: it is a fixed source DMA fill
+ * of its pixel in the same memory write, queued after the decoded pixels before it. The decoder makes
+ * the next buffer meanwhile. The flat areas of the UI art cost a token in the flash, and no CPU time.
+ *
+ * The indexed images (ILI9341_IMAGE_INDEXED1 .. 8) are 1, 2, 4, or 8 bit palette indexes, and a palette
+ * of RGB colors. The palette is converted once into a lookup table of display format pixels (the table
+ * of the last palette, and format is kept), then the expansion loop is a table read per pixel, 2 pixels
+ * per byte at 4 bpp. It fills the next stage buffer, while the DMA sends the previous one.
+ */
+
+#ifndef ILI9341_SPI_ILI9341_IMAGE_H_
+#define ILI9341_SPI_ILI9341_IMAGE_H_
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "ili9341_spi.h"
+
+/* Pixels of the shortest run, which is sent as a DMA fill. */
+#define ILI9341_IMAGE_FILL_MIN	128
+
+/* DMA fills in the queue at once. */
+#define ILI9341_IMAGE_FILLS		4
+
+/* Most colors of a palette (8 bpp). */
+#define ILI9341_IMAGE_COLORS	256
+
+/*
+ * Pixel formats of the images:
+ *  - ILI9341_IMAGE_RGB565: little endian RGB565 pixels, row by row.
+ *  - ILI9341_IMAGE_RLE565: tokens in the raster order, the runs go on over the row ends.
+ *    0x00 .. 0x7F: literal, 1 .. 128 RGB565 pixels follow. 0x80 .. 0xBF: run of 1 .. 64 times the next
+ *    pixel. 0xC0 .. 0xFF, n: run of ((token & 0x3F) << 8 | n) + 1 times the next pixel.
+ *  - ILI9341_IMAGE_INDEXEDn: n bit palette indexes, MSB first, the rows are padded to whole bytes.
+ */
+typedef enum {
+	ILI9341_IMAGE_RGB565 = 0,
+	ILI9341_IMAGE_RLE565,
+	ILI9341_IMAGE_INDEXED1,
+	ILI9341_IMAGE_INDEXED2,
+	ILI9341_IMAGE_INDEXED4,
+	ILI9341_IMAGE_INDEXED8
+} e_ili9341_image_format;
+
+typedef struct {
+	uint16_t width, height;
+	uint8_t format;				// e_ili9341_image_format
+	uint32_t size;				// Bytes of the data.
+	const uint8_t* data;
+	const t_color* palette;		// Of the indexed images, NULL for the others.
+	uint16_t colors;			// Entries of the palette.
+} s_ili9341_image;
+
+/* @brief ILI9341_DrawImage(x, y, image) Blit the image to the x, y. The image must be on the screen. */
+HAL_StatusTypeDef ILI9341_DrawImage(uint16_t x, uint16_t y, const s_ili9341_image* image);
+
+#endif /* ILI9341_SPI_ILI9341_IMAGE_H_ */
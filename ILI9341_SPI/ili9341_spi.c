@@ -6,8 +6,10 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "stm32f1xx_hal.h"
 #include "spi.h"
+#include "spi_sched.h"
 #include "ili9341_spi.h"
 #include "interrupts.h"
 
@@ -25,8 +27,6 @@ const uint8_t datas_pw2[] = {0x10};
 const uint8_t datas_vcom1[] = {0x3E, 0x28};
 const uint8_t datas_vcom2[] = {0x86};
 const uint8_t datas_mac[] = {0x48};
-const uint8_t datas_pform_18_bits[] = {0x66};
-const uint8_t datas_pform_16_bits[] = {0x55};
 const uint8_t datas_frc[] = {0x00, 0x18};
 const uint8_t datas_dfc[] = {0x08, 0x82, 0x27};
 const uint8_t datas_gen[] = {0x00};
@@ -46,24 +46,30 @@ static DMA_HandleTypeDef hdma_spi1_rx;
 
 
 /*
- * @brief ILI9341 DISPLAY IC SPI handle. SPI1 channel.
+ * @brief ILI9341 DISPLAY IC SPI bus. SPI1 channel.
  */
 
-static SPI_HandleTypeDef 	display_spi1_handle =
-{.Instance = DISPLAY_SPI_CHANNEL,
-.Init.BaudRatePrescaler  = SPI_BAUDRATEPRESCALER_4,
-.Init.Direction          = SPI_DIRECTION_2LINES,
-.Init.CLKPhase           = SPI_PHASE_1EDGE,
-.Init.CLKPolarity        = SPI_POLARITY_LOW,
-.Init.CRCCalculation     = SPI_CRCCALCULATION_DISABLE,
-.Init.CRCPolynomial      = 7,
-.Init.DataSize           = SPI_DATASIZE_8BIT,
-.Init.FirstBit           = SPI_FIRSTBIT_MSB,
-.Init.NSS                = SPI_NSS_SOFT,
-.Init.TIMode             = SPI_TIMODE_DISABLE,
-.Init.Mode               = SPI_MODE_MASTER
+s_spi_bus 	display_spi1_bus =
+{.handle.Instance = DISPLAY_SPI_CHANNEL,
+.handle.Init.BaudRatePrescaler  = SPI_BAUDRATEPRESCALER_4,
+.handle.Init.Direction          = SPI_DIRECTION_2LINES,
+.handle.Init.CLKPhase           = SPI_PHASE_1EDGE,
+.handle.Init.CLKPolarity        = SPI_POLARITY_LOW,
+.handle.Init.CRCCalculation     = SPI_CRCCALCULATION_DISABLE,
+.handle.Init.CRCPolynomial      = 7,
+.handle.Init.DataSize           = SPI_DATASIZE_8BIT,
+.handle.Init.FirstBit           = SPI_FIRSTBIT_MSB,
+.handle.Init.NSS                = SPI_NSS_SOFT,
+.handle.Init.TIMode             = SPI_TIMODE_DISABLE,
+.handle.Init.Mode               = SPI_MODE_MASTER,
+.cs_port = DISPLAY_CONTROL_PORT,
+.cs_pin = DISPLAY_CS_PIN,
+.dc_port = DISPLAY_CONTROL_PORT,
+.dc_pin = DISPLAY_DC_PIN
 };
 
+e_ili9341_format ili9341_format = ILI9341_DEFAULT_FORMAT;
+
 
 /* @brief DISPLAY_SPI1_Init(): initialize SPI 1 signals for ILI9341 DISPLAY SPI communication,
  * and set SPI channel, and initialize CS line for standard I/O. */
@@ -103,7 +109,7 @@ void DISPLAY_SPI1_Init()
 	  gpioinitstruct.Speed      = GPIO_SPEED_FREQ_HIGH;
 	  HAL_GPIO_Init(SPI1_SIGNAL_PORT, &gpioinitstruct);
 
-	  SPI_Init(&display_spi1_handle);
+	  SPI_Init(&display_spi1_bus);
 
 #if defined (ILI9341_DMA)
 
@@ -125,7 +131,7 @@ void DISPLAY_SPI1_Init()
 
 	  HAL_DMA_Init(&hdma_spi1_tx);
 
-	  __HAL_LINKDMA(&display_spi1_handle, hdmatx, hdma_spi1_tx);
+	  __HAL_LINKDMA(&display_spi1_bus.handle, hdmatx, hdma_spi1_tx);
 
 	  HAL_NVIC_SetPriority(DISPLAY_DMA_TX_IRQn, 1, 1);
 	  HAL_NVIC_EnableIRQ(DISPLAY_DMA_TX_IRQn);
@@ -148,7 +154,7 @@ void DISPLAY_SPI1_Init()
 
 	  HAL_DMA_Init(&hdma_spi1_rx);
 
-	  __HAL_LINKDMA(&display_spi1_handle, hdmarx, hdma_spi1_rx);
+	  __HAL_LINKDMA(&display_spi1_bus.handle, hdmarx, hdma_spi1_rx);
 
 	  HAL_NVIC_SetPriority(DISPLAY_DMA_RX_IRQn, 1, 1);
 	  HAL_NVIC_EnableIRQ(DISPLAY_DMA_RX_IRQn);
@@ -163,7 +169,7 @@ HAL_StatusTypeDef ILI9341_writecmd(uint8_t cmd)
 {	HAL_StatusTypeDef result;
 	SELECT_DISPLAY();
 	SELECT_COMMAND();
-	result = HAL_SPI_Transmit(&display_spi1_handle, &cmd, sizeof(uint8_t), DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	result = SPI_WriteByte(&display_spi1_bus, cmd, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 	DESELECT_DISPLAY();
 	return result;
 }
@@ -172,7 +178,7 @@ HAL_StatusTypeDef ILI9341_writedatas(uint8_t* data, int size)
 {	HAL_StatusTypeDef result;
 	SELECT_DISPLAY();
 	SELECT_DATA();
-	result = HAL_SPI_Transmit(&display_spi1_handle, data, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	result = SPI_WriteBuf(&display_spi1_bus, data, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 	DESELECT_DISPLAY();
 	return result;
 }
@@ -181,7 +187,7 @@ HAL_StatusTypeDef ILI9341_readdatas(uint8_t* data, int size)
 {	HAL_StatusTypeDef result;
 	SELECT_DISPLAY();
 	SELECT_DATA();
-	result = HAL_SPI_Receive(&display_spi1_handle, data, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	result = SPI_ReadBuf(&display_spi1_bus, data, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 	DESELECT_DISPLAY();
 	return result;
 }
@@ -190,7 +196,7 @@ HAL_StatusTypeDef ILI9341_writedata(uint8_t data)
 {	HAL_StatusTypeDef result;
 	SELECT_DISPLAY();
 	SELECT_DATA();
-	result = HAL_SPI_Transmit(&display_spi1_handle, &data, sizeof(uint8_t), DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	result = SPI_WriteByte(&display_spi1_bus, data, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 	DESELECT_DISPLAY();
 	return result;
 }
@@ -199,11 +205,79 @@ HAL_StatusTypeDef ILI9341_readdata(uint8_t* data)
 {	HAL_StatusTypeDef result;
 	SELECT_DISPLAY();
 	SELECT_DATA();
-	result = HAL_SPI_Receive(&display_spi1_handle, data, sizeof(uint8_t), DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	result = SPI_ReadByte(&display_spi1_bus, data, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 	DESELECT_DISPLAY();
 	return result;
 }
 
+/*
+ * Window cache. The column, and the page range of the last window set. CASET, and PASET are sent only,
+ * when their range changes. The start > end range never matches, it forces the next set.
+ */
+
+static struct {
+	uint16_t x1, x2;
+	uint16_t y1, y2;
+} ili9341_window = {0xFFFF, 0, 0xFFFF, 0};
+
+/* @brief ILI9341_window_invalidate() The window of the display is unknown (reset, or a foreign window set). */
+
+void ILI9341_window_invalidate()
+{
+	ili9341_window.x1 = ili9341_window.y1 = 0xFFFF;
+	ili9341_window.x2 = ili9341_window.y2 = 0;
+}
+
+/*
+ * @brief ILI9341_addrset(cmd, start, end) CASET, or PASET command, and its 4 parameter bytes in one burst.
+ * The CS must be active.
+ */
+
+static void ILI9341_addrset(uint8_t cmd, uint16_t start, uint16_t end)
+{	uint8_t param[4];
+	param[0] = start >> 8;
+	param[1] = start;
+	param[2] = end >> 8;
+	param[3] = end;
+	SELECT_COMMAND();
+	SPI_Exchange(&display_spi1_bus, cmd);
+	SELECT_DATA();
+	SPI_ExchangeBuf(&display_spi1_bus, param, NULL, sizeof(param));
+}
+
+/*
+ * @brief ILI9341_setaddr(x1, y1, x2, y2) Set the window of the next memory write, or read. The changed
+ * ranges go in one CS period, nothing is sent, if the window is the same. The RAMWR, or RAMRD command
+ * is the job of the caller.
+ */
+
+void ILI9341_setaddr(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{	uint8_t columns = (x1 != ili9341_window.x1) || (x2 != ili9341_window.x2);
+	uint8_t pages = (y1 != ili9341_window.y1) || (y2 != ili9341_window.y2);
+	if (!columns && !pages) return;
+	SELECT_DISPLAY();
+	if (columns) ILI9341_addrset(ILI9341_COLUMN_ADDR, x1, x2);
+	if (pages) ILI9341_addrset(ILI9341_PAGE_ADDR, y1, y2);
+	DESELECT_DISPLAY();
+	ili9341_window.x1 = x1;
+	ili9341_window.x2 = x2;
+	ili9341_window.y1 = y1;
+	ili9341_window.y2 = y2;
+}
+
+/*
+ * @brief ILI9341_memwrite() Start the memory write: select the display, send RAMWR, and switch to data.
+ * The pixels follow in the same CS period, the caller deselects the display at the end.
+ */
+
+static void ILI9341_memwrite()
+{
+	SELECT_DISPLAY();
+	SELECT_COMMAND();
+	SPI_Exchange(&display_spi1_bus, ILI9341_RAMWR);
+	SELECT_DATA();
+}
+
 void ILI9341_Init()
 {
 	/* Force reset */
@@ -216,6 +290,7 @@ void ILI9341_Init()
 	/* Software reset */
 	ILI9341_writecmd(ILI9341_RESET);
 	HAL_Delay(200);
+	ILI9341_window_invalidate();
 
 	ILI9341_writecmd(ILI9341_POWERA);
 	ILI9341_writedatas((uint8_t*)&datas_pwa, sizeof(datas_pwa));
@@ -253,11 +328,7 @@ void ILI9341_Init()
 	  SendData(0x40);
 	#endif
 	  ILI9341_writecmd(ILI9341_PIXEL_FORMAT);
-	#ifdef PIXEL_FORMAT_18_BIT
-	  ILI9341_writedatas((uint8_t*)&datas_pform_18_bits, sizeof(datas_pform_18_bits));
-	#else
-	  ILI9341_writedatas((uint8_t*)&datas_pform_16_bits, sizeof(datas_pform_16_bits));
-	#endif
+	  ILI9341_writedata(ili9341_format);
 	  ILI9341_writecmd(ILI9341_FRC);
 	  ILI9341_writedatas((uint8_t*)&datas_frc, sizeof(datas_frc));
 	  ILI9341_writecmd(ILI9341_DFC);
@@ -279,24 +350,165 @@ void ILI9341_Init()
 	  HAL_Delay(200);
 
 	  ILI9341_writecmd(ILI9341_DISPLAY_ON);
+	  ILI9341_NegotiateClock();
 	  ILI9341_writecmd(ILI9341_RAMWR);
 }
 
-void ILI9341_setaddr(uint8_t x1,uint8_t y1,uint16_t x2,uint16_t y2)
+/*
+ * Clock negotiation. The check pattern is written to the first pixels, and read back with RAMRD.
+ * The pattern is inverted on every write, so the old pattern in the GRAM does not pass the check.
+ */
+
+static const uint8_t check_pattern[ILI9341_CHECK_PIXELS * 2] =
+	{0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xA5, 0x5A, 0x5A, 0xA5, 0x00, 0x00, 0x84, 0x10};
+static uint8_t check_invert;
+
+/*
+ * @brief ILI9341_check_write() Write the next check pattern (RGB565, or RGB666 format).
+ */
+
+static void ILI9341_check_write()
+{	uint8_t pixels[ILI9341_CHECK_PIXELS * ILI9341_MAX_BYTES_PER_PIXEL]; uint16_t rgb; int i;
+	check_invert ^= 0xFF;
+	for (i = 0; i < ILI9341_CHECK_PIXELS; i++)
+	{
+		rgb = ((check_pattern[i * 2] << 8) | check_pattern[i * 2 + 1]) ^ (check_invert << 8 | check_invert);
+		if (ili9341_format == ILI9341_RGB666)
+		{
+			pixels[i * 3] = (rgb >> 8) & 0xF8;
+			pixels[i * 3 + 1] = (rgb >> 3) & 0xFC;
+			pixels[i * 3 + 2] = rgb << 3;
+		} else
+		{
+			pixels[i * 2] = rgb >> 8;
+			pixels[i * 2 + 1] = rgb;
+		}
+	}
+	ILI9341_setaddr(0, 0, ILI9341_CHECK_PIXELS - 1, 0);
+	ILI9341_memwrite();
+	SPI_ExchangeBuf(&display_spi1_bus, pixels, NULL, ILI9341_CHECK_PIXELS * ILI9341_BytesPerPixel());
+	DESELECT_DISPLAY();
+}
+
+/*
+ * @brief ILI9341_check_read() Read back the check pattern. RAMRD gives 3 bytes per pixel (6 bits per color,
+ * left aligned) in both of the pixel formats, the upper 5-6-5 bits must match.
+ */
+
+static HAL_StatusTypeDef ILI9341_check_read(s_spi_bus* bus, void* arg)
+{	uint8_t pixels[ILI9341_CHECK_PIXELS * 3]; uint16_t rgb; int i;
+	ILI9341_setaddr(0, 0, ILI9341_CHECK_PIXELS - 1, 0);
+	SELECT_DISPLAY();
+	SELECT_COMMAND();
+	SPI_Exchange(bus, ILI9341_RAMRD);
+	SELECT_DATA();
+	/* Dummy read cycle before the pixels. */
+	SPI_Exchange(bus, DP_DUMMY_BYTE);
+	SPI_ExchangeBuf(bus, NULL, pixels, sizeof(pixels));
+	/* The CS high ends the read. */
+	DESELECT_DISPLAY();
+	for (i = 0; i < ILI9341_CHECK_PIXELS; i++)
+	{
+		rgb = ((check_pattern[i * 2] << 8) | check_pattern[i * 2 + 1]) ^ (check_invert << 8 | check_invert);
+		if (((pixels[i * 3] & 0xF8) != ((rgb >> 8) & 0xF8)) || ((pixels[i * 3 + 1] & 0xFC) != ((rgb >> 3) & 0xFC)) ||
+			((pixels[i * 3 + 2] & 0xF8) != ((rgb << 3) & 0xF8))) return HAL_ERROR;
+	}
+	return HAL_OK;
+}
+
+/*
+ * @brief ILI9341_check_write_clock() Write the pattern on the candidate write clock, and read it back on the read clock.
+ */
+
+static HAL_StatusTypeDef ILI9341_check_write_clock(s_spi_bus* bus, void* arg)
+{	uint32_t prescaler = bus->handle.Init.BaudRatePrescaler; HAL_StatusTypeDef result;
+	ILI9341_check_write();
+	SPI_ClockRead(bus);
+	result = ILI9341_check_read(bus, arg);
+	SPI_SetPrescaler(bus, prescaler);
+	return result;
+}
+
+/*
+ * @brief ILI9341_NegotiateClock() The read clock first: the pattern is written on the slowest clock, and read back
+ * on the candidate read clocks. Then the write clock: the pattern is written on the candidate clocks, and read back
+ * on the found read clock. The bus stays on the write clock.
+ */
+
+HAL_StatusTypeDef ILI9341_NegotiateClock()
+{	uint32_t prescaler;
+	SPI_SetPrescaler(&display_spi1_bus, SPI_BAUDRATEPRESCALER_256);
+	ILI9341_check_write();
+	if (SPI_ClockNegotiate(&display_spi1_bus, ILI9341_READ_MAX_HZ, ILI9341_check_read, NULL, &prescaler) != HAL_OK)
+	{
+		SPI_ClockWrite(&display_spi1_bus);
+		return HAL_ERROR;
+	}
+	display_spi1_bus.read_prescaler = prescaler;
+	if (SPI_ClockNegotiate(&display_spi1_bus, ILI9341_WRITE_MAX_HZ, ILI9341_check_write_clock, NULL, &prescaler) != HAL_OK)
+	{
+		SPI_ClockWrite(&display_spi1_bus);
+		return HAL_ERROR;
+	}
+	display_spi1_bus.write_prescaler = prescaler;
+	SPI_ClockWrite(&display_spi1_bus);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef ILI9341_SetPixelFormat(e_ili9341_format format)
 {
-	ILI9341_writecmd(0x2A);
-	ILI9341_writedata(x1>>8);
-	ILI9341_writedata(x1);
-	ILI9341_writedata(x2>>8);
-	ILI9341_writedata(x2);
+#if defined (ILI9341_DMA)
+	/* The queued pixel writes are in the old format. */
+	if (ILI9341_wait() != HAL_OK) return HAL_ERROR;
+#endif
+	ILI9341_writecmd(ILI9341_PIXEL_FORMAT);
+	if (ILI9341_writedata(format) != HAL_OK) return HAL_ERROR;
+	ili9341_format = format;
+	return HAL_OK;
+}
 
-	ILI9341_writecmd(0x2B);
-	ILI9341_writedata(y1>>8);
-	ILI9341_writedata(y1);
-	ILI9341_writedata(y2>>8);
-	ILI9341_writedata(y2);
+/*
+ * @brief ILI9341_ScrollArea(top, height) The 3 areas must cover the 320 lines, the top fixed area, and the scroll area
+ * are clipped to them.
+ */
 
-	ILI9341_writecmd(0x2C);
+HAL_StatusTypeDef ILI9341_ScrollArea(uint16_t top, uint16_t height)
+{	uint8_t param[6]; uint16_t bottom;
+	if (top > ILI9341_HEIGHT) top = ILI9341_HEIGHT;
+	if (height > ILI9341_HEIGHT - top) height = ILI9341_HEIGHT - top;
+	bottom = ILI9341_HEIGHT - top - height;
+#if defined (ILI9341_DMA)
+	if (ILI9341_wait() != HAL_OK) return HAL_ERROR;
+#endif
+	param[0] = top >> 8;
+	param[1] = top;
+	param[2] = height >> 8;
+	param[3] = height;
+	param[4] = bottom >> 8;
+	param[5] = bottom;
+	ILI9341_writecmd(ILI9341_VSCRDEF);
+	return ILI9341_writedatas(param, sizeof(param));
+}
+
+/*
+ * @brief ILI9341_ScrollStart(line) The command, and its 2 parameter bytes in one CS period: a console sends it after
+ * every line.
+ */
+
+HAL_StatusTypeDef ILI9341_ScrollStart(uint16_t line)
+{	uint8_t param[2];
+#if defined (ILI9341_DMA)
+	if (ILI9341_wait() != HAL_OK) return HAL_ERROR;
+#endif
+	param[0] = line >> 8;
+	param[1] = line;
+	SELECT_DISPLAY();
+	SELECT_COMMAND();
+	SPI_Exchange(&display_spi1_bus, ILI9341_VSCRSADD);
+	SELECT_DATA();
+	SPI_ExchangeBuf(&display_spi1_bus, param, NULL, sizeof(param));
+	DESELECT_DISPLAY();
+	return HAL_OK;
 }
 
 void DisplaySoftOn()
@@ -320,7 +532,11 @@ HAL_StatusTypeDef ILI9341_buf_to_disp(void* pixelptr, uint16_t size)
 	 * Transfer help with DMA...
 	 */
 #if defined (ILI9341_DMA)
-	return SPI_WriteBufDMA(pixelptr, size, display_spi1_handle, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	if (ili9341_format == ILI9341_RGB565)
+	{
+		return SPI_WriteBufDMA16(&display_spi1_bus, pixelptr, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	}
+	return SPI_WriteBufDMA(&display_spi1_bus, pixelptr, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 #else
 	/*
 	 * Transfer without helping DMA...
@@ -336,6 +552,201 @@ HAL_StatusTypeDef ILI9341_buf_to_disp(void* pixelptr, uint16_t size)
 	return HAL_OK;
 }
 
+#if defined (ILI9341_DMA)
+
+/*
+ * @brief: ILI9341_buf_to_disp_async(s_spi_xfer* xfer, void* pixelptr, uint16_t size, spi_xfer_callback callback, void* arg)
+ * Queue the buffer to write the display memory, and return immediately. The callback runs
+ * in the DMA interrupt, when the buffer is free again.
+ * @params: xfer the transfer descriptor, pixelptr, size the pixel buffer, callback, arg complete callback
+ * and its argument.
+ */
+
+void ILI9341_buf_to_disp_async(s_spi_xfer* xfer, void* pixelptr, uint16_t size, spi_xfer_callback callback, void* arg)
+{
+	SPI_XferInit(xfer, pixelptr, size, ILI9341_PixelXfer(), callback, arg);
+	SPI_QueueSubmit(&display_spi1_bus, xfer);
+}
+
+/*
+ * @brief: ILI9341_wait() Wait for the end of the queued display transfers.
+ */
+
+HAL_StatusTypeDef ILI9341_wait()
+{
+	return SPI_QueueFlush(&display_spi1_bus, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+}
+
+/*
+ * Command bytes of the display DMA programs.
+ */
+static const uint8_t prog_cmds[] = {ILI9341_COLUMN_ADDR, ILI9341_PAGE_ADDR, ILI9341_RAMWR};
+
+/*
+ * @brief: ILI9341_prog_window(prog, x1, y1, x2, y2, pixels, size, callback, arg) Build the DMA program
+ * of the window set, and the pixel write.
+ */
+
+void ILI9341_prog_window(s_ili9341_prog* prog, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+		const void* pixels, uint16_t size, spi_xfer_callback callback, void* arg)
+{	int i, steps = ILI9341_PROG_STEPS;
+
+	prog->caddr[0] = x1 >> 8;
+	prog->caddr[1] = x1;
+	prog->caddr[2] = x2 >> 8;
+	prog->caddr[3] = x2;
+	prog->paddr[0] = y1 >> 8;
+	prog->paddr[1] = y1;
+	prog->paddr[2] = y2 >> 8;
+	prog->paddr[3] = y2;
+
+	SPI_XferInit(&prog->step[0], (void*)&prog_cmds[0], 1, SPI_XFER_TX | SPI_XFER_CS_HOLD, NULL, NULL);
+	SPI_XferInit(&prog->step[1], prog->caddr, sizeof(prog->caddr), SPI_XFER_TX | SPI_XFER_DATA | SPI_XFER_CS_HOLD, NULL, NULL);
+	SPI_XferInit(&prog->step[2], (void*)&prog_cmds[1], 1, SPI_XFER_TX | SPI_XFER_CS_HOLD, NULL, NULL);
+	SPI_XferInit(&prog->step[3], prog->paddr, sizeof(prog->paddr), SPI_XFER_TX | SPI_XFER_DATA | SPI_XFER_CS_HOLD, NULL, NULL);
+	if (size)
+	{
+		SPI_XferInit(&prog->step[4], (void*)&prog_cmds[2], 1, SPI_XFER_TX | SPI_XFER_CS_HOLD, NULL, NULL);
+		SPI_XferInit(&prog->step[5], (void*)pixels, size, ILI9341_PixelXfer(), callback, arg);
+	} else
+	{
+		/* Only the window, the pixels come later. */
+		SPI_XferInit(&prog->step[4], (void*)&prog_cmds[2], 1, SPI_XFER_TX, callback, arg);
+		steps--;
+	}
+	for (i = 0; i < steps - 1; i++)
+	{
+		prog->step[i].next = &prog->step[i + 1];
+	}
+}
+
+/*
+ * @brief: ILI9341_prog_submit(prog) Queue the program on the display bus. The window cache takes the window at the
+ * submit, not at the send: a caller who aborts a submitted program must call ILI9341_window_invalidate().
+ */
+
+void ILI9341_prog_submit(s_ili9341_prog* prog)
+{	uint16_t x1 = (prog->caddr[0] << 8) | prog->caddr[1], x2 = (prog->caddr[2] << 8) | prog->caddr[3];
+	uint16_t y1 = (prog->paddr[0] << 8) | prog->paddr[1], y2 = (prog->paddr[2] << 8) | prog->paddr[3];
+	uint8_t columns = (x1 != ili9341_window.x1) || (x2 != ili9341_window.x2);
+	uint8_t pages = (y1 != ili9341_window.y1) || (y2 != ili9341_window.y2);
+	/* The programs run in the queue order, the cache is the window of the last queued one. The steps of
+	 * the unchanged ranges are left out of the chain. */
+	prog->step[1].next = (pages) ? &prog->step[2] : &prog->step[4];
+	ili9341_window.x1 = x1;
+	ili9341_window.x2 = x2;
+	ili9341_window.y1 = y1;
+	ili9341_window.y2 = y2;
+	SPI_QueueSubmitChain(&display_spi1_bus, (columns) ? &prog->step[0] : (pages) ? &prog->step[2] : &prog->step[4]);
+}
+
+#endif
+
+/*
+ * Pixel streaming stage. The buffers of the window go through a CPU sourced bus pipe (spi_sched.h):
+ * the source makes the next buffer, while the DMA sends the previous one, so the display writes
+ * are bound by the SPI clock, if the source is faster than the wire. Without DMA the source, and
+ * the writes take turns on one buffer.
+ */
+
+typedef struct {
+	ili9341_pixel_source source;
+	void* arg;
+	uint32_t remain;					// Pixels to make.
+	uint16_t chunk;						// Pixels per buffer.
+#if defined (ILI9341_DMA)
+	s_spi_pipe pipe;
+	s_spi_xfer xfer[SPI_PIPE_SLOTS];	// Display writes.
+#endif
+} s_ili9341_stream;
+
+/* Buffers of the stage, half-word aligned for the 16 bit frames. */
+static uint16_t stream_buffers[SPI_PIPE_SLOTS][ILI9341_STREAM_BUFFER_SIZE / 2];
+
+/* @brief ILI9341_stream_next(stream, buffer) Get the next buffer of pixels from the source. @retval the pixels, 0 on error. */
+
+static uint16_t ILI9341_stream_next(s_ili9341_stream* stream, void* buffer)
+{	uint16_t pixels = (stream->remain < stream->chunk) ? stream->remain : stream->chunk;
+	if (!stream->source(buffer, pixels, stream->arg)) return 0;
+	stream->remain -= pixels;
+	return pixels;
+}
+
+#if defined (ILI9341_DMA)
+
+static void ILI9341_stream_done(s_spi_xfer* xfer, e_dma_transfer_state state)
+{	s_ili9341_stream* stream = xfer->arg;
+	if (state == TRANSFER_COMPLETE)
+	{
+		SPI_PipeDrained(&stream->pipe, xfer - stream->xfer);
+	} else SPI_PipeFailed(&stream->pipe);
+}
+
+static uint8_t ILI9341_stream_fill(s_spi_pipe* pipe, uint8_t slot)
+{	uint16_t pixels = ILI9341_stream_next(pipe->arg, pipe->buffer[slot]);
+	if (!pixels) return 0;
+	SPI_PipeFilled(pipe, slot, pixels * ILI9341_BytesPerPixel());
+	return 1;
+}
+
+static uint8_t ILI9341_stream_drain(s_spi_pipe* pipe, uint8_t slot)
+{	s_ili9341_stream* stream = pipe->arg;
+	ILI9341_buf_to_disp_async(&stream->xfer[slot], pipe->buffer[slot], pipe->length[slot], ILI9341_stream_done, stream);
+	return 1;
+}
+
+#endif
+
+void* ILI9341_stream_buffer(uint8_t slot)
+{
+	return stream_buffers[slot];
+}
+
+/*
+ * @brief: ILI9341_stream_chunks(x, y, width, height, chunk, source, arg) Fill the window with the pixels of the source,
+ * chunk pixels per buffer.
+ */
+
+HAL_StatusTypeDef ILI9341_stream_chunks(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t chunk,
+		ili9341_pixel_source source, void* arg)
+{	static s_ili9341_stream stream;
+
+	if (!chunk || ((uint32_t)chunk * ILI9341_BytesPerPixel() > ILI9341_STREAM_BUFFER_SIZE)) return HAL_ERROR;
+	stream.source = source;
+	stream.arg = arg;
+	stream.remain = (uint32_t)width * height;
+	stream.chunk = chunk;
+	ILI9341_setaddr(x, y, x + width - 1, y + height - 1);
+	ILI9341_writecmd(ILI9341_RAMWR);
+#if defined (ILI9341_DMA)
+	uint8_t* buffers[SPI_PIPE_SLOTS]; int i;
+	for (i = 0; i < SPI_PIPE_SLOTS; i++)
+	{
+		buffers[i] = (uint8_t*)stream_buffers[i];
+	}
+	SPI_PipeInit(&stream.pipe, NULL, &display_spi1_bus, buffers, (stream.remain + chunk - 1) / chunk,
+			ILI9341_stream_fill, ILI9341_stream_drain, &stream);
+	return SPI_PipeRun(&stream.pipe, ILI9341_STREAM_TIMEOUT);
+#else
+	uint16_t pixels;
+	while (stream.remain)
+	{
+		if ((pixels = ILI9341_stream_next(&stream, stream_buffers[0])) == 0) return HAL_ERROR;
+		if (ILI9341_buf_to_disp(stream_buffers[0], pixels * ILI9341_BytesPerPixel()) != HAL_OK) return HAL_ERROR;
+	}
+	return HAL_OK;
+#endif
+}
+
+/*
+ * @brief: ILI9341_stream(x, y, width, height, source, arg) Fill the window with the pixels of the source.
+ */
+
+HAL_StatusTypeDef ILI9341_stream(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ili9341_pixel_source source, void* arg)
+{
+	return ILI9341_stream_chunks(x, y, width, height, SCR_BUFFER_IN_PIXELS, source, arg);
+}
+
 /*
  * @brief: ILI9341_disp_to_buf(void* pixelptr, uint16_t DT) Read to the the buffer from the display.
  * @params: void* pixelptr next pixel buffer pointer. uint16_t size: buffer size in byte.
@@ -347,7 +758,7 @@ HAL_StatusTypeDef ILI9341_disp_to_buf(void* pixelptr, uint16_t size)
 	 * Transfer help with DMA...
 	 */
 #if defined (ILI9341_DMA)
-	return SPI_ReadBufDMA(pixelptr, size, display_spi1_handle, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	return SPI_ReadBufDMA(&display_spi1_bus, pixelptr, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
 #else
 	/*
 	 * Transfer without helping DMA...
@@ -360,115 +771,315 @@ HAL_StatusTypeDef ILI9341_disp_to_buf(void* pixelptr, uint16_t size)
 }
 
 HAL_StatusTypeDef ILI9341_getpixels(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t* pixels)
-{
+{	uint32_t size = (uint32_t)width * height * 3;
+	if (!size || (size > SCR_BUFFER_SIZE)) return HAL_ERROR;
+#if defined (ILI9341_DMA)
+	if (ILI9341_wait() != HAL_OK) return HAL_ERROR;
+#endif
 	ILI9341_setaddr(x, y, x + width - 1, y + height - 1);
-	ILI9341_writecmd(ILI9341_RAMRD);
-	ILI9341_writedata(DP_DUMMY_BYTE);
-	ILI9341_disp_to_buf(pixels, SCR_BUFFER_SIZE);
+	/* The display reads slower, than it writes. */
+	SPI_ClockRead(&display_spi1_bus);
+	/* The read lasts until the CS goes high, the command, and the pixels are one transaction. */
+	SELECT_DISPLAY();
+	SELECT_COMMAND();
+	SPI_Exchange(&display_spi1_bus, ILI9341_RAMRD);
+	SELECT_DATA();
+	SPI_Exchange(&display_spi1_bus, DP_DUMMY_BYTE);
+	ILI9341_disp_to_buf(pixels, size);
+	DESELECT_DISPLAY();
+	SPI_ClockWrite(&display_spi1_bus);
 	return HAL_OK;
 };
 
 /*
- * HAL_StatusTypeDef ILI9341_displaybitmap(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* buffer, int BufSize)
+ * Screen readback stage. The chunks of the window are read in one CS period (the CS high ends the RAMRD), the last
+ * chunk releases the CS. With DMA the display bus fills the stage buffers, and the CPU drains them (bus pipe without
+ * destination bus).
  */
 
-HAL_StatusTypeDef ILI9341_displaybitmap(uint16_t x, uint16_t y, uint16_t widthi, uint16_t heighti, s_image* image)
-{
-	ILI9341_setaddr(x, y, x + image->width - 1, y + image->height - 1);
-	ILI9341_writecmd(ILI9341_RAMWR);
+typedef struct {
+	ili9341_pixel_sink sink;
+	void* arg;
+	uint32_t remain;					// Pixels to read.
+	uint16_t chunk;						// Pixels per buffer.
+#if defined (ILI9341_DMA)
+	s_spi_pipe pipe;
+	s_spi_xfer xfer[SPI_PIPE_SLOTS];	// Display reads.
+#endif
+} s_ili9341_readback;
 
-	uint8_t* fillbuffer; int i, j; int32_t DT, remain; int last_remain; HAL_StatusTypeDef result;
-	uint8_t* pixelptr = image->pixel_data;
-
-	  SELECT_DATA();
-	  remain = (image->width * image->height * BYTE_PER_PIXEL);
-	  do
-	  {
-	  	if ((remain - SCR_BUFFER_SIZE) > 0)
-	  	{
-	  		last_remain = 0;
-	  		DT = SCR_BUFFER_SIZE;
-	  		remain -= SCR_BUFFER_SIZE;
-	  	} else
-	  	{
-	  		last_remain = 1;
-	  		DT = remain;
-	  	}
-	  	if (ILI9341_buf_to_disp(pixelptr, DT) != HAL_OK)
-	  	{
-	  		return HAL_ERROR;
-	  	}
-	  	  pixelptr += SCR_BUFFER_SIZE;
-
-	  } while (!last_remain);
-	return HAL_OK;
+/*
+ * @brief ILI9341_read565(buffer, pixels) Convert the read format (R, G, B bytes, 6 bits left aligned) to RGB565 in
+ * place: the 2 byte pixel i never overwrites the 3 byte pixels after it.
+ */
+
+static void ILI9341_read565(uint8_t* buffer, uint16_t pixels)
+{	t_color565* dst = (t_color565*)buffer; const uint8_t* src = buffer; uint16_t i;
+	for (i = 0; i < pixels; i++, src += 3)
+	{
+		dst[i] = ((src[0] & 0xF8) << 8) | ((src[1] & 0xFC) << 3) | (src[2] >> 3);
+	}
 }
 
-/**
-  * @brief  HAL_StatusTypeDef ILI9341_fillrectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color)
-  * @params
-  * @retval None
-  */
+/* @brief ILI9341_readback_next(readback) The pixels of the next chunk. */
 
-HAL_StatusTypeDef ILI9341_fillrectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color)
-{	HAL_StatusTypeDef result = HAL_OK;
-	ILI9341_setaddr(x, y, x + width - 1, y + height - 1);
-	ILI9341_writecmd(ILI9341_RAMWR);
+static uint16_t ILI9341_readback_next(s_ili9341_readback* readback)
+{	uint16_t pixels = (readback->remain < readback->chunk) ? readback->remain : readback->chunk;
+	readback->remain -= pixels;
+	return pixels;
+}
 
-	/*
-	 * Make the filled buffer for to fill the color bytes.
-	 */
+#if defined (ILI9341_DMA)
+
+static void ILI9341_readback_done(s_spi_xfer* xfer, e_dma_transfer_state state)
+{	s_ili9341_readback* readback = xfer->arg;
+	if (state == TRANSFER_COMPLETE)
+	{
+		SPI_PipeFilled(&readback->pipe, xfer - readback->xfer, xfer->size);
+	} else SPI_PipeFailed(&readback->pipe);
+}
+
+static uint8_t ILI9341_readback_fill(s_spi_pipe* pipe, uint8_t slot)
+{	s_ili9341_readback* readback = pipe->arg; uint16_t pixels = ILI9341_readback_next(readback);
+	SPI_XferInit(&readback->xfer[slot], pipe->buffer[slot], pixels * 3,
+			SPI_XFER_RX | SPI_XFER_DATA | ((readback->remain) ? SPI_XFER_CS_HOLD : 0), ILI9341_readback_done, readback);
+	SPI_QueueSubmit(&display_spi1_bus, &readback->xfer[slot]);
+	return 1;
+}
+
+static uint8_t ILI9341_readback_drain(s_spi_pipe* pipe, uint8_t slot)
+{	s_ili9341_readback* readback = pipe->arg; uint16_t pixels = pipe->length[slot] / 3;
+	ILI9341_read565(pipe->buffer[slot], pixels);
+	if (!readback->sink((t_color565*)pipe->buffer[slot], pixels, readback->arg)) return 0;
+	SPI_PipeDrained(pipe, slot);
+	return 1;
+}
+
+#endif
+
+/*
+ * @brief: ILI9341_readback_chunks(x, y, width, height, chunk, sink, arg) Read the window to the sink, chunk pixels
+ * per buffer.
+ */
+
+HAL_StatusTypeDef ILI9341_readback_chunks(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t chunk,
+		ili9341_pixel_sink sink, void* arg)
+{	static s_ili9341_readback readback; HAL_StatusTypeDef result = HAL_OK;
 
-	uint8_t* fillbuffer; int i, j; uint16_t pixels; int32_t remain; int last_remain;
-	// uint8_t* cc = (uint8_t*)&color;
-	if ((fillbuffer = malloc(SCR_BUFFER_SIZE)) == NULL)
+	if (!chunk || (chunk > ILI9341_READBACK_CHUNK) || !width || !height || (x + width > ILI9341_WIDTH) ||
+		(y + height > ILI9341_HEIGHT)) return HAL_ERROR;
+#if defined (ILI9341_DMA)
+	if (ILI9341_wait() != HAL_OK) return HAL_ERROR;
+#endif
+	readback.sink = sink;
+	readback.arg = arg;
+	readback.remain = (uint32_t)width * height;
+	readback.chunk = chunk;
+	ILI9341_setaddr(x, y, x + width - 1, y + height - 1);
+	SPI_ClockRead(&display_spi1_bus);
+	SELECT_DISPLAY();
+	SELECT_COMMAND();
+	SPI_Exchange(&display_spi1_bus, ILI9341_RAMRD);
+	SELECT_DATA();
+	/* Dummy read cycle before the pixels. */
+	SPI_Exchange(&display_spi1_bus, DP_DUMMY_BYTE);
+#if defined (ILI9341_DMA)
+	uint8_t* buffers[SPI_PIPE_SLOTS]; int i;
+	for (i = 0; i < SPI_PIPE_SLOTS; i++)
+	{
+		buffers[i] = (uint8_t*)stream_buffers[i];
+	}
+	SPI_PipeInit(&readback.pipe, &display_spi1_bus, NULL, buffers, (readback.remain + chunk - 1) / chunk,
+			ILI9341_readback_fill, ILI9341_readback_drain, &readback);
+	result = SPI_PipeRun(&readback.pipe, ILI9341_STREAM_TIMEOUT);
+#else
+	uint16_t pixels;
+	while (readback.remain)
+	{
+		pixels = ILI9341_readback_next(&readback);
+		SPI_ExchangeBuf(&display_spi1_bus, NULL, (uint8_t*)stream_buffers[0], pixels * 3);
+		ILI9341_read565((uint8_t*)stream_buffers[0], pixels);
+		if (!sink(stream_buffers[0], pixels, arg))
 		{
-			ForceErrorNumber(5);
-			return HAL_ERROR;
+			result = HAL_ERROR;
+			break;
 		}
+	}
+#endif
+	/* The read ends here on error. */
+	DESELECT_DISPLAY();
+	SPI_ClockWrite(&display_spi1_bus);
+	return result;
+}
 
-	/*
-	 * Load the fill buffer for color datas.
-	 */
-	for (i = 0; i < SCR_BUFFER_SIZE; i += BYTE_PER_PIXEL)
+/*
+ * @brief: ILI9341_readback(x, y, width, height, sink, arg) Read the window to the sink.
+ */
+
+HAL_StatusTypeDef ILI9341_readback(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ili9341_pixel_sink sink, void* arg)
+{
+	return ILI9341_readback_chunks(x, y, width, height, ILI9341_READBACK_CHUNK, sink, arg);
+}
+
+/*
+ * HAL_StatusTypeDef ILI9341_displaybitmap(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* buffer, int BufSize)
+ */
+
+/*
+ * @brief ILI9341_convert(src, src_bpp, dst, pixels) Convert image pixels to the pixel format of the display.
+ * src_bpp 2: native uint16_t RGB565, 3: RGB666 bytes. The 5, and 6 bit colors are widened with their upper bits,
+ * so the white stays white.
+ */
+
+void ILI9341_convert(const uint8_t* src, uint8_t src_bpp, void* dst, uint16_t pixels)
+{	uint16_t i, p; t_color color;
+	for (i = 0; i < pixels; i++)
 	{
-		for (j = 0; j < BYTE_PER_PIXEL; j++)
+		if (src_bpp == 2)
+		{
+			p = src[i * 2] | (src[i * 2 + 1] << 8);
+			color[0] = ((p >> 8) & 0xF8) | (p >> 13);
+			color[1] = ((p >> 3) & 0xFC) | ((p >> 9) & 0x03);
+			color[2] = (p << 3) | ((p >> 2) & 0x07);
+		} else
 		{
-			fillbuffer[j + i] = (color[j] & 0b11111100);
+			color[0] = src[i * 3] | (src[i * 3] >> 6);
+			color[1] = src[i * 3 + 1] | (src[i * 3 + 1] >> 6);
+			color[2] = src[i * 3 + 2] | (src[i * 3 + 2] >> 6);
 		}
+		if (ili9341_format == ILI9341_RGB565) ((t_color565*)dst)[i] = ILI9341_Color565(color);
+		else ILI9341_Color666(color, (uint8_t*)dst + i * 3);
 	}
+}
+
+void ILI9341_pixel(const t_color color, uint8_t* pixel)
+{	t_color565 p565;
+	if (ili9341_format == ILI9341_RGB565)
+	{
+		p565 = ILI9341_Color565(color);
+		memcpy(pixel, &p565, sizeof(p565));
+	} else ILI9341_Color666(color, pixel);
+}
 
-	  SELECT_DATA();
-	  remain = (width * height * BYTE_PER_PIXEL);
-	  do
-	  {
-		if ((remain - SCR_BUFFER_SIZE) > 0)
+/* @brief ILI9341_span(dst, pixel, count) The RGB565 pixels are 16 bit stores (the stage buffers are aligned), the pixel
+ * may be anywhere. */
+
+void ILI9341_span(void* dst, const uint8_t* pixel, uint16_t count)
+{	uint8_t* d = dst;
+	if (ili9341_format == ILI9341_RGB565)
+	{
+		uint16_t p;
+		memcpy(&p, pixel, sizeof(p));
+		while (count--)
 		{
-	  		pixels = SCR_BUFFER_SIZE;
-	  		remain = remain - SCR_BUFFER_SIZE;
-	  		last_remain = 0;
-		} else
+			*(uint16_t*)d = p;
+			d += 2;
+		}
+		return;
+	}
+	while (count--)
+	{
+		d[0] = pixel[0];
+		d[1] = pixel[1];
+		d[2] = pixel[2];
+		d += 3;
+	}
+}
+
+/* Image source of the streaming stage. */
+
+typedef struct {
+	const uint8_t* pixels;		// The next pixel of the image.
+	uint8_t bytes_per_pixel;	// Format of the image.
+} s_ili9341_image_source;
+
+static uint8_t ILI9341_image_source(void* buffer, uint16_t pixels, void* arg)
+{	s_ili9341_image_source* image = arg;
+	if (image->bytes_per_pixel == ILI9341_BytesPerPixel())
+	{
+		memcpy(buffer, image->pixels, pixels * image->bytes_per_pixel);
+	} else ILI9341_convert(image->pixels, image->bytes_per_pixel, buffer, pixels);
+	image->pixels += pixels * image->bytes_per_pixel;
+	return 1;
+}
+
+HAL_StatusTypeDef ILI9341_displaybitmap(uint16_t x, uint16_t y, uint16_t widthi, uint16_t heighti, s_image* image)
+{	s_ili9341_image_source source;
+#if defined (ILI9341_DMA)
+	/*
+	 * The window set, and the pixels are one DMA program, if the image is in the display format,
+	 * and it fits to one DMA transfer.
+	 */
+	s_ili9341_prog prog; uint8_t bpp = ILI9341_BytesPerPixel(); uint32_t size = (uint32_t)image->width * image->height * bpp;
+	HAL_StatusTypeDef result;
+	if ((image->bytes_per_pixel == bpp) && (size <= SPI_DMA_MAX_SIZE))
+	{
+		ILI9341_prog_window(&prog, x, y, x + image->width - 1, y + image->height - 1, image->pixel_data, size, NULL, NULL);
+		ILI9341_prog_submit(&prog);
+		/* The program is on the stack: it must leave the queue before the return. */
+		if ((result = ILI9341_wait()) != HAL_OK)
 		{
-			pixels = (remain);
-			last_remain = 1;
+			SPI_QueueAbort(&display_spi1_bus);
+			/* The window steps may not have gone out. */
+			ILI9341_window_invalidate();
 		}
+		return result;
+	}
+#endif
+	/* The other images go through the streaming stage, it converts the next buffer, while the previous one goes out. */
+	source.pixels = image->pixel_data;
+	source.bytes_per_pixel = image->bytes_per_pixel;
+	return ILI9341_stream(x, y, image->width, image->height, ILI9341_image_source, &source);
+}
 
-	  	if (ILI9341_buf_to_disp(fillbuffer, pixels) != HAL_OK)
-	  	{
-	  		return HAL_ERROR;
-	  	}
+/* @brief ILI9341_fill_source(buffer, pixels, arg) The same pixel (arg: the pixel in the display format) again, and again. */
 
-	  } while (!last_remain);
+static uint8_t ILI9341_fill_source(void* buffer, uint16_t pixels, void* arg)
+{
+	ILI9341_span(buffer, arg, pixels);
+	return 1;
+}
 
-	free(fillbuffer);
-	return result;
+/**
+  * @brief  HAL_StatusTypeDef ILI9341_fillrectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color)
+  * The one frame pixels (RGB565, and the grays of RGB666) go from a fixed DMA source address, up to
+  * SPI_DMA_MAX_SIZE frames per transfer. The other RGB666 colors go through the streaming stage.
+  * @params
+  * @retval None
+  */
+
+HAL_StatusTypeDef ILI9341_fillrectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color)
+{	t_color565 p565 = ILI9341_Color565(color); t_color666 p666; uint8_t pixel[ILI9341_MAX_BYTES_PER_PIXEL];
 
+	ILI9341_Color666(color, p666);
+#if defined (ILI9341_DMA)
+	HAL_StatusTypeDef result = HAL_OK; uint32_t frames; uint16_t count;
+	if ((ili9341_format == ILI9341_RGB565) || ((p666[0] == p666[1]) && (p666[1] == p666[2])))
+	{
+		ILI9341_setaddr(x, y, x + width - 1, y + height - 1);
+		ILI9341_memwrite();
+		frames = (uint32_t)width * height;
+		if (ili9341_format == ILI9341_RGB666) frames *= 3;
+		while (frames)
+		{
+			count = (frames > SPI_DMA_MAX_SIZE) ? SPI_DMA_MAX_SIZE : frames;
+			if (ili9341_format == ILI9341_RGB565) result = SPI_FillDMA(&display_spi1_bus, &p565, count, 1, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+			else result = SPI_FillDMA(&display_spi1_bus, p666, count, 0, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+			if (result != HAL_OK) break;
+			frames -= count;
+		}
+		DESELECT_DISPLAY();
+		return result;
+	}
+#endif
+	ILI9341_pixel(color, pixel);
+	return ILI9341_stream(x, y, width, height, ILI9341_fill_source, pixel);
 }
 
 void ILI9341_draw(uint8_t *buff)
 {
 //	ili9341_setaddr(0, 0, 153, 144);//11088 for 153*144
-//	HAL_SPI_Transmit_DMA(&display_spi1_handle, buff, 44352);
+//	HAL_SPI_Transmit_DMA(&display_spi1_bus.handle, buff, 44352);
 }
 
 #if defined (ILI9341_DMA)
@@ -479,7 +1090,7 @@ void ILI9341_draw(uint8_t *buff)
 
 void DMA1_Channel2_IRQHandler(void)
 {
-	HAL_DMA_IRQHandler(display_spi1_handle.hdmarx);
+	HAL_DMA_IRQHandler(display_spi1_bus.handle.hdmarx);
 }
 
 /*
@@ -488,7 +1099,7 @@ void DMA1_Channel2_IRQHandler(void)
 
 void DMA1_Channel3_IRQHandler(void)
 {
-	HAL_DMA_IRQHandler(display_spi1_handle.hdmatx);
+	HAL_DMA_IRQHandler(display_spi1_bus.handle.hdmatx);
 }
 #endif
 
@@ -33,6 +33,7 @@
 
 #include <stdint.h>
 #include "stm32f1xx_hal.h"
+#include "spi.h"
 
 
 #ifndef ILI9341_SPI_ILI9341_SPI_H_
@@ -90,17 +91,19 @@
 #define DISPLAY_LCD_PIN	GPIO_PIN_1
 
 
-#define SELECT_DISPLAY()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN, GPIO_PIN_RESET)
-#define DESELECT_DISPLAY()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN, GPIO_PIN_RESET)
+/* The control lines are single BSRR/BRR stores (see SPI_PIN_HIGH, SPI_PIN_LOW). */
 
-#define RESET_ACTIVE()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_RST_PIN, GPIO_PIN_RESET)
-#define RESET_PASSIVE()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_RST_PIN, GPIO_PIN_SET)
+#define SELECT_DISPLAY()	SPI_PIN_LOW(DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN)
+#define DESELECT_DISPLAY()	SPI_PIN_HIGH(DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN)
 
-#define SELECT_DATA()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN, GPIO_PIN_SET)
-#define SELECT_COMMAND()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN, GPIO_PIN_RESET)
+#define RESET_ACTIVE()	SPI_PIN_LOW(DISPLAY_CONTROL_PORT, DISPLAY_RST_PIN)
+#define RESET_PASSIVE()	SPI_PIN_HIGH(DISPLAY_CONTROL_PORT, DISPLAY_RST_PIN)
 
-#define DISPLAY_ON()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_LCD_PIN, GPIO_PIN_RESET)
-#define DISPLAY_OFF()	HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_LCD_PIN, GPIO_PIN_SET)
+#define SELECT_DATA()	SPI_PIN_HIGH(DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN)
+#define SELECT_COMMAND()	SPI_PIN_LOW(DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN)
+
+#define DISPLAY_ON()	SPI_PIN_LOW(DISPLAY_CONTROL_PORT, DISPLAY_LCD_PIN)
+#define DISPLAY_OFF()	SPI_PIN_HIGH(DISPLAY_CONTROL_PORT, DISPLAY_LCD_PIN)
 
 #define DISPLAY_SPI_TRANSMIT_TIMEOUT 1000
 
@@ -116,6 +119,20 @@
 
 #define DISPLAY_SPI_CHANNEL	SPI1
 
+/* @brief The display SPI bus. */
+extern s_spi_bus display_spi1_bus;
+
+/*
+ * Clock limits of the display. The datasheet serial write cycle is 100 ns (10 MHz), but the
+ * controllers take the writes well above it, and the readback check of ILI9341_NegotiateClock()
+ * steps down if the module does not. The read cycle is 150 ns, the reads (RAMRD) use slower clock.
+ */
+#define ILI9341_WRITE_MAX_HZ	18000000
+#define ILI9341_READ_MAX_HZ		6600000
+
+/* The readback check pattern goes to the first pixels of the first line. */
+#define ILI9341_CHECK_PIXELS	8
+
 #if defined (ILI9341_DMA)
 #define DISPLAY_TX_DMA_CHANNEL	DMA1_Channel3
 #define DISPLAY_RX_DMA_CHANNEL	DMA1_Channel2
@@ -137,7 +154,9 @@
 #define ILI9341_PAGE_ADDR			0x2B
 #define ILI9341_RAMWR				0x2C
 #define ILI9341_RAMRD				0x2E
+#define ILI9341_VSCRDEF				0x33
 #define ILI9341_MAC					0x36
+#define ILI9341_VSCRSADD			0x37
 #define ILI9341_PIXEL_FORMAT		0x3A
 #define ILI9341_WDB					0x51
 #define ILI9341_WCD					0x53
@@ -164,24 +183,71 @@
 
 #define RGB_BGR_COLOR
 
-#define PIXEL_FORMAT_18_BIT
+/*
+ * Pixel formats, the values are the COLMOD (ILI9341_PIXEL_FORMAT) parameters. The format is
+ * selected at run time with ILI9341_SetPixelFormat().
+ * RGB565: 2 bytes per pixel. The pixel data phase goes in 16 bit SPI frames with half-word DMA,
+ * the pixel buffers hold native uint16_t RGB565 values.
+ * RGB666: 3 bytes per pixel, 6 bits per color, left aligned in the bytes. For the gradients.
+ */
+typedef enum {
+	ILI9341_RGB565 = 0x55,
+	ILI9341_RGB666 = 0x66
+} e_ili9341_format;
+
+/* The pixel format after ILI9341_Init(). */
+#define ILI9341_DEFAULT_FORMAT	ILI9341_RGB666
+
+/* The largest pixel on the wire (RGB666, and the RAMRD reads). */
+#define ILI9341_MAX_BYTES_PER_PIXEL	3
+
+/* @brief The current pixel format of the display. Change it with ILI9341_SetPixelFormat(). */
+extern e_ili9341_format ili9341_format;
 
-#ifdef PIXEL_FORMAT_18_BIT
-#define BYTE_PER_PIXEL	3
+/*
+ * Color types. t_color is the color of the drawing procedures (8 bits per color, red, green,
+ * blue order), the driver converts it to the pixel format of the display. t_color565, and t_color666
+ * are the pixels of the formats as they go to the display.
+ */
 typedef uint8_t t_color[3];
-#else
-#define BYTE_PER_PIXEL	2
-typedef uint8_t t_color[2];
-#endif
+typedef uint16_t t_color565;
+typedef uint8_t t_color666[3];
+
+static inline uint8_t ILI9341_BytesPerPixel()
+{
+	return (ili9341_format == ILI9341_RGB565) ? 2 : 3;
+}
+
+/* Queue flags of the pixel data transfers. */
+static inline uint8_t ILI9341_PixelXfer()
+{
+	return (ili9341_format == ILI9341_RGB565) ? (SPI_XFER_TX | SPI_XFER_DATA | SPI_XFER_16BIT) : (SPI_XFER_TX | SPI_XFER_DATA);
+}
+
+static inline t_color565 ILI9341_Color565(const t_color color)
+{
+	return ((color[0] & 0xF8) << 8) | ((color[1] & 0xFC) << 3) | (color[2] >> 3);
+}
+
+static inline void ILI9341_Color666(const t_color color, t_color666 pixel)
+{
+	pixel[0] = color[0] & 0xFC;
+	pixel[1] = color[1] & 0xFC;
+	pixel[2] = color[2] & 0xFC;
+}
+
+/* Screen size in pixels (portrait, MADCTL 0x48). */
+#define ILI9341_WIDTH	240
+#define ILI9341_HEIGHT	320
 
 /*
  * screen fillerect, and imagerect (get/set) procedures buffer's size in pixel.
  */
 #define SCR_BUFFER_IN_PIXELS	240
 /*
- * The real fillrect buffer size.
+ * The real fillrect buffer size. It holds SCR_BUFFER_IN_PIXELS pixels in both formats.
  */
-#define SCR_BUFFER_SIZE	(SCR_BUFFER_IN_PIXELS * BYTE_PER_PIXEL)
+#define SCR_BUFFER_SIZE	(SCR_BUFFER_IN_PIXELS * ILI9341_MAX_BYTES_PER_PIXEL)
 
 
 void SendData(uint16_t data);
@@ -198,7 +264,27 @@ void DisplayOff(void);
 
 void DISPLAY_SPI1_Init();
 void ILI9341_Init();
+HAL_StatusTypeDef ILI9341_writecmd(uint8_t cmd);
+HAL_StatusTypeDef ILI9341_writedatas(uint8_t* data, int size);
+HAL_StatusTypeDef ILI9341_writedata(uint8_t data);
+/* @brief ILI9341_setaddr(x1, y1, x2, y2) Set the window (inclusive ranges). The last window is cached,
+ * only the changed CASET, PASET ranges go to the display. The RAMWR, or RAMRD comes from the caller. */
+void ILI9341_setaddr(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+/* @brief ILI9341_window_invalidate() The window of the display is unknown, the next ILI9341_setaddr() sends both ranges. */
+void ILI9341_window_invalidate();
 void DisplaySoftOn();
+/* @brief ILI9341_NegotiateClock() Set up the read, and the write clock of the display with readback checks. */
+HAL_StatusTypeDef ILI9341_NegotiateClock();
+/* @brief ILI9341_SetPixelFormat(format) Switch the pixel format of the display (COLMOD). The frame memory
+ * content stays. */
+HAL_StatusTypeDef ILI9341_SetPixelFormat(e_ili9341_format format);
+/* @brief ILI9341_ScrollArea(top, height) Vertical scrolling definition (VSCRDEF): the top fixed lines, the height of
+ * the scroll area, and the rest is the bottom fixed area. The lines are the frame memory pages (portrait, no row,
+ * column exchange). */
+HAL_StatusTypeDef ILI9341_ScrollArea(uint16_t top, uint16_t height);
+/* @brief ILI9341_ScrollStart(line) Vertical scroll start address (VSCRSADD): the frame memory line at the top of
+ * the scroll area. */
+HAL_StatusTypeDef ILI9341_ScrollStart(uint16_t line);
 void DisplaySoftOff();
 
 #define DP_DUMMY_BYTE	(0xFF)
@@ -206,13 +292,112 @@ void DisplaySoftOff();
 typedef struct {
   uint16_t  	 width;
   uint8_t  	 height;
-  uint8_t  	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  uint8_t 	pixel_data[160 * 100 * BYTE_PER_PIXEL];
+  uint8_t  	 bytes_per_pixel; /* 2: RGB565 native (little endian) uint16_t, as GIMP exports it, 3: RGB666 */
+  uint8_t 	pixel_data[160 * 100 * ILI9341_MAX_BYTES_PER_PIXEL];
 } s_image;
 
 HAL_StatusTypeDef ILI9341_fillrectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, t_color color);
 HAL_StatusTypeDef ILI9341_displaybitmap(uint16_t x, uint16_t y, uint16_t widthi, uint16_t heighti, s_image* image);
+/* @brief ILI9341_getpixels(x, y, width, height, pixels) Read the window in the RAMRD format (3 bytes per pixel, 6 bits
+ * per color, left aligned), max. SCR_BUFFER_IN_PIXELS pixels. */
 HAL_StatusTypeDef ILI9341_getpixels(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t* pixels);
+/* @brief ILI9341_convert(src, src_bpp, dst, pixels) Convert image pixels (src_bpp 2: RGB565, 3: RGB666) to the display format. */
+void ILI9341_convert(const uint8_t* src, uint8_t src_bpp, void* dst, uint16_t pixels);
+/* @brief ILI9341_pixel(color, pixel) The color in the display format (ILI9341_BytesPerPixel() bytes). */
+void ILI9341_pixel(const t_color color, uint8_t* pixel);
+/* @brief ILI9341_span(dst, pixel, count) The display format pixel count times. */
+void ILI9341_span(void* dst, const uint8_t* pixel, uint16_t count);
+
+/*
+ * Pixel streaming stage. Any pixel source (bitmaps, decoders, text, gradients) can fill a window buffer
+ * by buffer. With DMA the two buffers ping-pong: the source makes the next one, while the DMA sends
+ * the previous one.
+ */
+
+/* @brief Timeout of a whole pixel stream in milliseconds. */
+#define ILI9341_STREAM_TIMEOUT	5000
+
+/*
+ * @brief Size of the two stage buffers in bytes, 8 RGB565 lines (the band renderer draws the bands into them). The two
+ * buffers take 7680 bytes of RAM, 6240 bytes more than two SCR_BUFFER_SIZE buffers. The band renderer, the text lines,
+ * the display list blits, the images, and the readback chunks are sized from it.
+ */
+#define ILI9341_STREAM_BUFFER_SIZE	(ILI9341_WIDTH * 8 * 2)
+
+/* @brief Pixel source of ILI9341_stream(). Put the next pixels pixels (max. the chunk size) to the buffer
+ * in the display pixel format, row by row. It runs in the thread, it must not use the display.
+ * @retval 0 on error, it stops the stream. */
+typedef uint8_t (*ili9341_pixel_source)(void* buffer, uint16_t pixels, void* arg);
+
+/* @brief ILI9341_stream_buffer(slot) The stage buffer of the slot (0 .. SPI_PIPE_SLOTS - 1), for the decoders, which
+ * queue their own transfers. Free while no stream runs. */
+void* ILI9341_stream_buffer(uint8_t slot);
+
+/* @brief ILI9341_stream(x, y, width, height, source, arg) Fill the window with the pixels of the source,
+ * SCR_BUFFER_IN_PIXELS pixels per buffer. */
+HAL_StatusTypeDef ILI9341_stream(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ili9341_pixel_source source, void* arg);
+
+/* @brief ILI9341_stream_chunks(x, y, width, height, chunk, source, arg) The same with chunk pixels per buffer
+ * (chunk * ILI9341_BytesPerPixel() max. ILI9341_STREAM_BUFFER_SIZE bytes). */
+HAL_StatusTypeDef ILI9341_stream_chunks(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t chunk,
+		ili9341_pixel_source source, void* arg);
+
+/*
+ * Screen readback. The window is read in one RAMRD on the read clock, chunk by chunk through the stage buffers.
+ * With DMA the bus reads the next chunk, while the CPU converts the previous one to RGB565, and gives it to the sink.
+ */
+
+/* @brief Pixels per chunk of ILI9341_readback(), a stage buffer of the 3 byte read format. */
+#define ILI9341_READBACK_CHUNK	(ILI9341_STREAM_BUFFER_SIZE / ILI9341_MAX_BYTES_PER_PIXEL)
+
+/* @brief Pixel sink of ILI9341_readback(). Takes the next pixels (max. the chunk size) of the window in RGB565,
+ * row by row. It may change the buffer. It runs in the thread, it must not use the display.
+ * @retval 0 on error, it stops the read. */
+typedef uint8_t (*ili9341_pixel_sink)(t_color565* pixels, uint16_t count, void* arg);
+
+/* @brief ILI9341_readback(x, y, width, height, sink, arg) Read the window to the sink, ILI9341_READBACK_CHUNK
+ * pixels per chunk. */
+HAL_StatusTypeDef ILI9341_readback(uint16_t x, uint16_t y, uint16_t width, uint16_t height, ili9341_pixel_sink sink, void* arg);
+
+/* @brief ILI9341_readback_chunks(x, y, width, height, chunk, sink, arg) The same with chunk pixels per buffer
+ * (max. ILI9341_READBACK_CHUNK). */
+HAL_StatusTypeDef ILI9341_readback_chunks(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t chunk,
+		ili9341_pixel_sink sink, void* arg);
+
+#if defined (ILI9341_DMA)
+/* Queued (non-blocking) pixel writes. The RAMWR command must be sent before. */
+void ILI9341_buf_to_disp_async(s_spi_xfer* xfer, void* pixelptr, uint16_t size, spi_xfer_callback callback, void* arg);
+HAL_StatusTypeDef ILI9341_wait();
+
+/*
+ * Display DMA program. The column address set, page address set, and memory write commands,
+ * their parameters, and the pixel data are one chain of DMA descriptors. The DMA interrupt
+ * walks the chain, and toggles the DC line between the steps, the CS is active until the end.
+ */
+
+/* Steps: CASET, its parameters, PASET, its parameters, RAMWR, pixel data. */
+#define ILI9341_PROG_STEPS	6
+
+typedef struct {
+	s_spi_xfer step[ILI9341_PROG_STEPS];
+	uint8_t caddr[4];		// CASET parameters: start column, end column.
+	uint8_t paddr[4];		// PASET parameters: start page, end page.
+} s_ili9341_prog;
+
+/*
+ * @brief ILI9341_prog_window(prog, x1, y1, x2, y2, pixels, size, callback, arg) Build the program
+ * of the window set, and the pixel write. pixels, size the pixel data (max. SPI_DMA_MAX_SIZE bytes,
+ * 0: only the window set, and the RAMWR). The callback comes at the end of the program.
+ */
+void ILI9341_prog_window(s_ili9341_prog* prog, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+		const void* pixels, uint16_t size, spi_xfer_callback callback, void* arg);
+
+/* @brief ILI9341_prog_submit(prog) Queue the program on the display bus, and return. The program
+ * must be valid until its callback. The CASET, PASET steps of the ranges equal to the cached window
+ * are skipped. The cache takes the window at the submit: after an aborted program call
+ * ILI9341_window_invalidate(). */
+void ILI9341_prog_submit(s_ili9341_prog* prog);
+#endif
 //HAL_StatusTypeDef ILI9341_getrectangle(uint16_t x, uint16_t y, uint16_t widthi, uint16_t heighti, uint8_t* image);
 
 #endif /* ILI9341_SPI_ILI9341_SPI_H_ */
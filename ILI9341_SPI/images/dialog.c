@@ -0,0 +1,282 @@
+/* Generated by mkimage.py from dialog.ppm, do not edit. */
+
+#include <stdint.h>
+#include "ili9341_image.h"
+
+/* 4255 bytes, the raw RGB565 pixels are 32000 bytes. */
+static const uint8_t dialog_data[4255] = {
+	0xC2, 0x87, 0x47, 0x21, 0xC0, 0x8F, 0x4E, 0x63, 0x8D, 0x47, 0x21, 0x01, 0x4E, 0x63, 0x4E, 0x63,
+	0xC0, 0x8F, 0xFC, 0xDE, 0x01, 0x4E, 0x63, 0x4E, 0x63, 0x8A, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0,
+	0x93, 0x18, 0x23, 0x00, 0x4E, 0x63, 0x89, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x85, 0x18, 0x23, 0x87,
+	0xFF, 0xFF, 0x8F, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x59, 0x18, 0x23, 0x00, 0x4E,
+	0x63, 0x88, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x85, 0x18, 0x23, 0x87, 0xFF, 0xFF, 0x8F,
+	0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B,
+	0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x59, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x97, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xC0, 0x67, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC,
+	0xDE, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x67, 0x18, 0x23, 0x01, 0xFC, 0xDE,
+	0x4E, 0x63, 0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x85, 0x18,
+	0x23, 0x85, 0xFF, 0xFF, 0x87, 0x18, 0x23, 0x83, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x03, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x18, 0x23, 0x18, 0x23, 0x83, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x87, 0xFF, 0xFF, 0x83,
+	0x18, 0x23, 0x85, 0xFF, 0xFF, 0xB3, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21,
+	0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x18, 0x23,
+	0x85, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x87,
+	0x18, 0x23, 0x83, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18,
+	0x23, 0x83, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x87, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x85, 0xFF, 0xFF,
+	0xB3, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE,
+	0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18,
+	0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18,
+	0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18,
+	0x23, 0x83, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18, 0x23,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18, 0x23,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x01,
+	0x4E, 0x63, 0xFC, 0xDE, 0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x85, 0x18, 0x23, 0x83, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x18, 0x23, 0x18, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x18, 0x23, 0x18, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xB9, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x8B, 0x18, 0x23, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x18, 0x23, 0x18, 0x23, 0x89, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89,
+	0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85,
+	0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x18,
+	0x23, 0x18, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83,
+	0x18, 0x23, 0x85, 0xFF, 0xFF, 0xB3, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21,
+	0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x8B, 0x18, 0x23, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18,
+	0x23, 0x89, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18, 0x23,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x85,
+	0xFF, 0xFF, 0xB3, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x01, 0x4E, 0x63,
+	0xFC, 0xDE, 0x8B, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18, 0x23, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x87, 0xFF, 0xFF,
+	0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x8B, 0x18, 0x23, 0x05, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x18, 0x23, 0x18, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x83, 0x18, 0x23, 0x87, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x18,
+	0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x83, 0x18,
+	0x23, 0x87, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x87, 0x18, 0x23, 0x83, 0xFF, 0xFF,
+	0x87, 0x18, 0x23, 0x83, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x03,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x23, 0x18, 0x23, 0x87, 0xFF, 0xFF, 0xB3, 0x18, 0x23, 0x01, 0xFC,
+	0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0x83, 0x18, 0x23, 0x87, 0xFF,
+	0xFF, 0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x87, 0x18, 0x23, 0x83, 0xFF, 0xFF, 0x87, 0x18, 0x23,
+	0x83, 0xFF, 0xFF, 0x85, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0x83, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x85, 0x18, 0x23, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x18, 0x23, 0x03, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x18, 0x23, 0x18, 0x23, 0x87, 0xFF, 0xFF, 0xB3, 0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x01, 0x4E, 0x63, 0xFC, 0xDE, 0xC0, 0x4D, 0x18, 0x23, 0x85, 0xFF, 0xFF, 0xBF,
+	0x18, 0x23, 0x01, 0xFC, 0xDE, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x4E, 0xFC,
+	0xDE, 0x85, 0xFF, 0xFF, 0xC0, 0x40, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E,
+	0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00,
+	0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87,
+	0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00,
+	0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x1E, 0x44, 0x1D, 0x4C, 0x1D, 0x54, 0x1C, 0x5C, 0x1C, 0x64,
+	0x1B, 0x6C, 0x1B, 0x74, 0x1A, 0x7C, 0x1A, 0x84, 0x19, 0x8C, 0x19, 0x94, 0x18, 0x9C, 0x18, 0xA4,
+	0x17, 0xAC, 0x17, 0xB4, 0x16, 0xBC, 0xC0, 0x7E, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21,
+	0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x3D, 0x44, 0x3D, 0x4C, 0x3C, 0x54, 0x3C, 0x5C, 0x3B,
+	0x64, 0x3B, 0x6C, 0x3A, 0x74, 0x3A, 0x7C, 0x39, 0x84, 0x39, 0x8C, 0x38, 0x94, 0x38, 0x9C, 0x37,
+	0xA4, 0x37, 0xAC, 0x36, 0xB4, 0x36, 0xBC, 0xC0, 0x7E, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47,
+	0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x5D, 0x44, 0x5C, 0x4C, 0x5C, 0x54, 0x5B, 0x5C,
+	0x5B, 0x64, 0x5A, 0x6C, 0x5A, 0x74, 0x59, 0x7C, 0x59, 0x84, 0x58, 0x8C, 0x58, 0x94, 0x57, 0x9C,
+	0x57, 0xA4, 0x56, 0xAC, 0x56, 0xB4, 0x55, 0xBC, 0x85, 0xFC, 0xDE, 0x83, 0x05, 0x21, 0x89, 0xFC,
+	0xDE, 0x00, 0x05, 0x21, 0x88, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x85, 0xFC, 0xDE, 0x00, 0x05, 0x21,
+	0xC0, 0x58, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE,
+	0x0F, 0x7C, 0x44, 0x7C, 0x4C, 0x7B, 0x54, 0x7B, 0x5C, 0x7A, 0x64, 0x7A, 0x6C, 0x79, 0x74, 0x79,
+	0x7C, 0x78, 0x84, 0x78, 0x8C, 0x77, 0x94, 0x77, 0x9C, 0x76, 0xA4, 0x76, 0xAC, 0x75, 0xB4, 0x75,
+	0xBC, 0x85, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x92, 0xFC, 0xDE,
+	0x00, 0x05, 0x21, 0x85, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0xC0, 0x58, 0xFC, 0xDE, 0x00, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x9C, 0x44, 0x9B, 0x4C, 0x9B, 0x54,
+	0x9A, 0x5C, 0x9A, 0x64, 0x99, 0x6C, 0x99, 0x74, 0x98, 0x7C, 0x98, 0x84, 0x97, 0x8C, 0x97, 0x94,
+	0x96, 0x9C, 0x96, 0xA4, 0x95, 0xAC, 0x95, 0xB4, 0x94, 0xBC, 0x85, 0xFC, 0xDE, 0x00, 0x05, 0x21,
+	0x82, 0xFC, 0xDE, 0x05, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21,
+	0x82, 0xFC, 0xDE, 0x01, 0x05, 0x21, 0x05, 0x21, 0x83, 0xFC, 0xDE, 0x83, 0x05, 0x21, 0x06, 0xFC,
+	0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x82, 0x05, 0x21,
+	0x82, 0xFC, 0xDE, 0x03, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x82,
+	0x05, 0x21, 0x82, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0xBE, 0xFC,
+	0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0xBB, 0x44,
+	0xBB, 0x4C, 0xBA, 0x54, 0xBA, 0x5C, 0xB9, 0x64, 0xB9, 0x6C, 0xB8, 0x74, 0xB8, 0x7C, 0xB7, 0x84,
+	0xB7, 0x8C, 0xB6, 0x94, 0xB6, 0x9C, 0xB5, 0xA4, 0xB5, 0xAC, 0xB4, 0xB4, 0xB4, 0xBC, 0x85, 0xFC,
+	0xDE, 0x83, 0x05, 0x21, 0x06, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21, 0xFC, 0xDE, 0xFC,
+	0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82,
+	0xFC, 0xDE, 0x09, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05,
+	0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x83, 0xFC, 0xDE, 0x06, 0x05, 0x21, 0x05, 0x21, 0xFC,
+	0xDE, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC,
+	0xDE, 0x05, 0x21, 0x84, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0xC0, 0x41, 0xFC, 0xDE, 0x00, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0xDB, 0x44, 0xDA, 0x4C, 0xDA, 0x54,
+	0xD9, 0x5C, 0xD9, 0x64, 0xD8, 0x6C, 0xD8, 0x74, 0xD7, 0x7C, 0xD7, 0x84, 0xD6, 0x8C, 0xD6, 0x94,
+	0xD5, 0x9C, 0xD5, 0xA4, 0xD4, 0xAC, 0xD4, 0xB4, 0xD3, 0xBC, 0x85, 0xFC, 0xDE, 0x00, 0x05, 0x21,
+	0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x86, 0xFC, 0xDE, 0x00, 0x05, 0x21,
+	0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21,
+	0x82, 0xFC, 0xDE, 0x03, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x83, 0xFC, 0xDE, 0x00,
+	0x05, 0x21, 0x82, 0xFC, 0xDE, 0x01, 0x05, 0x21, 0xFC, 0xDE, 0x84, 0x05, 0x21, 0x01, 0xFC, 0xDE,
+	0xFC, 0xDE, 0x82, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0xBE, 0xFC, 0xDE, 0x00, 0x4E,
+	0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0xFA, 0x44, 0xFA, 0x4C, 0xF9,
+	0x54, 0xF9, 0x5C, 0xF8, 0x64, 0xF8, 0x6C, 0xF7, 0x74, 0xF7, 0x7C, 0xF6, 0x84, 0xF6, 0x8C, 0xF5,
+	0x94, 0xF5, 0x9C, 0xF4, 0xA4, 0xF4, 0xAC, 0xF3, 0xB4, 0xF3, 0xBC, 0x85, 0xFC, 0xDE, 0x00, 0x05,
+	0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x86, 0xFC, 0xDE, 0x00, 0x05,
+	0x21, 0x83, 0xFC, 0xDE, 0x83, 0x05, 0x21, 0x01, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x08,
+	0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE,
+	0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x88, 0xFC, 0xDE, 0x00,
+	0x05, 0x21, 0x84, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0xBD, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47,
+	0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x1A, 0x45, 0x19, 0x4D, 0x19, 0x55, 0x18, 0x5D,
+	0x18, 0x65, 0x17, 0x6D, 0x17, 0x75, 0x16, 0x7D, 0x16, 0x85, 0x15, 0x8D, 0x15, 0x95, 0x14, 0x9D,
+	0x14, 0xA5, 0x13, 0xAD, 0x13, 0xB5, 0x12, 0xBD, 0x85, 0xFC, 0xDE, 0x83, 0x05, 0x21, 0x02, 0xFC,
+	0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x85, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0x85, 0xFC, 0xDE, 0x02, 0x05,
+	0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x04, 0x05,
+	0x21, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC,
+	0xDE, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0x01, 0xFC, 0xDE, 0xFC, 0xDE, 0x83, 0x05, 0x21, 0x01, 0xFC,
+	0xDE, 0xFC, 0xDE, 0x83, 0x05, 0x21, 0xBE, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00,
+	0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x39, 0x45, 0x39, 0x4D, 0x38, 0x55, 0x38, 0x5D, 0x37, 0x65,
+	0x37, 0x6D, 0x36, 0x75, 0x36, 0x7D, 0x35, 0x85, 0x35, 0x8D, 0x34, 0x95, 0x34, 0x9D, 0x33, 0xA5,
+	0x33, 0xAD, 0x32, 0xB5, 0x32, 0xBD, 0x98, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0xC0, 0x62, 0xFC, 0xDE,
+	0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x59, 0x45, 0x58,
+	0x4D, 0x58, 0x55, 0x57, 0x5D, 0x57, 0x65, 0x56, 0x6D, 0x56, 0x75, 0x55, 0x7D, 0x55, 0x85, 0x54,
+	0x8D, 0x54, 0x95, 0x53, 0x9D, 0x53, 0xA5, 0x52, 0xAD, 0x52, 0xB5, 0x51, 0xBD, 0xC0, 0x7E, 0xFC,
+	0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x78, 0x45,
+	0x78, 0x4D, 0x77, 0x55, 0x77, 0x5D, 0x76, 0x65, 0x76, 0x6D, 0x75, 0x75, 0x75, 0x7D, 0x74, 0x85,
+	0x74, 0x8D, 0x73, 0x95, 0x73, 0x9D, 0x72, 0xA5, 0x72, 0xAD, 0x71, 0xB5, 0x71, 0xBD, 0xC0, 0x49,
+	0xFC, 0xDE, 0x85, 0x12, 0x22, 0xAE, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E,
+	0x63, 0x86, 0xFC, 0xDE, 0x0F, 0x98, 0x45, 0x97, 0x4D, 0x97, 0x55, 0x96, 0x5D, 0x96, 0x65, 0x95,
+	0x6D, 0x95, 0x75, 0x94, 0x7D, 0x94, 0x85, 0x93, 0x8D, 0x93, 0x95, 0x92, 0x9D, 0x92, 0xA5, 0x91,
+	0xAD, 0x91, 0xB5, 0x90, 0xBD, 0xC0, 0x48, 0xFC, 0xDE, 0x87, 0x12, 0x22, 0xAD, 0xFC, 0xDE, 0x00,
+	0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F, 0xB7, 0x45, 0xB7, 0x4D,
+	0xB6, 0x55, 0xB6, 0x5D, 0xB5, 0x65, 0xB5, 0x6D, 0xB4, 0x75, 0xB4, 0x7D, 0xB3, 0x85, 0xB3, 0x8D,
+	0xB2, 0x95, 0xB2, 0x9D, 0xB1, 0xA5, 0xB1, 0xAD, 0xB0, 0xB5, 0xB0, 0xBD, 0xC0, 0x47, 0xFC, 0xDE,
+	0x89, 0x12, 0x22, 0xAC, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86,
+	0xFC, 0xDE, 0x0F, 0xD7, 0x45, 0xD6, 0x4D, 0xD6, 0x55, 0xD5, 0x5D, 0xD5, 0x65, 0xD4, 0x6D, 0xD4,
+	0x75, 0xD3, 0x7D, 0xD3, 0x85, 0xD2, 0x8D, 0xD2, 0x95, 0xD1, 0x9D, 0xD1, 0xA5, 0xD0, 0xAD, 0xD0,
+	0xB5, 0xCF, 0xBD, 0x85, 0xFC, 0xDE, 0xC0, 0x41, 0x18, 0x23, 0x89, 0x12, 0x22, 0xA1, 0x56, 0xA5,
+	0x8A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x86, 0xFC, 0xDE, 0x0F,
+	0xF6, 0x45, 0xF6, 0x4D, 0xF5, 0x55, 0xF5, 0x5D, 0xF4, 0x65, 0xF4, 0x6D, 0xF3, 0x75, 0xF3, 0x7D,
+	0xF2, 0x85, 0xF2, 0x8D, 0xF1, 0x95, 0xF1, 0x9D, 0xF0, 0xA5, 0xF0, 0xAD, 0xEF, 0xB5, 0xEF, 0xBD,
+	0x85, 0xFC, 0xDE, 0xC0, 0x41, 0x18, 0x23, 0x89, 0x12, 0x22, 0xA1, 0x56, 0xA5, 0x8A, 0xFC, 0xDE,
+	0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0xC0, 0x41, 0x18, 0x23,
+	0x89, 0x12, 0x22, 0xA1, 0x56, 0xA5, 0x8A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00,
+	0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0xC0, 0x41, 0x18, 0x23, 0x89, 0x12, 0x22, 0xA1, 0x56, 0xA5, 0x8A,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x5E, 0xFC, 0xDE, 0x89,
+	0x12, 0x22, 0xAC, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x5F,
+	0xFC, 0xDE, 0x87, 0x12, 0x22, 0xAD, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E,
+	0x63, 0xC0, 0x60, 0xFC, 0xDE, 0x85, 0x12, 0x22, 0xAE, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47,
+	0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E,
+	0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0x00, 0x05,
+	0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x87, 0xFC, 0xDE, 0x01, 0x05, 0x21, 0x05, 0x21, 0xC0,
+	0x69, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0x00,
+	0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x88, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0xC0, 0x69,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0x00, 0x05,
+	0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0x83, 0xFC,
+	0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x05, 0x05, 0x21,
+	0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x82, 0x05, 0x21,
+	0xC0, 0x56, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE,
+	0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE,
+	0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82,
+	0xFC, 0xDE, 0x08, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05,
+	0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0xC0, 0x55, 0xFC, 0xDE, 0x00,
+	0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC,
+	0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC,
+	0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x07, 0x05, 0x21,
+	0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0x84, 0x05,
+	0x21, 0xC0, 0x55, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9D, 0xFC,
+	0xDE, 0x05, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC,
+	0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x06, 0x05, 0x21,
+	0xFC, 0xDE, 0xFC, 0xDE, 0x05, 0x21, 0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02,
+	0x05, 0x21, 0xFC, 0xDE, 0x05, 0x21, 0xC0, 0x59, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21,
+	0x00, 0x4E, 0x63, 0x9E, 0xFC, 0xDE, 0x00, 0x05, 0x21, 0x83, 0xFC, 0xDE, 0x82, 0x05, 0x21, 0x82,
+	0xFC, 0xDE, 0x82, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x05, 0x05, 0x21, 0x05, 0x21, 0xFC, 0xDE, 0x05,
+	0x21, 0xFC, 0xDE, 0x05, 0x21, 0x82, 0xFC, 0xDE, 0x02, 0x05, 0x21, 0xFC, 0xDE, 0xFC, 0xDE, 0x82,
+	0x05, 0x21, 0xC0, 0x56, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0,
+	0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE,
+	0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x42, 0xFC, 0xDE, 0x85, 0x12, 0x22,
+	0xC0, 0x4C, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x41, 0xFC,
+	0xDE, 0x87, 0x12, 0x22, 0xC0, 0x4B, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E,
+	0x63, 0xC0, 0x40, 0xFC, 0xDE, 0x89, 0x12, 0x22, 0xC0, 0x4A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87,
+	0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0xA3, 0x18, 0x23, 0x89, 0x12, 0x22, 0xBF, 0x56,
+	0xA5, 0x8A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE,
+	0xA3, 0x18, 0x23, 0x89, 0x12, 0x22, 0xBF, 0x56, 0xA5, 0x8A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87,
+	0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE, 0xA3, 0x18, 0x23, 0x89, 0x12, 0x22, 0xBF, 0x56,
+	0xA5, 0x8A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9C, 0xFC, 0xDE,
+	0xA3, 0x18, 0x23, 0x89, 0x12, 0x22, 0xBF, 0x56, 0xA5, 0x8A, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87,
+	0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x40, 0xFC, 0xDE, 0x89, 0x12, 0x22, 0xC0, 0x4A, 0xFC, 0xDE,
+	0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x41, 0xFC, 0xDE, 0x87, 0x12, 0x22,
+	0xC0, 0x4B, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x42, 0xFC,
+	0xDE, 0x85, 0x12, 0x22, 0xC0, 0x4C, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E,
+	0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00,
+	0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87,
+	0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00,
+	0x4E, 0x63, 0x99, 0xFC, 0xDE, 0xAB, 0x0A, 0x35, 0x8F, 0xFC, 0xDE, 0xAB, 0xB7, 0xB5, 0x93, 0xFC,
+	0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x98, 0xFC, 0xDE, 0xAD, 0x0A, 0x35,
+	0x8D, 0xFC, 0xDE, 0xAD, 0xB7, 0xB5, 0x92, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00,
+	0x4E, 0x63, 0x97, 0xFC, 0xDE, 0xAF, 0x0A, 0x35, 0x8B, 0xFC, 0xDE, 0xAF, 0xB7, 0xB5, 0x91, 0xFC,
+	0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0x92, 0x0A, 0x35,
+	0x82, 0xFF, 0xFF, 0x02, 0x0A, 0x35, 0x0A, 0x35, 0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x00, 0xFF, 0xFF,
+	0x92, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x87, 0xB7, 0xB5, 0x82, 0x05, 0x21, 0x9A,
+	0xB7, 0xB5, 0x01, 0x05, 0x21, 0x05, 0x21, 0x87, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90, 0xFC, 0xDE,
+	0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0x91, 0x0A, 0x35, 0x00,
+	0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x05, 0xFF, 0xFF, 0x0A, 0x35, 0xFF, 0xFF, 0x0A, 0x35, 0x0A, 0x35,
+	0xFF, 0xFF, 0x93, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x86, 0xB7, 0xB5, 0x00, 0x05,
+	0x21, 0x82, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x9A, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x87, 0xB7, 0xB5,
+	0x00, 0x52, 0x84, 0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97,
+	0xFC, 0xDE, 0x91, 0x0A, 0x35, 0x00, 0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x04, 0xFF, 0xFF, 0x0A, 0x35,
+	0xFF, 0xFF, 0x0A, 0x35, 0xFF, 0xFF, 0x94, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x86,
+	0xB7, 0xB5, 0x00, 0x05, 0x21, 0x85, 0xB7, 0xB5, 0x82, 0x05, 0x21, 0x05, 0xB7, 0xB5, 0xB7, 0xB5,
+	0x05, 0x21, 0xB7, 0xB5, 0x05, 0x21, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x82, 0x05, 0x21, 0x82, 0xB7,
+	0xB5, 0x82, 0x05, 0x21, 0x83, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x87, 0xB7, 0xB5, 0x00, 0x52, 0x84,
+	0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0x91,
+	0x0A, 0x35, 0x00, 0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x03, 0xFF, 0xFF, 0x0A, 0x35, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x95, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x86, 0xB7, 0xB5, 0x00, 0x05, 0x21,
+	0x88, 0xB7, 0xB5, 0x08, 0x05, 0x21, 0xB7, 0xB5, 0x05, 0x21, 0x05, 0x21, 0xB7, 0xB5, 0xB7, 0xB5,
+	0x05, 0x21, 0xB7, 0xB5, 0x05, 0x21, 0x84, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x00,
+	0x05, 0x21, 0x82, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x87, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90, 0xFC,
+	0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0x91, 0x0A, 0x35,
+	0x00, 0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x04, 0xFF, 0xFF, 0x0A, 0x35, 0xFF, 0xFF, 0x0A, 0x35, 0xFF,
+	0xFF, 0x94, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x86, 0xB7, 0xB5, 0x00, 0x05, 0x21,
+	0x85, 0xB7, 0xB5, 0x83, 0x05, 0x21, 0x01, 0xB7, 0xB5, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x02, 0x05,
+	0x21, 0xB7, 0xB5, 0x05, 0x21, 0x84, 0xB7, 0xB5, 0x84, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x00, 0x05,
+	0x21, 0x87, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21,
+	0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0x91, 0x0A, 0x35, 0x00, 0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x05,
+	0xFF, 0xFF, 0x0A, 0x35, 0xFF, 0xFF, 0x0A, 0x35, 0x0A, 0x35, 0xFF, 0xFF, 0x93, 0x0A, 0x35, 0x00,
+	0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x86, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x02, 0x05,
+	0x21, 0xB7, 0xB5, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x02, 0x05, 0x21, 0xB7, 0xB5, 0x05, 0x21, 0x82,
+	0xB7, 0xB5, 0x02, 0x05, 0x21, 0xB7, 0xB5, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x02, 0x05, 0x21, 0xB7,
+	0xB5, 0x05, 0x21, 0x86, 0xB7, 0xB5, 0x00, 0x05, 0x21, 0x87, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0x92, 0x0A,
+	0x35, 0x82, 0xFF, 0xFF, 0x02, 0x0A, 0x35, 0x0A, 0x35, 0xFF, 0xFF, 0x82, 0x0A, 0x35, 0x00, 0xFF,
+	0xFF, 0x92, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE, 0x87, 0xB7, 0xB5, 0x82, 0x05, 0x21,
+	0x82, 0xB7, 0xB5, 0x83, 0x05, 0x21, 0x01, 0xB7, 0xB5, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x02, 0x05,
+	0x21, 0xB7, 0xB5, 0xB7, 0xB5, 0x82, 0x05, 0x21, 0x82, 0xB7, 0xB5, 0x82, 0x05, 0x21, 0x82, 0xB7,
+	0xB5, 0x82, 0x05, 0x21, 0x86, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0xAF, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A,
+	0xFC, 0xDE, 0xAF, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47,
+	0x21, 0x00, 0x4E, 0x63, 0x97, 0xFC, 0xDE, 0xAF, 0x0A, 0x35, 0x00, 0x52, 0x84, 0x8A, 0xFC, 0xDE,
+	0xAF, 0xB7, 0xB5, 0x00, 0x52, 0x84, 0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00,
+	0x4E, 0x63, 0x98, 0xFC, 0xDE, 0xAD, 0x0A, 0x35, 0x01, 0x52, 0x84, 0x52, 0x84, 0x8B, 0xFC, 0xDE,
+	0xAD, 0xB7, 0xB5, 0x01, 0x52, 0x84, 0x52, 0x84, 0x90, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47,
+	0x21, 0x00, 0x4E, 0x63, 0x99, 0xFC, 0xDE, 0xAB, 0x0A, 0x35, 0x01, 0x52, 0x84, 0x52, 0x84, 0x8D,
+	0xFC, 0xDE, 0xAB, 0xB7, 0xB5, 0x01, 0x52, 0x84, 0x52, 0x84, 0x91, 0xFC, 0xDE, 0x00, 0x4E, 0x63,
+	0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0x9A, 0xFC, 0xDE, 0xAB, 0x52, 0x84, 0x8F, 0xFC, 0xDE, 0xAB,
+	0x52, 0x84, 0x92, 0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x87, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x95,
+	0xFC, 0xDE, 0x00, 0x4E, 0x63, 0x88, 0x47, 0x21, 0x00, 0x4E, 0x63, 0xC0, 0x93, 0xFC, 0xDE, 0x00,
+	0x4E, 0x63, 0x89, 0x47, 0x21, 0x01, 0x4E, 0x63, 0x4E, 0x63, 0xC0, 0x91, 0xFC, 0xDE, 0x01, 0x4E,
+	0x63, 0x4E, 0x63, 0x8A, 0x47, 0x21, 0x01, 0x4E, 0x63, 0x4E, 0x63, 0xC0, 0x8F, 0xFC, 0xDE, 0x01,
+	0x4E, 0x63, 0x4E, 0x63, 0x8D, 0x47, 0x21, 0xC0, 0x8F, 0x4E, 0x63, 0xC2, 0x87, 0x47, 0x21,
+};
+
+const s_ili9341_image dialog = {
+	.width = 160,
+	.height = 100,
+	.format = ILI9341_IMAGE_RLE565,
+	.size = 4255,
+	.data = dialog_data
+};
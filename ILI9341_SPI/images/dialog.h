@@ -0,0 +1,10 @@
+/* Generated by mkimage.py from dialog.ppm, do not edit. */
+
+#ifndef ILI9341_SPI_IMAGES_DIALOG_H_
+#define ILI9341_SPI_IMAGES_DIALOG_H_
+
+#include "ili9341_image.h"
+
+extern const s_ili9341_image dialog;
+
+#endif /* ILI9341_SPI_IMAGES_DIALOG_H_ */
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""
+Image table generator of the ILI9341 image blits (ili9341_image.h).
+
+Reads a binary PPM (P6) image, and writes <name>.c, <name>.h: the pixels in RGB565, plain, or run
+length encoded, or the palette indexes, and the palette, as const tables in the flash, and the
+s_ili9341_image of them.
+
+  mkimage.py dialog.ppm dialog --rle
+  mkimage.py icons.ppm icons --indexed 4
+
+The indexed images take the colors of the image as the palette (most used first), the image must
+not have more colors than the indexes address. The indexes are MSB first, the rows are padded to
+whole bytes.
+
+The run length encoding is a list of tokens in the raster order (the runs go on over the row ends):
+  0x00 .. 0x7F    literal: the next 1 .. 128 pixels follow, 2 bytes each.
+  0x80 .. 0xBF    short run: 1 .. 64 times the next pixel.
+  0xC0 .. 0xFF n  long run: ((token & 0x3F) << 8 | n) + 1 times the next pixel (max. 16384).
+The pixels are little endian RGB565 (the s_image byte order).
+"""
+
+import argparse
+import os
+
+MIN_RUN = 3          # A shorter run costs more than the literal pixels (with the token of the next literal).
+MAX_RUN = 16384
+MAX_LITERAL = 128
+
+
+def parse_ppm(path):
+    """The width, height, and the (r, g, b) pixels of a P6 file, row by row."""
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise SystemExit("%s: only 8 bit P6 images" % path)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[pos + 1:pos + 1 + width * height * 3]
+    return width, height, [tuple(pixels[i:i + 3]) for i in range(0, len(pixels), 3)]
+
+
+def rgb565(p):
+    r, g, b = p
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def rle(pixels):
+    """The tokens of the RGB565 pixels."""
+    out, literal, i = [], [], 0
+
+    def flush():
+        if literal:
+            out.append(len(literal) - 1)
+            for p in literal:
+                out.extend((p & 0xFF, p >> 8))
+            del literal[:]
+
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < MAX_RUN:
+            j += 1
+        if j - i >= MIN_RUN:
+            flush()
+            n = j - i - 1
+            out.extend((0x80 | n,) if n < 64 else (0xC0 | (n >> 8), n & 0xFF))
+            out.extend((pixels[i] & 0xFF, pixels[i] >> 8))
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+            if len(literal) == MAX_LITERAL:
+                flush()
+    flush()
+    return out
+
+
+def unrle(data):
+    pixels, i = [], 0
+    while i < len(data):
+        t = data[i]
+        if t < 0x80:
+            pixels += [data[i + 1 + k * 2] | data[i + 2 + k * 2] << 8 for k in range(t + 1)]
+            i += 1 + (t + 1) * 2
+        else:
+            n = (t & 0x3F) + 1 if t < 0xC0 else (((t & 0x3F) << 8) | data[i + 1]) + 1
+            i += 1 if t < 0xC0 else 2
+            pixels += [data[i] | data[i + 1] << 8] * n
+            i += 2
+    return pixels
+
+
+def indexed(width, rgb, bpp):
+    """The palette (most used first), and the packed indexes of the pixels."""
+    counts = {}
+    for p in rgb:
+        counts[p] = counts.get(p, 0) + 1
+    palette = sorted(counts, key=lambda p: -counts[p])
+    if len(palette) > 1 << bpp:
+        raise SystemExit("%d colors do not fit to %d bpp" % (len(palette), bpp))
+    index = {p: i for i, p in enumerate(palette)}
+    data = []
+    for y in range(len(rgb) // width):
+        acc = nbits = 0
+        for p in rgb[y * width:(y + 1) * width]:
+            acc = (acc << bpp) | index[p]
+            nbits += bpp
+            if nbits == 8:
+                data.append(acc)
+                acc = nbits = 0
+        if nbits:
+            data.append(acc << (8 - nbits))
+    return palette, data
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[1], formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("ppm")
+    ap.add_argument("name")
+    ap.add_argument("--rle", action="store_true")
+    ap.add_argument("--indexed", type=int, choices=(1, 2, 4, 8), help="bits of the palette indexes")
+    args = ap.parse_args()
+
+    width, height, rgb = parse_ppm(args.ppm)
+    pixels = [rgb565(p) for p in rgb]
+    palette = None
+    if args.indexed:
+        palette, data = indexed(width, rgb, args.indexed)
+        image_format = "ILI9341_IMAGE_INDEXED%d" % args.indexed
+    elif args.rle:
+        data = rle(pixels)
+        assert unrle(data) == pixels
+        image_format = "ILI9341_IMAGE_RLE565"
+    else:
+        data = [b for p in pixels for b in (p & 0xFF, p >> 8)]
+        image_format = "ILI9341_IMAGE_RGB565"
+
+    name, base = args.name, os.path.basename(args.name)
+    source = os.path.basename(args.ppm)
+    with open(name + ".h", "w") as f:
+        guard = "ILI9341_SPI_IMAGES_%s_H_" % base.upper()
+        f.write("/* Generated by mkimage.py from %s, do not edit. */\n\n" % source)
+        f.write("#ifndef %s\n#define %s\n\n#include \"ili9341_image.h\"\n\n" % (guard, guard))
+        f.write("extern const s_ili9341_image %s;\n\n#endif /* %s */\n" % (base, guard))
+    with open(name + ".c", "w") as f:
+        f.write("/* Generated by mkimage.py from %s, do not edit. */\n\n" % source)
+        f.write("#include <stdint.h>\n#include \"ili9341_image.h\"\n\n")
+        size = len(data) + (len(palette) * 3 if palette else 0)
+        f.write("/* %d bytes, the raw RGB565 pixels are %d bytes. */\n" % (size, len(pixels) * 2))
+        f.write("static const uint8_t %s_data[%d] = {\n" % (base, len(data)))
+        for i in range(0, len(data), 16):
+            f.write("\t" + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        if palette:
+            f.write("static const t_color %s_palette[%d] = {\n" % (base, len(palette)))
+            for i in range(0, len(palette), 4):
+                f.write("\t" + ", ".join("{0x%02X, 0x%02X, 0x%02X}" % p for p in palette[i:i + 4]) + ",\n")
+            f.write("};\n\n")
+        f.write("const s_ili9341_image %s = {\n" % base)
+        f.write("\t.width = %d,\n\t.height = %d,\n" % (width, height))
+        f.write("\t.format = %s,\n" % image_format)
+        f.write("\t.size = %d,\n\t.data = %s_data" % (len(data), base))
+        if palette:
+            f.write(",\n\t.palette = %s_palette,\n\t.colors = %d" % (base, len(palette)))
+        f.write("\n};\n")
+
+
+if __name__ == "__main__":
+    main()
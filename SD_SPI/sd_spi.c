@@ -18,25 +18,32 @@
 SD_TYPE sd_type = VER_NONE;
 
 /*	
- * @brief SD card SPI handle. SPI2 channel.Load datas for SD card initialize 
+ * @brief SD card SPI bus. SPI2 channel.Load datas for SD card initialize 
  * process.
  */
 
-static SPI_HandleTypeDef 	sd_spi2_handle = 
-{.Instance = SD_SPI_CHANNEL,
-.Init.BaudRatePrescaler  = SPI_BAUDRATEPRESCALER_256,
-.Init.Direction          = SPI_DIRECTION_2LINES,
-.Init.CLKPhase           = SPI_PHASE_1EDGE,
-.Init.CLKPolarity        = SPI_POLARITY_LOW,
-.Init.CRCCalculation     = SPI_CRCCALCULATION_DISABLE,
-.Init.CRCPolynomial      = 7,
-.Init.DataSize           = SPI_DATASIZE_8BIT,
-.Init.FirstBit           = SPI_FIRSTBIT_MSB,
-.Init.NSS                = SPI_NSS_SOFT,
-.Init.TIMode             = SPI_TIMODE_DISABLE,
-.Init.Mode               = SPI_MODE_MASTER
+s_spi_bus 	sd_spi2_bus = 
+{.handle.Instance = SD_SPI_CHANNEL,
+.handle.Init.BaudRatePrescaler  = CONFIG_BAUD_PRESCALER,
+.handle.Init.Direction          = SPI_DIRECTION_2LINES,
+.handle.Init.CLKPhase           = SPI_PHASE_1EDGE,
+.handle.Init.CLKPolarity        = SPI_POLARITY_LOW,
+.handle.Init.CRCCalculation     = SPI_CRCCALCULATION_DISABLE,
+.handle.Init.CRCPolynomial      = 7,
+.handle.Init.DataSize           = SPI_DATASIZE_8BIT,
+.handle.Init.FirstBit           = SPI_FIRSTBIT_MSB,
+.handle.Init.NSS                = SPI_NSS_SOFT,
+.handle.Init.TIMode             = SPI_TIMODE_DISABLE,
+.handle.Init.Mode               = SPI_MODE_MASTER,
+.cs_port = SD_CARD_CS_PORT,
+.cs_pin = SD_CARD_CS_PIN
 };
 
+#if defined (SD_SPI_DMA)
+static DMA_HandleTypeDef hdma_spi2_tx;
+static DMA_HandleTypeDef hdma_spi2_rx;
+#endif
+
 
 /* @brief SD_Card_SPI_Select(): Select SD card SPI communication. To use must 
  * be initialize SPI with <400kHz baud rate.
@@ -49,12 +56,14 @@ After supply voltage reached 2.2 volts, wait for one millisecond at least.
 
 void SD_Card_SPI_Select()
 {	uint16_t counter;
+	/* The card identification runs on the configuration clock. */
+	SPI_SetPrescaler(&sd_spi2_bus, CONFIG_BAUD_PRESCALER);
 	/* deselect chip select line */
 	DESELECT_SD();
 	/* min. 74 clock bits write */
   for (counter = 0; counter <= 9; counter++)
   {
-    SPI_WriteByte(SD_DUMMY_BYTE, sd_spi2_handle, 1000);
+    SPI_WriteByte(&sd_spi2_bus, SD_DUMMY_BYTE, 1000);
   }
 }
 
@@ -102,14 +111,91 @@ void SD_SPI2_Init()
   gpioinitstruct.Speed      = GPIO_SPEED_FREQ_HIGH;
   HAL_GPIO_Init(SPI2_SIGNAL_PORT, &gpioinitstruct);
 
-	SPI_Init(&sd_spi2_handle);
+	SPI_Init(&sd_spi2_bus);
+
+#if defined (SD_SPI_DMA)
+
+	  /*
+	   * TX DMA channel programming, and enable.
+	   */
+	  /* Enable DMA clock */
+	  __HAL_RCC_DMA1_CLK_ENABLE();
+
+	  hdma_spi2_tx.Instance                 	= SD_SPI2_TX_DMA_CHANNEL;
+	  hdma_spi2_tx.Init.Direction           	= DMA_MEMORY_TO_PERIPH;
+	  hdma_spi2_tx.Init.PeriphInc           	= DMA_PINC_DISABLE;
+	  hdma_spi2_tx.Init.MemInc              	= DMA_MINC_ENABLE;
+	  hdma_spi2_tx.Init.PeriphDataAlignment 	= DMA_PDATAALIGN_BYTE;
+	  hdma_spi2_tx.Init.MemDataAlignment    	= DMA_MDATAALIGN_BYTE;
+	  hdma_spi2_tx.Init.Mode                	= DMA_NORMAL;
+	  hdma_spi2_tx.Init.Priority            	= DMA_PRIORITY_MEDIUM;
+
+	  HAL_DMA_Init(&hdma_spi2_tx);
+
+	  __HAL_LINKDMA(&sd_spi2_bus.handle, hdmatx, hdma_spi2_tx);
+
+	  HAL_NVIC_SetPriority(SD_SPI2_DMA_TX_IRQn, 1, 2);
+	  HAL_NVIC_EnableIRQ(SD_SPI2_DMA_TX_IRQn);
+
+	  /*
+	   * RX DMA channel programming, and enable.
+	   */
+
+	  hdma_spi2_rx.Instance                 	= SD_SPI2_RX_DMA_CHANNEL;
+	  hdma_spi2_rx.Init.Direction           	= DMA_PERIPH_TO_MEMORY;
+	  hdma_spi2_rx.Init.PeriphInc           	= DMA_PINC_DISABLE;
+	  hdma_spi2_rx.Init.MemInc              	= DMA_MINC_ENABLE;
+	  hdma_spi2_rx.Init.PeriphDataAlignment 	= DMA_PDATAALIGN_BYTE;
+	  hdma_spi2_rx.Init.MemDataAlignment    	= DMA_MDATAALIGN_BYTE;
+	  hdma_spi2_rx.Init.Mode                	= DMA_NORMAL;
+	  hdma_spi2_rx.Init.Priority            	= DMA_PRIORITY_HIGH;
+
+	  HAL_DMA_Init(&hdma_spi2_rx);
+
+	  __HAL_LINKDMA(&sd_spi2_bus.handle, hdmarx, hdma_spi2_rx);
+
+	  HAL_NVIC_SetPriority(SD_SPI2_DMA_RX_IRQn, 1, 2);
+	  HAL_NVIC_EnableIRQ(SD_SPI2_DMA_RX_IRQn);
 
+#endif
 } 
 
-void SetFastSPI()
-{
-	sd_spi2_handle.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_16;
-	SPI_Init(&sd_spi2_handle);
+/*
+ * TRAN_SPEED: bits 6:3 the time value (x10), bits 2:0 the transfer rate unit (100 kbit/s ... 100 Mbit/s).
+ */
+
+static const uint8_t tran_speed_value[16] = {0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80};
+static const uint32_t tran_speed_unit[4] = {10000, 100000, 1000000, 10000000};
+
+uint32_t SD_TranSpeedHz(uint8_t tran_speed)
+{	uint8_t unit = tran_speed & 0x07;
+	if (unit > 3) unit = 3;
+	return tran_speed_value[(tran_speed >> 3) & 0x0F] * tran_speed_unit[unit];
+}
+
+/*
+ * @brief SD_ClockCheck() Read the CSD at the candidate clock, and compare with the reference.
+ */
+
+static HAL_StatusTypeDef SD_ClockCheck(s_spi_bus* bus, void* arg)
+{	CID_CSD_RESP resp;
+	if (GetCSDRegister(&resp) != SD_SPI_OK) return HAL_ERROR;
+	return memcmp(&resp, arg, sizeof(resp)) ? HAL_ERROR : HAL_OK;
+}
+
+SD_SPI_STATE SetFastSPI()
+{	CID_CSD_RESP csd; uint32_t max_hz, prescaler;
+	if (GetCSDRegister(&csd) != SD_SPI_OK) return SD_ERROR;
+	max_hz = SD_TranSpeedHz(csd.CSD.TRAN_SPEED);
+	if ((max_hz == 0) || (max_hz > SD_SPI_MAX_HZ)) max_hz = SD_SPI_MAX_HZ;
+	if (SPI_ClockNegotiate(&sd_spi2_bus, max_hz, SD_ClockCheck, &csd, &prescaler) != HAL_OK)
+	{
+		SPI_SetPrescaler(&sd_spi2_bus, CONFIG_BAUD_PRESCALER);
+		return SD_ERROR;
+	}
+	/* The card reads, and writes on the same clock. */
+	sd_spi2_bus.write_prescaler = sd_spi2_bus.read_prescaler = prescaler;
+	return SD_SPI_OK;
 }
 
 /*
@@ -129,18 +215,18 @@ void SD_SPI_Timeout_Error()
 
 }
 
-/* SD_SPI_STATE SD_SPI_WaitValidResponse(s_r1* R1, SPI_HandleTypeDef handle, uint32_t TimeOut)
+/* SD_SPI_STATE SD_SPI_WaitValidResponse(s_r1* R1, s_spi_bus* bus, uint32_t TimeOut)
  * @brief Wait for valid response byte, or over time. Valid response byte with
  * most significant bit is 0. Return
  * SD_SPI_OK = startbit OK, SPI OK.
  * SPI_ERROR = */
 
-SD_SPI_STATE SD_SPI_WaitValidResponse(s_r1* R1, SPI_HandleTypeDef handle, uint32_t TimeOut)
+SD_SPI_STATE SD_SPI_WaitValidResponse(s_r1* R1, s_spi_bus* bus, uint32_t TimeOut)
 {
   SELECT_SD();
-  SPI_WriteByte(SD_DUMMY_BYTE, sd_spi2_handle, SD_SPI2_TIMEOUT);
+  SPI_Exchange(bus, SD_DUMMY_BYTE);
   do {
-      SPI_ReadByte((uint8_t*)R1, handle, 1000);
+      R1->b = SPI_Exchange(bus, SD_DUMMY_BYTE);
   } while ((R1->m_0) && (TimeOut--));
   DESELECT_SD();
   /*
@@ -170,14 +256,14 @@ SD_SPI_STATE SD_SPI_WaitValidResponse(s_r1* R1, SPI_HandleTypeDef handle, uint32
   }
 }
 
-/* void SD_SPI_ReadLongResponse(s_args resp, SPI_HandleTypeDef handle, uint32_t TimeOut)
+/* void SD_SPI_ReadLongResponse(s_args* resp, s_spi_bus* bus, uint32_t TimeOut)
  * @brief Read the 32 bits command arguments from SD SPI */
 
 
-void SD_SPI_ReadLongResponse(s_args* resp, SPI_HandleTypeDef handle, uint32_t TimeOut)
+void SD_SPI_ReadLongResponse(s_args* resp, s_spi_bus* bus, uint32_t TimeOut)
 {
   SELECT_SD();
-  SPI_ReadBuf((uint8_t*)resp, sizeof(resp), handle, TimeOut);
+  SPI_ExchangeBuf(bus, NULL, resp->DT, sizeof(*resp));
   DESELECT_SD();
 }
 
@@ -201,8 +287,8 @@ void SendSDCommand(uint16_t index, s_args args)
   if (index == 8) command.CRC_VAL = (0X43);
 #endif
   SELECT_SD();
-  SPI_WriteByte(SD_DUMMY_BYTE, sd_spi2_handle, SD_SPI2_TIMEOUT);
-  SPI_WriteBuf(&command, sizeof(command), sd_spi2_handle, SD_SPI2_TIMEOUT);
+  SPI_Exchange(&sd_spi2_bus, SD_DUMMY_BYTE);
+  SPI_ExchangeBuf(&sd_spi2_bus, command.DTS, NULL, sizeof(command));
   DESELECT_SD();
 }
 
@@ -213,7 +299,7 @@ SD_SPI_STATE ResetCard()
 { s_r1 r1; s_args args;
   args.argw = 0;
   SendSDCommand(GO_IDLE_STATE, args);
-  return SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT);
+  return SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT);
 }
 
 /*  Part_1_Physical_Layer_Simplified_Specification_Ver6.00.pdf 
@@ -254,14 +340,14 @@ SD_SPI_STATE SPIModeInitialize()
 
 	SendSDCommand(SEND_IF_COND, args);
 
-	if (SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
+	if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
 	{
 		/*
 		 * @TODO If the card indicates an illegal command, the card is legacy and does not support CMD8.
 		 * Must be do something !!!!
 		 */
 		if (r1.ill_comm_err) { sd_type = VER1X; break;};
-		SD_SPI_ReadLongResponse(&resp, sd_spi2_handle, SD_SPI2_TIMEOUT);
+		SD_SPI_ReadLongResponse(&resp, &sd_spi2_bus, SD_SPI2_TIMEOUT);
 		if ((resp.chk_pattern == PATT_8BIT)) //
 		{
 			/* If the card supports CMD8 and can operate on the supplied voltage, the response echoes back the supply
@@ -305,11 +391,11 @@ SD_SPI_STATE SPIModeInitialize()
 
 	SendSDCommand(READ_OCR, args);
 
-	if (SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
+	if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
 	{
 		if (r1.b == SD_IN_IDLE)
 		{
-		  SD_SPI_ReadLongResponse(&resp, sd_spi2_handle, SD_SPI2_TIMEOUT);
+		  SD_SPI_ReadLongResponse(&resp, &sd_spi2_bus, SD_SPI2_TIMEOUT);
 		};
 	};
 
@@ -325,7 +411,7 @@ SD_SPI_STATE SPIModeInitialize()
     {
     	/* Flag the next command as an application-specific command */
     	SendSDCommand(APP_CMD, args);
-    	if (SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
+    	if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
     	{
         	/* Tell the card to send its OCR */
     		args.argw = 0;
@@ -334,7 +420,7 @@ SD_SPI_STATE SPIModeInitialize()
     			args.HCS = 1;
     		};
         	SendSDCommand(APP_SEND_OP_COND, args);
-        	if (!(SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK))
+        	if (!(SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK))
         	{
 
         	}
@@ -355,11 +441,11 @@ SD_SPI_STATE SPIModeInitialize()
 
 	SendSDCommand(READ_OCR, args);
 
-	if (SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
+	if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
 	{
 		if (r1.b == SD_IN_DUTY)
 		{
-			SD_SPI_ReadLongResponse(&resp, sd_spi2_handle, SD_SPI2_TIMEOUT);
+			SD_SPI_ReadLongResponse(&resp, &sd_spi2_bus, SD_SPI2_TIMEOUT);
 			if (resp.CCS) sd_type = VER2HCSD;
 	/* Bit 31 - Card power up status bit, this status bit is set if the card power up procedure has been finished.
 	Bit 30 - Card Capacity Status bit, 0 indicates that the card is SDSC. 1 indicates that the card is SDHC or
@@ -385,7 +471,7 @@ SD_SPI_STATE CRCSet(uint8_t ONOFF)
 	args.argw = 0;
 	args.CRCBIT = ONOFF;
 	SendSDCommand(CRC_ON_OFF, args);
-	SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT);
+	SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT);
 	return SD_SPI_OK;
 }
 
@@ -402,21 +488,45 @@ SD_SPI_STATE CRCSet(uint8_t ONOFF)
  */
 
 
-SD_SPI_STATE ReadBlock(void* buffer, int size)
+/*
+ * Data phase paths of ReadBlockPath.
+ */
+
+typedef enum {
+	SD_PAYLOAD_HAL,		// HAL polling (HAL_SPI_Receive).
+	SD_PAYLOAD_BURST,	// Register level burst, for the short register reads.
+	SD_PAYLOAD_DMA		// Full-duplex DMA with constant 0xFF transmit source.
+} e_sd_payload;
+
+static SD_SPI_STATE ReadBlockPath(void* buffer, int size, e_sd_payload path)
 {	s_r1 r1; uint16_t CRCData, CRCVal;
-if (SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
+if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) == SD_SPI_OK)
 {
-	  if (WaitForPattern(PATTERN_SBR, sd_spi2_handle, READ_PATTERN_TIMEOUT) == SD_SPI_OK)
+	  if (WaitForPattern(PATTERN_SBR, &sd_spi2_bus, READ_PATTERN_TIMEOUT) == SD_SPI_OK)
 	  {
 		  SELECT_SD();
-		  SPI_ReadBuf(buffer, size, sd_spi2_handle, SD_SPI2_TIMEOUT);
-		  DESELECT_SD();
+		  switch (path)
+		  {
+#if defined (SD_SPI_DMA)
+		  case SD_PAYLOAD_DMA:
+			  if (SPI_ReadBufDMA(&sd_spi2_bus, buffer, size, SD_SPI2_TIMEOUT) != HAL_OK)
+			  {
+				  DESELECT_SD();
+				  return SD_TIMEOUT;
+			  }
+			  break;
+#endif
+		  case SD_PAYLOAD_BURST:
+			  SPI_ExchangeBuf(&sd_spi2_bus, NULL, buffer, size);
+			  break;
+		  default:
+			  SPI_ReadBuf(&sd_spi2_bus, buffer, size, SD_SPI2_TIMEOUT);
+		  }
 	  } else return SD_ERROR;
 	  /*
 	   * Last two bytes: 16 bit CRC
 	   */
-	  SELECT_SD();
-	  SPI_ReadBuf((uint8_t*)&CRCData, 2, sd_spi2_handle, SD_SPI2_TIMEOUT);
+	  SPI_ExchangeBuf(&sd_spi2_bus, NULL, (uint8_t*)&CRCData, 2);
 	  DESELECT_SD();
 
 #if defined CRC_SD_DATA
@@ -428,16 +538,28 @@ if (SD_SPI_WaitValidResponse(&r1, sd_spi2_handle, SD_RESET_CARD_TIMEOUT) == SD_S
 #endif
 
 	  return SD_SPI_OK;
-//    SPI_ReadBuf(buffer, SDHX_BLOCSIZE, sd_spi2_handle, SD_READ_BLOCK_TIMEOUT);
 } else return SD_ERROR;
 };
 
+/*
+ * ReadBlock(void* buffer, int size) The data blocks go with DMA, the short register
+ * reads (CID, CSD) with the register level burst.
+ */
+
+SD_SPI_STATE ReadBlock(void* buffer, int size)
+{
+#if defined (SD_SPI_DMA)
+	if (size >= SD_DMA_MIN_SIZE) return ReadBlockPath(buffer, size, SD_PAYLOAD_DMA);
+#endif
+	return ReadBlockPath(buffer, size, SD_PAYLOAD_BURST);
+}
+
 SD_SPI_STATE ReadSpecRegs(void* buffer, int size)
 {
-	if (WaitForPattern(PATTERN_SBR, sd_spi2_handle, READ_PATTERN_TIMEOUT) == SD_SPI_OK)
+	if (WaitForPattern(PATTERN_SBR, &sd_spi2_bus, READ_PATTERN_TIMEOUT) == SD_SPI_OK)
 	{
 		SELECT_SD();
-		SPI_ReadBuf((uint8_t*)buffer, size, sd_spi2_handle, SD_SPI2_TIMEOUT);
+		SPI_ReadBuf(&sd_spi2_bus, buffer, size, SD_SPI2_TIMEOUT);
 		DESELECT_SD();
 		return SD_SPI_OK;
 	};
@@ -454,11 +576,11 @@ SD_SPI_STATE GetCIDRegister(char* cid_string)
 	} else return retval;
 }
 
-SD_SPI_STATE GetCSDRegister()
-{	CID_CSD_RESP resp; s_args args; s_r1 r1; int i;
+SD_SPI_STATE GetCSDRegister(CID_CSD_RESP* resp)
+{	s_args args;
 	args.argw = 0;
 	SendSDCommand(SEND_CSD, args);
-	return ReadBlock(&resp, sizeof(resp));
+	return ReadBlock(resp, sizeof(*resp));
 }
 
 uint32_t GetBlockLength()
@@ -480,11 +602,11 @@ void SetBlockLength(uint32_t new_blocklength)
 	}
 }
 
-SD_SPI_STATE WaitForPattern(uint8_t pattern, SPI_HandleTypeDef handle, uint32_t TimeOut)
+SD_SPI_STATE WaitForPattern(uint8_t pattern, s_spi_bus* bus, uint32_t TimeOut)
 {	uint8_t test_byte;
 	SELECT_SD();
 	do {
-	    SPI_ReadByte((uint8_t*)&test_byte, handle, 1000);
+	    test_byte = SPI_Exchange(bus, SD_DUMMY_BYTE);
 	} while ((pattern != test_byte) && (TimeOut--));
 	DESELECT_SD();
 	if (!TimeOut) return SD_TIMEOUT;
@@ -502,14 +624,184 @@ SD_SPI_STATE WaitForPattern(uint8_t pattern, SPI_HandleTypeDef handle, uint32_t
  * Last two bytes: 16 bit CRC.
  */
 
+/* @brief SD_AddressArg(address) The address argument of the command. The argument goes MSB first,
+ * SendSDCommand() sends the bytes in memory order. */
+
+static s_args SD_AddressArg(uint32_t address)
+{	s_args args;
+	args.B0 = address >> 24;
+	args.B1 = address >> 16;
+	args.B2 = address >> 8;
+	args.B3 = address;
+	return args;
+}
+
 SD_SPI_STATE ReadDataBlock(uint32_t block_address, uint8_t* buffer)
 {
-  s_r1 r1; uint32_t i; s_args arg;
-  arg.argw = block_address; uint8_t inbyte;
-  SendSDCommand(READ_SINGLE_BLOCK, arg);
+  SendSDCommand(READ_SINGLE_BLOCK, SD_AddressArg(block_address));
   return ReadBlock(buffer, SDHX_BLOCSIZE);
 }
 
+SD_SPI_STATE ReadDataBlockPolling(uint32_t block_address, uint8_t* buffer)
+{
+	SendSDCommand(READ_SINGLE_BLOCK, SD_AddressArg(block_address));
+	return ReadBlockPath(buffer, SDHX_BLOCSIZE, SD_PAYLOAD_HAL);
+}
+
+/*
+ * Multiple block write. Every block is the start block token, the data, and the CRC16, the card answers with the data
+ * response token, then it holds the data line low (busy) while it programs the block.
+ */
+
+/* @brief SD_WaitReady(TimeOut) Wait for the end of the busy (0xFF on the data line). TimeOut in milliseconds. */
+
+static SD_SPI_STATE SD_WaitReady(uint32_t TimeOut)
+{	uint32_t tickstart = HAL_GetTick();
+	SELECT_SD();
+	while (SPI_Exchange(&sd_spi2_bus, SD_DUMMY_BYTE) != SD_DUMMY_BYTE)
+	{
+		if ((HAL_GetTick() - tickstart) > TimeOut)
+		{
+			DESELECT_SD();
+			SD_SPI_Timeout_Error();
+			return SD_TIMEOUT;
+		}
+	}
+	DESELECT_SD();
+	return SD_SPI_OK;
+}
+
+/* @brief SD_WriteToken(token) Send the start block, or the stop transmission token after one byte gap. */
+
+static void SD_WriteToken(uint8_t token)
+{
+	SELECT_SD();
+	SPI_Exchange(&sd_spi2_bus, SD_DUMMY_BYTE);
+	SPI_Exchange(&sd_spi2_bus, token);
+}
+
+/*
+ * @brief SD_WriteResponse(buffer) Send the CRC16 of the block, and read the data response token. The CS is active, it
+ * stays active. Without CRC_SD_DATA the card does not check the CRC (CRC option off).
+ */
+
+static SD_SPI_STATE SD_WriteResponse(const uint8_t* buffer)
+{	uint8_t crc[2] = {SD_DUMMY_BYTE, SD_DUMMY_BYTE}, response; int i;
+#if defined CRC_SD_DATA
+	uint16_t CRCVal = crc16((uint8_t*)buffer, SDHX_BLOCSIZE);
+	crc[0] = CRCVal >> 8;
+	crc[1] = CRCVal;
+#endif
+	SPI_ExchangeBuf(&sd_spi2_bus, crc, NULL, sizeof(crc));
+	for (i = 0; i < 8; i++)
+	{
+		if ((response = SPI_Exchange(&sd_spi2_bus, SD_DUMMY_BYTE)) != SD_DUMMY_BYTE) break;
+	}
+	if ((response & DATA_RESP_MASK) == DATA_RESP_ACCEPTED) return SD_SPI_OK;
+	return ((response & DATA_RESP_MASK) == DATA_RESP_CRC_ERR) ? SD_DATA_CRC16_ERR : SD_ERROR;
+}
+
+SD_SPI_STATE WriteMultipleStart(uint32_t block_address)
+{	s_r1 r1;
+#if defined (SD_SPI_DMA)
+	if (SPI_QueueFlush(&sd_spi2_bus, SD_SPI2_TIMEOUT) != HAL_OK) return SD_TIMEOUT;
+#endif
+	SendSDCommand(WRITE_MULTIPLE_BLOCK, SD_AddressArg(block_address));
+	if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) != SD_SPI_OK) return SD_ERROR;
+	return (r1.b) ? SD_ERROR : SD_SPI_OK;
+}
+
+SD_SPI_STATE WriteMultipleBlock(const uint8_t* buffer)
+{	SD_SPI_STATE result;
+#if defined (SD_SPI_DMA)
+	if (SPI_QueueFlush(&sd_spi2_bus, SD_SPI2_TIMEOUT) != HAL_OK) return SD_TIMEOUT;
+#endif
+	if (SD_WaitReady(SD_WRITE_BUSY_TIMEOUT) != SD_SPI_OK) return SD_TIMEOUT;
+	SD_WriteToken(PATTERN_MBW);
+	SPI_ExchangeBuf(&sd_spi2_bus, buffer, NULL, SDHX_BLOCSIZE);
+	result = SD_WriteResponse(buffer);
+	DESELECT_SD();
+	return result;
+}
+
+SD_SPI_STATE WriteMultipleStop()
+{
+#if defined (SD_SPI_DMA)
+	if (SPI_QueueFlush(&sd_spi2_bus, SD_SPI2_TIMEOUT) != HAL_OK) return SD_TIMEOUT;
+#endif
+	if (SD_WaitReady(SD_WRITE_BUSY_TIMEOUT) != SD_SPI_OK) return SD_TIMEOUT;
+	SD_WriteToken(PATTERN_STOP_TRAN);
+	DESELECT_SD();
+	return SD_WaitReady(SD_WRITE_BUSY_TIMEOUT);
+}
+
+uint32_t SD_BlockAddress(uint32_t blocknum)
+{
+	return (sd_type == VER2HCSD) ? blocknum : blocknum * SDHX_BLOCSIZE;
+}
+
+#if defined (SD_SPI_DMA)
+
+/*
+ * @brief SD_ReadBlockDone() End of the data phase of the asynchronous block read. Read the CRC,
+ * release the card, and call the callback of the request. Runs in the DMA interrupt.
+ */
+
+static void SD_ReadBlockDone(s_spi_xfer* xfer, e_dma_transfer_state state)
+{	s_sd_request* req = (s_sd_request*)xfer; SD_SPI_STATE result = SD_SPI_OK;
+	if (state == TRANSFER_COMPLETE)
+	{
+		/* Last two bytes: 16 bit CRC */
+		SPI_ExchangeBuf(&sd_spi2_bus, NULL, (uint8_t*)&req->crc, 2);
+	} else result = SD_ERROR;
+	DESELECT_SD();
+#if defined CRC_SD_DATA
+	if ((result == SD_SPI_OK) && (crc16(xfer->buffer, xfer->size) != req->crc)) result = SD_DATA_CRC16_ERR;
+#endif
+	if (req->callback) req->callback(req, result);
+}
+
+SD_SPI_STATE ReadDataBlockAsync(uint32_t block_address, uint8_t* buffer, s_sd_request* req, sd_request_callback callback, void* arg)
+{	s_r1 r1;
+	/* The command phase is register level, the bus must be idle. */
+	if (SPI_QueueFlush(&sd_spi2_bus, SD_SPI2_TIMEOUT) != HAL_OK) return SD_TIMEOUT;
+	SendSDCommand(READ_SINGLE_BLOCK, SD_AddressArg(block_address));
+	if (SD_SPI_WaitValidResponse(&r1, &sd_spi2_bus, SD_RESET_CARD_TIMEOUT) != SD_SPI_OK) return SD_ERROR;
+	if (WaitForPattern(PATTERN_SBR, &sd_spi2_bus, READ_PATTERN_TIMEOUT) != SD_SPI_OK) return SD_ERROR;
+	req->callback = callback;
+	req->arg = arg;
+	SPI_XferInit(&req->xfer, buffer, SDHX_BLOCSIZE, SPI_XFER_RX | SPI_XFER_CS_HOLD, SD_ReadBlockDone, arg);
+	SPI_QueueSubmit(&sd_spi2_bus, &req->xfer);
+	return SD_SPI_OK;
+}
+
+/*
+ * @brief SD_WriteBlockDone() End of the data phase of the asynchronous block write. Send the CRC, read the data response,
+ * release the card, and call the callback of the request. The busy is the job of the next block. Runs in the DMA interrupt.
+ */
+
+static void SD_WriteBlockDone(s_spi_xfer* xfer, e_dma_transfer_state state)
+{	s_sd_request* req = (s_sd_request*)xfer; SD_SPI_STATE result = SD_ERROR;
+	if (state == TRANSFER_COMPLETE) result = SD_WriteResponse(xfer->buffer);
+	DESELECT_SD();
+	if (req->callback) req->callback(req, result);
+}
+
+SD_SPI_STATE WriteMultipleBlockAsync(const uint8_t* buffer, s_sd_request* req, sd_request_callback callback, void* arg)
+{
+	/* The token, and the busy wait are register level, the bus must be idle. */
+	if (SPI_QueueFlush(&sd_spi2_bus, SD_SPI2_TIMEOUT) != HAL_OK) return SD_TIMEOUT;
+	if (SD_WaitReady(SD_WRITE_BUSY_TIMEOUT) != SD_SPI_OK) return SD_TIMEOUT;
+	SD_WriteToken(PATTERN_MBW);
+	req->callback = callback;
+	req->arg = arg;
+	SPI_XferInit(&req->xfer, (void*)buffer, SDHX_BLOCSIZE, SPI_XFER_TX | SPI_XFER_CS_HOLD, SD_WriteBlockDone, arg);
+	SPI_QueueSubmit(&sd_spi2_bus, &req->xfer);
+	return SD_SPI_OK;
+}
+
+#endif
+
 /* ------------------- CRC16 procedures --------------------------*/
 /* @TODO The table maybe to write the flash memory. Or maybe calculate on-line,
  * not with table... */
@@ -596,3 +888,24 @@ uint8_t getCRCVal(uint8_t message[], int length)
 }
 
 #endif
+
+#if defined (SD_SPI_DMA)
+
+/*
+ * This is an interrupt handle for DMA SD card SPI rx channel.
+ */
+
+void DMA1_Channel4_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(sd_spi2_bus.handle.hdmarx);
+}
+
+/*
+ * This is an interrupt handle for DMA SD card SPI tx channel.
+ */
+
+void DMA1_Channel5_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(sd_spi2_bus.handle.hdmatx);
+}
+#endif
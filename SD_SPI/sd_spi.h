@@ -2,6 +2,8 @@
 #ifndef __SD_SPI_H
 #define __SD_SPI_H
 
+#include "spi.h"
+
 /*
  * Definitions the SD card SPI hardware installations.
  *
@@ -23,8 +25,8 @@
 #define SD_CARD_CS_PIN	GPIO_PIN_11
 
 
-#define SELECT_SD()		HAL_GPIO_WritePin(GPIOB, GPIO_PIN_11, GPIO_PIN_RESET)
-#define DESELECT_SD()	HAL_GPIO_WritePin(GPIOB, GPIO_PIN_11, GPIO_PIN_SET)
+#define SELECT_SD()		SPI_PIN_LOW(SD_CARD_CS_PORT, SD_CARD_CS_PIN)
+#define DESELECT_SD()	SPI_PIN_HIGH(SD_CARD_CS_PORT, SD_CARD_CS_PIN)
 
 
 /* Definitions and macros for SD card SPIcommunication.
@@ -94,6 +96,17 @@
 
 #define PATTERN_SBR	(0b11111110)
 
+/* Multiple Block Write: the start block of every data block, and the stop transmission token at the end. */
+
+#define PATTERN_MBW		(0b11111100)
+#define PATTERN_STOP_TRAN	(0b11111101)
+
+/* Data response token after a written block: xxx0sss1, sss = 010 data accepted, 101 CRC error, 110 write error. */
+
+#define DATA_RESP_MASK		(0x1F)
+#define DATA_RESP_ACCEPTED	(0x05)
+#define DATA_RESP_CRC_ERR	(0x0B)
+
 /* @brief enumeration SD_SPI result states */
 
 typedef enum {
@@ -301,6 +314,9 @@ typedef union {
 
 #define SD_SPI_CHANNEL	SPI2
 
+/* @brief The SD card SPI bus. */
+extern s_spi_bus sd_spi2_bus;
+
 /*
  * Define the sd card spi channel, and DMA channels for spi transmit, and receive.
  *
@@ -308,6 +324,9 @@ typedef union {
 
 #define SD_SPI_DMA
 
+/* The reads shorter than this go with the register level burst, the DMA setup does not worth it. */
+#define SD_DMA_MIN_SIZE		64
+
 
 #if defined (SD_SPI_DMA)
 /*
@@ -345,11 +364,12 @@ typedef enum {
  * must be at least 74 bits times keep high the data line. The max. SPI speed of 
  * 400 kHz,and this prescaler applies this SPI speed. 
  * */
-#define CONFIG_BAUD_PRESCALER	256
+#define CONFIG_BAUD_PRESCALER	SPI_BAUDRATEPRESCALER_256
 
-/* @brief Th prescaler determine the data stream of SPI2 SD card channel. 
+/* @brief The data stream clock of SPI2 SD card channel comes from the TRAN_SPEED of the CSD, but
+ * in SPI mode the card runs in default speed mode, so it is 25 MHz at most.
  * */
-#define DATA_BAUD_PRESCALER		4
+#define SD_SPI_MAX_HZ		25000000
  
 /* Timeout for ad card spi write read datas. */ 
  
@@ -363,6 +383,8 @@ typedef enum {
 #define SD_RESET_CARD_TIMEOUT		1000
 
 #define SD_READ_BLOCK_TIMEOUT	1000
+/* Busy timeout of the block programming in milliseconds (the SD specification allows 250 ms for a write). */
+#define SD_WRITE_BUSY_TIMEOUT	250
 #define READ_PATTERN_TIMEOUT	1000
  
  /* define SDCRC7 to calculate for crc7 value with SD card I/O procedures. */
@@ -382,7 +404,13 @@ typedef enum {
 void SD_SPI2_Init(); 
 void SD_Card_SPI_Select(); 
 
-void SetFastSPI();
+/* @brief SetFastSPI() Negotiate the data clock of the card: the CSD read at the configuration clock is the
+ * reference, the start clock comes from its TRAN_SPEED, and the clock steps down while the CSD reads back
+ * differently. */
+SD_SPI_STATE SetFastSPI();
+
+/* @brief SD_TranSpeedHz(tran_speed) The maximum data transfer rate from the TRAN_SPEED field of the CSD. */
+uint32_t SD_TranSpeedHz(uint8_t tran_speed);
 
 SD_SPI_STATE SPIModeInitialize();
 
@@ -390,6 +418,60 @@ SD_SPI_STATE SPIModeInitialize();
 SD_SPI_STATE ResetCard();
 
 SD_SPI_STATE ReadDataBlock(uint32_t blocknum, uint8_t* buffer);
+
+/* @brief ReadDataBlockPolling(block_address, buffer) Read a block with the HAL polling data phase.
+ * It is the reference of the DMA path in the benchmarks. */
+SD_SPI_STATE ReadDataBlockPolling(uint32_t block_address, uint8_t* buffer);
+
+/*
+ * Multiple block write. WriteMultipleStart() sends CMD25, the data blocks go one by one with WriteMultipleBlock(),
+ * or WriteMultipleBlockAsync(), and WriteMultipleStop() sends the stop transmission token. The card programs a block
+ * while the host makes the next one, the next block waits for the end of the busy.
+ */
+
+/* @brief WriteMultipleStart(block_address) Start the multiple block write at the block address. */
+SD_SPI_STATE WriteMultipleStart(uint32_t block_address);
+
+/* @brief WriteMultipleBlock(buffer) Write the next block (SDHX_BLOCSIZE bytes) of the multiple block write. */
+SD_SPI_STATE WriteMultipleBlock(const uint8_t* buffer);
+
+/* @brief WriteMultipleStop() End the multiple block write, and wait for the programming of the last block. */
+SD_SPI_STATE WriteMultipleStop();
+
+/* @brief SD_BlockAddress(blocknum) The address argument of the block read/write commands.
+ * The standard capacity cards are byte addressed, the high capacity cards are block addressed. */
+uint32_t SD_BlockAddress(uint32_t blocknum);
+
+#if defined (SD_SPI_DMA)
+
+struct s_sd_request;
+
+/* @brief Complete callback of the asynchronous SD card requests. Runs in the DMA interrupt. */
+typedef void (*sd_request_callback)(struct s_sd_request* req, SD_SPI_STATE state);
+
+/* @brief Asynchronous SD card request. The transfer descriptor must be the first member. */
+typedef struct s_sd_request {
+	s_spi_xfer xfer;				// The data phase transfer on the SD card bus.
+	sd_request_callback callback;	// Complete callback, or NULL.
+	void* arg;						// User argument of the callback.
+	uint16_t crc;					// The CRC16 of the data block from the card.
+} s_sd_request;
+
+/*
+ * @brief ReadDataBlockAsync(block_address, buffer, req, callback, arg) Send the read command, wait for the
+ * start block token, then queue the data phase on the SD bus DMA, and return. The callback comes, when the
+ * block is in the buffer. The request, and the buffer (SDHX_BLOCSIZE bytes) must be valid until the callback.
+ */
+SD_SPI_STATE ReadDataBlockAsync(uint32_t block_address, uint8_t* buffer, s_sd_request* req, sd_request_callback callback, void* arg);
+
+/*
+ * @brief WriteMultipleBlockAsync(buffer, req, callback, arg) Wait for the end of the busy of the previous block, send the
+ * start block token, then queue the data phase on the SD bus DMA, and return. The callback comes, when the card took
+ * the block (data response). The request, and the buffer (SDHX_BLOCSIZE bytes) must be valid until the callback.
+ */
+SD_SPI_STATE WriteMultipleBlockAsync(const uint8_t* buffer, s_sd_request* req, sd_request_callback callback, void* arg);
+
+#endif
 /*
  * The host can turn the CRC option on and off using the CRC_ON_OFF command (CMD59). Host should
  * enable CRC verification before issuing ACMD41.
@@ -399,9 +481,9 @@ SD_SPI_STATE CRCSet(uint8_t ONOFF);
 
 SD_SPI_STATE GetCIDRegister();
 
-SD_SPI_STATE GetCSDRegister();
+SD_SPI_STATE GetCSDRegister(CID_CSD_RESP* resp);
 
-SD_SPI_STATE WaitForPattern(uint8_t pattern, SPI_HandleTypeDef handle, uint32_t TimeOut);
+SD_SPI_STATE WaitForPattern(uint8_t pattern, s_spi_bus* bus, uint32_t TimeOut);
 
 
 
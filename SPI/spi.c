@@ -1,197 +1,614 @@
 
-
 #include "spi.h"
 
+/* @brief Handle for SPI general error.
+ * @TODO What we are to do?
+ * */
 
-/*
- * Global variable because may set this value of the transfer complete DMA interrupt routine.
- */
-
-#if defined (SPI1_W_DMA)
-
-e_dma_transfer_state SPI1_DMA_TransferState;
-
-#endif
-
-#if defined (SPI2_W_DMA)
+void SPI_Error(s_spi_bus* bus)
+{
 
-e_dma_transfer_state SPI2_DMA_TransferState;
+}
 
-#endif
+s_spi_bus* spi_buses[SPI_MAX_BUSES];
+uint8_t spi_bus_count;
 
-/* @brief Handle for SPI general error.  
- * @TODO What we are to do?   
- * */
+/* @brief SPI_Register(SPI bus) Add the bus to the initialized buses. */
 
-void SPI_Error()
-{
-	
+static void SPI_Register(s_spi_bus* bus)
+{	int i;
+	for (i = 0; i < spi_bus_count; i++)
+	{
+		if (spi_buses[i] == bus) return;
+	}
+	if (spi_bus_count < SPI_MAX_BUSES) spi_buses[spi_bus_count++] = bus;
 }
 
-/* @brief SPI_Init(SPI channel) Initialize on the got parameter SPI channel */
+/* @brief SPI_Init(SPI bus) Initialize on the got parameter SPI bus */
 
-void SPI_Init(SPI_HandleTypeDef* SPI_Chan)
+void SPI_Init(s_spi_bus* bus)
 {
-	HAL_SPI_DeInit(SPI_Chan);
-  if (HAL_SPI_Init(SPI_Chan) != HAL_OK)
+	SPI_Register(bus);
+	bus->write_prescaler = bus->read_prescaler = bus->handle.Init.BaudRatePrescaler;
+	HAL_SPI_DeInit(&bus->handle);
+  if (HAL_SPI_Init(&bus->handle) != HAL_OK)
   {
     /* Should not occur */
     while(1) {};
   }
+  /* The register level transfers need the enabled SPI. */
+  __HAL_SPI_ENABLE(&bus->handle);
 }
 
 /**
-  * @brief SPI_WriteByte Write a byte to SPI handle port.
-  * @param Value the byte to written, TimeOut the timeout value to write. 
-  * @retval None
+  * @brief SPI_WriteByte Write a byte to SPI bus.
+  * @param bus the SPI bus, Value the byte to written, TimeOut the timeout value to write.
+  * @retval HAL status
   */
-void SPI_WriteByte(uint8_t Value, SPI_HandleTypeDef handle, uint32_t TimeOut)
+HAL_StatusTypeDef SPI_WriteByte(s_spi_bus* bus, uint8_t Value, uint32_t TimeOut)
 {
   HAL_StatusTypeDef status = HAL_OK;
 
-  status = HAL_SPI_Transmit(&handle, (uint8_t*) &Value, 1, TimeOut);
+  status = HAL_SPI_Transmit(&bus->handle, (uint8_t*) &Value, 1, TimeOut);
 
   /* Check the communication status */
   if(status != HAL_OK)
   {
     /* Execute user timeout callback */
-    SPI_Error(handle);
+    SPI_Error(bus);
   }
+  return status;
 }
 
 /**
-  * @brief SPI_WriteBuf Write buffer bytes to the selected SPI port.
-  * @param Value the pointer for buffer, size: size of buffer in bytes 
-	* TimeOut the timeout value to write. 
-  * @retval None
+  * @brief SPI_WriteBuf Write buffer bytes to the selected SPI bus.
+  * @param bus the SPI bus, Buffer the pointer for buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to write.
+  * @retval HAL status
   */
 
-void SPI_WriteBuf(void* Buffer, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut)
+HAL_StatusTypeDef SPI_WriteBuf(s_spi_bus* bus, const void* Buffer, uint16_t size, uint32_t TimeOut)
 {
   HAL_StatusTypeDef status = HAL_OK;
-  status = HAL_SPI_Transmit(&handle, (uint8_t*) Buffer, size, TimeOut);
+  status = HAL_SPI_Transmit(&bus->handle, (uint8_t*) Buffer, size, TimeOut);
 
   /* Check the communication status */
   if(status != HAL_OK)
   {
     /* Execute user timeout callback */
-    SPI_Error(handle);
+    SPI_Error(bus);
   }
+  return status;
 }
 
 /**
-  * @brief SPI_ReadBuf Read size of byte to the Buffer from SPI port designated by handle.
-  * @param Value the byte to read, TimeOut the timeout value to read. 
-  * @retval None
+  * @brief SPI_ReadBuf Read size of byte to the Buffer from SPI bus.
+  * @param bus the SPI bus, Buffer the read buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to read.
+  * @retval HAL status
   */
-void SPI_ReadBuf(uint8_t* Buffer, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut)
+HAL_StatusTypeDef SPI_ReadBuf(s_spi_bus* bus, void* Buffer, uint16_t size, uint32_t TimeOut)
 {
   HAL_StatusTypeDef status = HAL_OK;
-  status = HAL_SPI_Receive(&handle, (uint8_t*) Buffer, size, TimeOut);
+  status = HAL_SPI_Receive(&bus->handle, (uint8_t*) Buffer, size, TimeOut);
 
   /* Check the communication status */
   if(status != HAL_OK)
   {
     /* Execute user timeout callback */
-    SPI_Error(handle);
+    SPI_Error(bus);
   }
+  return status;
 }
 
 
 /**
-  * @brief SPI_ReadByte Read a byte from SPI port designated by handle.
-  * @param Value the byte to read, TimeOut the timeout value to read. 
-  * @retval None
+  * @brief SPI_ReadByte Read a byte from SPI bus.
+  * @param bus the SPI bus, Value the byte to read, TimeOut the timeout value to read.
+  * @retval HAL status
   */
-void SPI_ReadByte(uint8_t* Value, SPI_HandleTypeDef handle, uint32_t TimeOut)
+HAL_StatusTypeDef SPI_ReadByte(s_spi_bus* bus, uint8_t* Value, uint32_t TimeOut)
 {
   HAL_StatusTypeDef status = HAL_OK;
-	
-  status = HAL_SPI_Receive(&handle, (uint8_t*) Value, 1, TimeOut);
+
+  status = HAL_SPI_Receive(&bus->handle, (uint8_t*) Value, 1, TimeOut);
 
   /* Check the communication status */
   if(status != HAL_OK)
   {
     /* Execute user timeout callback */
-    SPI_Error(handle);
+    SPI_Error(bus);
   }
+  return status;
+}
+
+/**
+  * @brief SPI_ExchangeBuf Full-duplex burst transfer.
+  * @param bus the SPI bus, TxBuffer the bytes to send (NULL: send 0xFF bytes),
+  * RxBuffer the received bytes (NULL: drop the received bytes), size in bytes.
+  * @retval None
+  */
+
+#if !defined (SPI_SIMULATION)
+void SPI_ExchangeBuf(s_spi_bus* bus, const uint8_t* TxBuffer, uint8_t* RxBuffer, uint16_t size)
+{	SPI_TypeDef* spi = bus->handle.Instance; uint8_t in;
+	if (!size) return;
+	while (!(spi->SR & SPI_SR_TXE)) {};
+	*(__IO uint8_t*)&spi->DR = (TxBuffer) ? *TxBuffer++ : 0xFF;
+	while (--size)
+	{
+		/* Load the next byte while the previous one is shifting. */
+		while (!(spi->SR & SPI_SR_TXE)) {};
+		*(__IO uint8_t*)&spi->DR = (TxBuffer) ? *TxBuffer++ : 0xFF;
+		while (!(spi->SR & SPI_SR_RXNE)) {};
+		in = *(__IO uint8_t*)&spi->DR;
+		if (RxBuffer) *RxBuffer++ = in;
+	}
+	while (!(spi->SR & SPI_SR_RXNE)) {};
+	in = *(__IO uint8_t*)&spi->DR;
+	if (RxBuffer) *RxBuffer = in;
+	while (spi->SR & SPI_SR_BSY) {};
 }
+#endif
 
-e_dma_transfer_state* GetTransferStatePtr(SPI_HandleTypeDef* handle)
+/*
+ * @brief SPI_SetDMAAlign Set the data size of a DMA channel.
+ */
+
+static void SPI_SetDMAAlign(DMA_HandleTypeDef* hdma, uint32_t periph, uint32_t mem)
 {
-	if (handle->Instance == SPI1)
+	if (hdma == NULL) return;
+	hdma->Init.PeriphDataAlignment = periph;
+	hdma->Init.MemDataAlignment = mem;
+	hdma->Instance->CCR = (hdma->Instance->CCR & ~(DMA_CCR_PSIZE | DMA_CCR_MSIZE)) | periph | mem;
+}
+
+/*
+ * @brief SPI_SetDMAMemInc Switch the memory increment of a DMA channel. The channel must be disabled.
+ */
+
+static void SPI_SetDMAMemInc(DMA_HandleTypeDef* hdma, uint8_t inc)
+{
+	if (hdma == NULL) return;
+	if (inc)
 	{
-		return &SPI1_DMA_TransferState;
+		hdma->Init.MemInc = DMA_MINC_ENABLE;
+		hdma->Instance->CCR |= DMA_CCR_MINC;
 	} else
-	if (handle->Instance == SPI2)
 	{
-		return &SPI2_DMA_TransferState;
+		hdma->Init.MemInc = DMA_MINC_DISABLE;
+		hdma->Instance->CCR &= ~DMA_CCR_MINC;
+	}
+}
+
+/**
+  * @brief SPI_SetFrameSize Switch the SPI, and its DMA channels between 8, and 16 bit frames.
+  * @param bus the SPI bus, frame16 1: 16 bit frames, 0: 8 bit frames.
+  * @retval None
+  */
+
+void SPI_SetFrameSize(s_spi_bus* bus, uint8_t frame16)
+{	SPI_TypeDef* spi = bus->handle.Instance;
+	if (((spi->CR1 & SPI_CR1_DFF) != 0) == (frame16 != 0)) return;
+	/* The DFF bit must be written while the SPI is disabled. */
+	while (spi->SR & SPI_SR_BSY) {};
+	__HAL_SPI_DISABLE(&bus->handle);
+	if (frame16)
+	{
+		spi->CR1 |= SPI_CR1_DFF;
+		bus->handle.Init.DataSize = SPI_DATASIZE_16BIT;
+		SPI_SetDMAAlign(bus->handle.hdmatx, DMA_PDATAALIGN_HALFWORD, DMA_MDATAALIGN_HALFWORD);
+		SPI_SetDMAAlign(bus->handle.hdmarx, DMA_PDATAALIGN_HALFWORD, DMA_MDATAALIGN_HALFWORD);
 	} else
-		return NULL;
+	{
+		spi->CR1 &= ~SPI_CR1_DFF;
+		bus->handle.Init.DataSize = SPI_DATASIZE_8BIT;
+		SPI_SetDMAAlign(bus->handle.hdmatx, DMA_PDATAALIGN_BYTE, DMA_MDATAALIGN_BYTE);
+		SPI_SetDMAAlign(bus->handle.hdmarx, DMA_PDATAALIGN_BYTE, DMA_MDATAALIGN_BYTE);
+	}
+	__HAL_SPI_ENABLE(&bus->handle);
 }
 
+/*
+ * @brief SPI_BusClock(bus) The peripheral clock of the SPI bus.
+ */
+
+uint32_t SPI_BusClock(s_spi_bus* bus)
+{
+	return (bus->handle.Instance == SPI1) ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+}
+
+/*
+ * @brief SPI_ClockHz(bus, prescaler) The BR field is the power of two divider: fPCLK / 2^(BR + 1).
+ */
+
+uint32_t SPI_ClockHz(s_spi_bus* bus, uint32_t prescaler)
+{
+	return SPI_BusClock(bus) >> (((prescaler & SPI_CR1_BR) >> SPI_CR1_BR_Pos) + 1);
+}
+
+/*
+ * @brief SPI_PrescalerFor(bus, max_hz) The smallest divider, with the clock not above the device, and the SPI limit.
+ */
+
+uint32_t SPI_PrescalerFor(s_spi_bus* bus, uint32_t max_hz)
+{	uint32_t br;
+	if (max_hz > SPI_MAX_HZ) max_hz = SPI_MAX_HZ;
+	for (br = 0; br < 7; br++)
+	{
+		if ((SPI_BusClock(bus) >> (br + 1)) <= max_hz) break;
+	}
+	return br << SPI_CR1_BR_Pos;
+}
+
+/*
+ * @brief SPI_SetPrescaler(bus, prescaler) The BR bits must be written while the SPI is disabled.
+ */
+
+void SPI_SetPrescaler(s_spi_bus* bus, uint32_t prescaler)
+{	SPI_TypeDef* spi = bus->handle.Instance;
+	if ((spi->CR1 & SPI_CR1_BR) == prescaler) return;
+	while (spi->SR & SPI_SR_BSY) {};
+	__HAL_SPI_DISABLE(&bus->handle);
+	spi->CR1 = (spi->CR1 & ~SPI_CR1_BR) | prescaler;
+	bus->handle.Init.BaudRatePrescaler = prescaler;
+	__HAL_SPI_ENABLE(&bus->handle);
+}
+
+/*
+ * @brief SPI_ClockNegotiate(bus, max_hz, check, arg, prescaler) Step down from the fastest clock, until
+ * SPI_CLOCK_CHECKS checks pass in a row.
+ */
+
+HAL_StatusTypeDef SPI_ClockNegotiate(s_spi_bus* bus, uint32_t max_hz, spi_clock_check check, void* arg, uint32_t* prescaler)
+{	uint32_t br = SPI_PrescalerFor(bus, max_hz); int i;
+	while (1)
+	{
+		SPI_SetPrescaler(bus, br);
+		for (i = 0; i < SPI_CLOCK_CHECKS; i++)
+		{
+			if (check(bus, arg) != HAL_OK) break;
+		}
+		if (i == SPI_CLOCK_CHECKS)
+		{
+			*prescaler = br;
+			return HAL_OK;
+		}
+		if (br == SPI_BAUDRATEPRESCALER_256) return HAL_ERROR;
+		br += SPI_CR1_BR_0;
+	}
+}
+
+#if defined (SPI1_W_DMA) | defined (SPI2_W_DMA)
+
+#if defined (SPI_BUS_STATS)
+
+/* Number of the buses with running DMA, and the cycles while more than one bus was busy. */
+static uint8_t spi_busy_buses;
+static uint32_t spi_overlap_start;
+uint32_t spi_overlap_cycles;
+
+/*
+ * @brief SPI_StatStart(), SPI_StatStop() Count the busy time of the bus, and the overlapped
+ * time of the buses. Called with disabled interrupts, or from the DMA interrupt.
+ */
+
+static void SPI_StatStart(s_spi_bus* bus)
+{	uint32_t now = DWT->CYCCNT;
+	bus->stat_start = now;
+	if (++spi_busy_buses == 2) spi_overlap_start = now;
+}
+
+static void SPI_StatStop(s_spi_bus* bus, uint32_t size)
+{	uint32_t now = DWT->CYCCNT;
+	bus->stat_busy_cycles += now - bus->stat_start;
+	bus->stat_bytes += size;
+	bus->stat_xfers++;
+	if (spi_busy_buses-- == 2) spi_overlap_cycles += now - spi_overlap_start;
+}
+
+#endif
 
 /**
-  * @brief SPI_WriteBufDMA Write buffer bytes to the selected SPI port with DMA
-  * @param Value the pointer for buffer, size: size of buffer in bytes
-	* TimeOut the timeout value to write.
+  * @brief SPI_XferInit Fill a transfer descriptor.
+  * @param xfer the descriptor, buffer, size the data, flags SPI_XFER_xxx flags,
+  * callback the complete callback (or NULL), arg user argument of the callback.
+  * @retval None
+  */
+
+void SPI_XferInit(s_spi_xfer* xfer, void* buffer, uint16_t size, uint8_t flags, spi_xfer_callback callback, void* arg)
+{
+	xfer->next = NULL;
+	xfer->buffer = buffer;
+	xfer->size = size;
+	xfer->flags = flags;
+	xfer->callback = callback;
+	xfer->arg = arg;
+}
+
+#if defined (SPI_BUS_STATS)
+
+/* @brief SPI_XferBytes(xfer) The bytes on the wire of a transfer (the size of the fixed source transfers is in frames). */
+
+static uint32_t SPI_XferBytes(s_spi_xfer* xfer)
+{
+	if (!(xfer->flags & SPI_XFER_FIXED)) return xfer->size;
+	return (xfer->flags & SPI_XFER_16BIT) ? (uint32_t)xfer->size * 2 : xfer->size;
+}
+
+#endif
+
+/* The transmit source of the DMA receives (both for 8, and 16 bit frames). */
+static const uint16_t spi_fill = 0xFFFF;
+
+/*
+ * @brief SPI_QueuePop Remove the first transfer of the queue, release the chip select,
+ * and call the complete callback.
+ */
+
+static void SPI_QueuePop(s_spi_bus* bus, e_dma_transfer_state state)
+{	s_spi_xfer* xfer = bus->queue_head;
+	bus->queue_head = xfer->next;
+	if (bus->queue_head == NULL) bus->queue_tail = NULL;
+	if (!(xfer->flags & (SPI_XFER_RAW | SPI_XFER_CS_HOLD)))
+	{
+		SPI_PIN_HIGH(bus->cs_port, bus->cs_pin);
+	}
+	bus->dma_state = state;
+	if (xfer->callback) xfer->callback(xfer, state);
+}
+
+/*
+ * @brief SPI_QueueStart Start the first transfer of the queue, if the bus is idle.
+ * If the transfer can not start, it completes with error, and the next one comes.
+ */
+
+static void SPI_QueueStart(s_spi_bus* bus)
+{	s_spi_xfer* xfer; HAL_StatusTypeDef status; uint16_t count;
+	while ((!bus->xfer_running) && ((xfer = bus->queue_head) != NULL))
+	{
+		/* The DMA counts frames. */
+		SPI_SetFrameSize(bus, xfer->flags & SPI_XFER_16BIT);
+		count = ((xfer->flags & (SPI_XFER_16BIT | SPI_XFER_FIXED)) == SPI_XFER_16BIT) ? xfer->size / 2 : xfer->size;
+		if (!(xfer->flags & SPI_XFER_RAW))
+		{
+			if (bus->dc_port)
+			{
+				if (xfer->flags & SPI_XFER_DATA) SPI_PIN_HIGH(bus->dc_port, bus->dc_pin);
+				else SPI_PIN_LOW(bus->dc_port, bus->dc_pin);
+			}
+			SPI_PIN_LOW(bus->cs_port, bus->cs_pin);
+		}
+		bus->dma_state = TRANSFER_WAIT;
+		bus->xfer_running = 1;
+#if defined (SPI_BUS_STATS)
+		SPI_StatStart(bus);
+#endif
+		if (xfer->flags & SPI_XFER_RX)
+		{
+			/* Full-duplex: the TX channel clocks out the constant 0xFF source without memory increment. */
+			SPI_SetDMAMemInc(bus->handle.hdmatx, 0);
+			status = HAL_SPI_TransmitReceive_DMA(&bus->handle, (uint8_t*) &spi_fill, (uint8_t*) xfer->buffer, count);
+		} else
+		{
+			SPI_SetDMAMemInc(bus->handle.hdmatx, !(xfer->flags & SPI_XFER_FIXED));
+			status = HAL_SPI_Transmit_DMA(&bus->handle, (uint8_t*) xfer->buffer, count);
+		}
+		if (status != HAL_OK)
+		{
+			bus->xfer_running = 0;
+#if defined (SPI_BUS_STATS)
+			SPI_StatStop(bus, 0);
+#endif
+			SPI_Error(bus);
+			SPI_QueuePop(bus, TRANSFER_ERROR);
+		}
+	}
+}
+
+/*
+ * @brief SPI_QueueDone End of the running transfer. Called from the DMA interrupt.
+ */
+
+static void SPI_QueueDone(s_spi_bus* bus, e_dma_transfer_state state)
+{
+	if (!bus->xfer_running) return;
+	bus->xfer_running = 0;
+#if defined (SPI_BUS_STATS)
+	SPI_StatStop(bus, (bus->queue_head) ? SPI_XferBytes(bus->queue_head) : 0);
+#endif
+	if (bus->queue_head == NULL)
+	{
+		bus->dma_state = state;
+		return;
+	}
+	SPI_QueuePop(bus, state);
+	SPI_QueueStart(bus);
+	/* The idle bus is in 8 bit mode for the polling, and register level transfers. */
+	if (!bus->xfer_running) SPI_SetFrameSize(bus, 0);
+}
+
+/**
+  * @brief SPI_QueueSubmit Add a transfer to the queue of the bus.
+  * @param bus the SPI bus, xfer the transfer descriptor.
   * @retval None
   */
 
-HAL_StatusTypeDef SPI_WriteBufDMA(void* Buffer, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut)
-{	e_dma_transfer_state* state;
-	state = GetTransferStatePtr(&handle);
-	*state = TRANSFER_WAIT;
-	if (HAL_SPI_Transmit_DMA(&handle, Buffer, size) != HAL_OK)
+void SPI_QueueSubmit(s_spi_bus* bus, s_spi_xfer* xfer)
+{
+	xfer->next = NULL;
+	SPI_QueueSubmitChain(bus, xfer);
+}
+
+/**
+  * @brief SPI_QueueSubmitChain Add a linked list of transfers to the queue of the bus at once.
+  * @param bus the SPI bus, first the first descriptor of the chain.
+  * @retval None
+  */
+
+void SPI_QueueSubmitChain(s_spi_bus* bus, s_spi_xfer* first)
+{	uint32_t primask = __get_PRIMASK(); s_spi_xfer* last = first;
+	while (last->next) last = last->next;
+	__disable_irq();
+	if (bus->queue_tail)
 	{
-		return HAL_ERROR;
+		bus->queue_tail->next = first;
 	} else
 	{
-	    /* Execute user timeout callback */
-	    SPI_Error(handle);
+		bus->queue_head = first;
 	}
-	while (*state != TRANSFER_COMPLETE){ };
+	bus->queue_tail = last;
+	SPI_QueueStart(bus);
+	__set_PRIMASK(primask);
+}
+
+/**
+  * @brief SPI_QueueFlush Wait until all of the queued transfers are done.
+  * @param bus the SPI bus, TimeOut timeout in milliseconds.
+  * @retval HAL_OK, or HAL_TIMEOUT.
+  */
+
+HAL_StatusTypeDef SPI_QueueFlush(s_spi_bus* bus, uint32_t TimeOut)
+{	uint32_t tickstart = HAL_GetTick();
+	while (SPI_QueueBusy(bus))
+	{
+		if ((HAL_GetTick() - tickstart) > TimeOut)
+		{
+			SPI_Error(bus);
+			return HAL_TIMEOUT;
+		}
+	};
 	return HAL_OK;
 }
 
 /**
-  * @brief SPI_ReadBufDMA Read size of byte to the Buffer from SPI port designated by handle with DMA.
-  * @param Value the byte to read, TimeOut the timeout value to read.
+  * @brief SPI_QueueAbort Stop the running transfer, and drop the queue. The callbacks
+  * of the dropped transfers get TRANSFER_ERROR state.
+  * @param bus the SPI bus.
   * @retval None
   */
-HAL_StatusTypeDef SPI_ReadBufDMA(uint8_t* Buffer, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut)
-{	e_dma_transfer_state* state;
-	state = GetTransferStatePtr(&handle);
-	*state = TRANSFER_WAIT;
-	if (HAL_SPI_Receive_DMA(&handle, Buffer, size) != HAL_OK)
+
+void SPI_QueueAbort(s_spi_bus* bus)
+{	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	HAL_SPI_DMAStop(&bus->handle);
+	if (bus->xfer_running)
 	{
-		return HAL_ERROR;
-	} else
+		bus->xfer_running = 0;
+#if defined (SPI_BUS_STATS)
+		SPI_StatStop(bus, 0);
+#endif
+	}
+	while (bus->queue_head)
 	{
-	    /* Execute user timeout callback */
-	    SPI_Error(handle);
+		SPI_QueuePop(bus, TRANSFER_ERROR);
 	}
-	while (*state != TRANSFER_COMPLETE){ };
-	return HAL_OK;
+	SPI_SetFrameSize(bus, 0);
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief SPI_BlockingDone Complete callback of the blocking DMA transfers.
+ */
+
+static void SPI_BlockingDone(s_spi_xfer* xfer, e_dma_transfer_state state)
+{
+	*(volatile e_dma_transfer_state*)xfer->arg = state;
+}
+
+/*
+ * @brief SPI_BlockingDMA Queue a transfer, and wait for the end of it. The caller
+ * drives the CS and DC lines.
+ */
+
+static HAL_StatusTypeDef SPI_BlockingDMA(s_spi_bus* bus, void* Buffer, uint16_t size, uint8_t flags, uint32_t TimeOut)
+{	s_spi_xfer xfer; volatile e_dma_transfer_state state = TRANSFER_WAIT;
+	uint32_t tickstart = HAL_GetTick();
+
+	SPI_XferInit(&xfer, Buffer, size, flags | SPI_XFER_RAW, SPI_BlockingDone, (void*)&state);
+	SPI_QueueSubmit(bus, &xfer);
+	while (state == TRANSFER_WAIT)
+	{
+		if ((HAL_GetTick() - tickstart) > TimeOut)
+		{
+			/* The descriptor is on the stack, it must not remain in the queue. */
+			SPI_QueueAbort(bus);
+			return HAL_TIMEOUT;
+		}
+	};
+	return (state == TRANSFER_COMPLETE) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief SPI_WriteBufDMA Write buffer bytes to the selected SPI bus with DMA
+  * @param bus the SPI bus, Buffer the pointer for buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_WriteBufDMA(s_spi_bus* bus, const void* Buffer, uint16_t size, uint32_t TimeOut)
+{
+	return SPI_BlockingDMA(bus, (void*) Buffer, size, SPI_XFER_TX, TimeOut);
+}
+
+/**
+  * @brief SPI_ReadBufDMA Read size of byte to the Buffer from SPI bus with DMA.
+  * @param bus the SPI bus, Buffer the read buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to read.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPI_ReadBufDMA(s_spi_bus* bus, void* Buffer, uint16_t size, uint32_t TimeOut)
+{
+	return SPI_BlockingDMA(bus, Buffer, size, SPI_XFER_RX, TimeOut);
+}
+
+/**
+  * @brief SPI_WriteBufDMA16 Write uint16_t values to the selected SPI bus with DMA in 16 bit frames.
+  * @param bus the SPI bus, Buffer the pointer for buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_WriteBufDMA16(s_spi_bus* bus, const void* Buffer, uint16_t size, uint32_t TimeOut)
+{
+	return SPI_BlockingDMA(bus, (void*) Buffer, size, SPI_XFER_TX | SPI_XFER_16BIT, TimeOut);
+}
+
+/**
+  * @brief SPI_FillDMA Send the same frame count times with DMA (fixed source address).
+  * @param bus the SPI bus, Frame the frame, count: number of frames, frame16 1: 16 bit frames,
+	* TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_FillDMA(s_spi_bus* bus, const void* Frame, uint16_t count, uint8_t frame16, uint32_t TimeOut)
+{
+	return SPI_BlockingDMA(bus, (void*) Frame, count, SPI_XFER_TX | SPI_XFER_FIXED | ((frame16) ? SPI_XFER_16BIT : 0), TimeOut);
 }
 
-#if defined (SPI1_W_DMA)
 void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi)
-{	e_dma_transfer_state* state;
-	state = GetTransferStatePtr(hspi);
-	*state = TRANSFER_COMPLETE;
+{
+	SPI_QueueDone(SPI_BUS(hspi), TRANSFER_COMPLETE);
 }
 
 void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef* hspi)
-{	e_dma_transfer_state* state;
-	state = GetTransferStatePtr(hspi);
-	*state = TRANSFER_COMPLETE;
+{
+	SPI_QueueDone(SPI_BUS(hspi), TRANSFER_COMPLETE);
 }
 
-void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+/*
+ * In 2 lines master mode the HAL receives with DMA as a transmit-receive transfer,
+ * so the end of the read comes here, and not to the HAL_SPI_RxCpltCallback.
+ */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* hspi)
 {
+	SPI_QueueDone(SPI_BUS(hspi), TRANSFER_COMPLETE);
+}
 
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+{
+	SPI_QueueDone(SPI_BUS(hspi), TRANSFER_ERROR);
 }
 
 #endif
-
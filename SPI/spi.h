@@ -1,5 +1,3 @@
-
-
 #ifndef __SPI_H
 #define __SPI_H
 
@@ -9,6 +7,27 @@
 #define SPI1_W_DMA
 #define SPI2_W_DMA
 
+/*
+ * If defined, the DMA queue counts the busy time of the buses with the DWT
+ * cycle counter (see spi_sched.h).
+ */
+#define SPI_BUS_STATS
+
+/*
+ * Pin writes of the chip select, data/command, and reset lines: one BSRR (set), or BRR (reset)
+ * store, no HAL call, and no read-modify-write of the ODR. The line macros of the drivers use them.
+ * In SPI_SIMULATION build the simulator follows the lines through SPI_PinHigh(), and SPI_PinLow().
+ */
+#if defined (SPI_SIMULATION)
+void SPI_PinHigh(GPIO_TypeDef* port, uint16_t pin);
+void SPI_PinLow(GPIO_TypeDef* port, uint16_t pin);
+#define SPI_PIN_HIGH(port, pin)	SPI_PinHigh((port), (pin))
+#define SPI_PIN_LOW(port, pin)	SPI_PinLow((port), (pin))
+#else
+#define SPI_PIN_HIGH(port, pin)	((port)->BSRR = (pin))
+#define SPI_PIN_LOW(port, pin)	((port)->BRR = (pin))
+#endif
+
 #if defined (SPI1_W_DMA) | defined (SPI2_W_DMA)
 
 /*
@@ -21,59 +40,331 @@ typedef enum {
 	TRANSFER_ERROR
 } e_dma_transfer_state;
 
+/* The DMA transfer counter is 16 bits wide, this is the largest transfer size. */
+#define SPI_DMA_MAX_SIZE	0xFFFF
+
+/*
+ * Flags of the queued transfer descriptors.
+ */
+
+#define SPI_XFER_TX			0x00	// Memory to SPI transfer.
+#define SPI_XFER_RX			0x01	// SPI to memory transfer. The bus sends 0xFF bytes meanwhile.
+#define SPI_XFER_DATA		0x02	// DC line high (data) during the transfer, else low (command). Only if the bus has DC line.
+#define SPI_XFER_CS_HOLD	0x04	// Keep the chip select active after the transfer, the next descriptor continues the transaction.
+#define SPI_XFER_RAW		0x08	// The queue does not drive the CS and DC lines, the caller does.
+#define SPI_XFER_16BIT		0x10	// 16 bit SPI frames, and half-word DMA. The buffer holds native uint16_t values, the size is still in bytes.
+#define SPI_XFER_FIXED		0x20	// Fixed source: the buffer is one frame, the DMA sends it size times (memory increment off). The size is the frame count.
+
+struct s_spi_xfer;
+
+/* @brief Transfer complete callback. Called from the DMA interrupt, when the
+ * transfer is done, or it was failed. It may submit new transfers. */
+typedef void (*spi_xfer_callback)(struct s_spi_xfer* xfer, e_dma_transfer_state state);
+
+/*
+ * Queued DMA transfer descriptor. The caller owns the descriptor and the buffer,
+ * they must be valid until the callback (or until the bus queue is empty).
+ */
+
+typedef struct s_spi_xfer {
+	struct s_spi_xfer* next;	// Queue link. Filled by the queue.
+	void* buffer;				// Data buffer of the transfer.
+	uint16_t size;				// Size of the transfer in bytes.
+	uint8_t flags;				// SPI_XFER_xxx flags.
+	spi_xfer_callback callback;	// Complete callback, or NULL.
+	void* arg;					// User argument for the callback.
+} s_spi_xfer;
+
+#endif
+
+/*
+ * SPI bus context. Every SPI channel has one persistent bus object, and the
+ * drivers pass it by pointer, so the HAL state machine always runs on the
+ * same handle, and no handle copy is made for the transfers.
+ * The HAL handle must be the first member, because the HAL callbacks give
+ * back only the handle pointer, and SPI_BUS() converts it to the bus context.
+ */
+
+typedef struct {
+	SPI_HandleTypeDef handle;		// HAL SPI handle of the bus. Must be the first member!
+	GPIO_TypeDef* cs_port;			// Chip select line of the device on the bus.
+	uint16_t cs_pin;
+	GPIO_TypeDef* dc_port;			// Data/command line of the device, NULL if there is not.
+	uint16_t dc_pin;
+	uint32_t write_prescaler;		// Clock profile of the device: SPI_BAUDRATEPRESCALER_xxx of the writes,
+	uint32_t read_prescaler;		// and of the reads. SPI_Init sets both to Init.BaudRatePrescaler.
+#if defined (SPI1_W_DMA) | defined (SPI2_W_DMA)
+	volatile e_dma_transfer_state dma_state;	// State of the last DMA transfer on the bus.
+	s_spi_xfer* volatile queue_head;	// The running transfer, NULL if the queue is idle.
+	s_spi_xfer* queue_tail;				// The last queued transfer.
+	volatile uint8_t xfer_running;		// The DMA runs the first transfer of the queue.
 #endif
+#if defined (SPI_BUS_STATS)
+	uint32_t stat_busy_cycles;		// CPU cycles while the bus DMA was running.
+	uint32_t stat_start;			// Cycle counter at the start of the running transfer.
+	uint32_t stat_bytes;			// Bytes moved by the DMA.
+	uint32_t stat_xfers;			// Number of DMA transfers.
+#endif
+} s_spi_bus;
+
+/* @brief SPI_BUS(handle) The bus context of the HAL SPI handle. */
+#define SPI_BUS(__HANDLE__)	((s_spi_bus*)(__HANDLE__))
 
+/* The STM32F103xB has two SPI channels. */
+#define SPI_MAX_BUSES	2
 
+/* The initialized buses (SPI_Init registers them). */
+extern s_spi_bus* spi_buses[SPI_MAX_BUSES];
+extern uint8_t spi_bus_count;
 
-/* @brief SPI_Init(SPI channel) Initialize on the got parameter SPI channel */
-void SPI_Init(SPI_HandleTypeDef* SPI_Chan);
+/* @brief SPI_Init(SPI bus) Initialize on the got parameter SPI bus */
+void SPI_Init(s_spi_bus* bus);
 
 /**
   * @brief SPI WriteByte a byte to device General SPI write byte procedure.
-  * @param Value the byte to written, TimeOut the timeout value to write. 
+  * @param bus the SPI bus, Value the byte to written, TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_WriteByte(s_spi_bus* bus, uint8_t Value, uint32_t TimeOut);
+
+/**
+  * @brief SPI_ReadByte Read a byte from SPI bus.
+  * @param bus the SPI bus, Value the byte to read, TimeOut the timeout value to read.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_ReadByte(s_spi_bus* bus, uint8_t* Value, uint32_t TimeOut);
+
+/**
+  * @brief SPI_WriteBuf Write buffer bytes to the selected SPI bus.
+  * @param bus the SPI bus, Buffer the pointer for buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_WriteBuf(s_spi_bus* bus, const void* Buffer, uint16_t size, uint32_t TimeOut);
+
+/**
+  * @brief SPI_ReadBuf Read size of byte to the Buffer from SPI bus.
+  * @param bus the SPI bus, Buffer the read buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to read.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPI_ReadBuf(s_spi_bus* bus, void* Buffer, uint16_t size, uint32_t TimeOut);
+
+/**
+  * @brief HAL_StatusTypeDef SPI_WriteBufDMA Write buffer bytes to the selected SPI bus with DMA
+  * @param bus the SPI bus, Buffer the pointer for buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_WriteBufDMA(s_spi_bus* bus, const void* Buffer, uint16_t size, uint32_t TimeOut);
+
+/**
+  * @brief HAL_StatusTypeDef SPI_ReadBufDMA Read size of byte to the Buffer from SPI bus with DMA.
+  * The bus sends 0xFF bytes while it receives.
+  * @param bus the SPI bus, Buffer the read buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to read.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPI_ReadBufDMA(s_spi_bus* bus, void* Buffer, uint16_t size, uint32_t TimeOut);
+
+/**
+  * @brief HAL_StatusTypeDef SPI_WriteBufDMA16 Write uint16_t values to the selected SPI bus with DMA
+  * in 16 bit frames (most significant byte first).
+  * @param bus the SPI bus, Buffer the pointer for buffer, size: size of buffer in bytes
+	* TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_WriteBufDMA16(s_spi_bus* bus, const void* Buffer, uint16_t size, uint32_t TimeOut);
+
+/**
+  * @brief HAL_StatusTypeDef SPI_FillDMA Send the same frame count times with DMA, the memory increment
+  * of the TX channel is off, so there is no buffer, and no CPU work between the frames.
+  * @param bus the SPI bus, Frame the frame (uint8_t, or native uint16_t), count: number of frames
+  * (max. SPI_DMA_MAX_SIZE), frame16 1: 16 bit frames, TimeOut the timeout value to write.
+  * @retval HAL status
+  */
+
+HAL_StatusTypeDef SPI_FillDMA(s_spi_bus* bus, const void* Frame, uint16_t count, uint8_t frame16, uint32_t TimeOut);
+
+/**
+  * @brief SPI_SetFrameSize Switch the SPI, and its DMA channels between 8, and 16 bit frames.
+  * The bus must be idle. The queue switches the frame size for the SPI_XFER_16BIT transfers, and
+  * switches back to 8 bit when it becomes empty, so the idle bus is always in 8 bit mode.
+  * @param bus the SPI bus, frame16 1: 16 bit frames, 0: 8 bit frames.
   * @retval None
   */
-	
-void SPI_WriteByte(uint8_t Value, SPI_HandleTypeDef handle, uint32_t TimeOut);
+
+void SPI_SetFrameSize(s_spi_bus* bus, uint8_t frame16);
+
+/*
+ * SPI clock profiles. Every device has its own write, and read clock (the read clock is slower
+ * on the displays). The fastest prescaler comes from the maximum rate of the device, and the
+ * negotiation checks it with the device specific readback, and steps down on errors.
+ */
+
+/* The STM32F103 SPI clock limit (datasheet: 18 MHz). */
+#define SPI_MAX_HZ	18000000
+
+/* Number of the successful readback checks on a clock, before it is accepted. */
+#define SPI_CLOCK_CHECKS	4
+
+/* @brief Readback check of the negotiation. The bus runs at the candidate clock. Gives back HAL_OK if
+ * the device gave back the known data. */
+typedef HAL_StatusTypeDef (*spi_clock_check)(s_spi_bus* bus, void* arg);
+
+/**
+  * @brief SPI_BusClock The peripheral clock of the SPI bus (SPI1: APB2, SPI2: APB1).
+  * @param bus the SPI bus.
+  * @retval the clock in Hz.
+  */
+
+uint32_t SPI_BusClock(s_spi_bus* bus);
+
+/**
+  * @brief SPI_PrescalerFor The fastest prescaler for the maximum SPI clock rate of the device.
+  * @param bus the SPI bus, max_hz the maximum clock rate of the device in Hz.
+  * @retval SPI_BAUDRATEPRESCALER_xxx (SPI_BAUDRATEPRESCALER_256, if even that is too fast).
+  */
+
+uint32_t SPI_PrescalerFor(s_spi_bus* bus, uint32_t max_hz);
+
+/**
+  * @brief SPI_ClockHz The SPI clock rate with the prescaler.
+  * @param bus the SPI bus, prescaler SPI_BAUDRATEPRESCALER_xxx.
+  * @retval the clock in Hz.
+  */
+
+uint32_t SPI_ClockHz(s_spi_bus* bus, uint32_t prescaler);
+
+/**
+  * @brief SPI_SetPrescaler Change the SPI clock of the bus, without the HAL reinitialization. The bus must be idle.
+  * @param bus the SPI bus, prescaler SPI_BAUDRATEPRESCALER_xxx.
+  * @retval None
+  */
+
+void SPI_SetPrescaler(s_spi_bus* bus, uint32_t prescaler);
+
+/**
+  * @brief SPI_ClockNegotiate Find the fastest reliable clock of the device. It starts at the
+  * prescaler of max_hz, and steps down while the check fails. The bus stays on the found clock.
+  * @param bus the SPI bus, max_hz the maximum clock rate of the device, check the readback check,
+  * arg the argument of the check, prescaler the found SPI_BAUDRATEPRESCALER_xxx.
+  * @retval HAL_OK, or HAL_ERROR if the check fails even on the slowest clock.
+  */
+
+HAL_StatusTypeDef SPI_ClockNegotiate(s_spi_bus* bus, uint32_t max_hz, spi_clock_check check, void* arg, uint32_t* prescaler);
+
+/* @brief SPI_ClockWrite(bus), SPI_ClockRead(bus) Switch the bus to the write, or to the read clock of the device. */
+static inline void SPI_ClockWrite(s_spi_bus* bus) { SPI_SetPrescaler(bus, bus->write_prescaler); }
+static inline void SPI_ClockRead(s_spi_bus* bus) { SPI_SetPrescaler(bus, bus->read_prescaler); }
+
+#if defined (SPI1_W_DMA) | defined (SPI2_W_DMA)
+
+/*
+ * Asynchronous DMA transfer queue. Every bus has its own queue, the transfer complete
+ * DMA interrupt starts the next descriptor, so the CPU is free while the bus is busy.
+ * The blocking DMA transfers of the bus go through the queue as well, after the queued ones.
+ * The register level and the HAL polling transfers need the idle queue.
+ */
 
 /**
-  * @brief SPI_ReadByte Read a byte from SPI port designated by handle.
-  * @param Value the byte to read, TimeOut the timeout value to read. 
+  * @brief SPI_XferInit Fill a transfer descriptor.
+  * @param xfer the descriptor, buffer, size the data, flags SPI_XFER_xxx flags,
+  * callback the complete callback (or NULL), arg user argument of the callback.
   * @retval None
   */
 
-void SPI_ReadByte(uint8_t* Value, SPI_HandleTypeDef handle, uint32_t TimeOut);
+void SPI_XferInit(s_spi_xfer* xfer, void* buffer, uint16_t size, uint8_t flags, spi_xfer_callback callback, void* arg);
 
 /**
-  * @brief SPI_WriteBuf Write buffer bytes to the selected SPI port.
-  * @param Value the pointer for buffer, size: size of buffer in bytes 
-	* TimeOut the timeout value to write. 
+  * @brief SPI_QueueSubmit Add a transfer to the queue of the bus. If the bus is idle
+  * the transfer starts immediately. Callable from the complete callbacks as well.
+  * @param bus the SPI bus, xfer the transfer descriptor.
   * @retval None
   */
 
-void SPI_WriteBuf(void* Value, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut);
+void SPI_QueueSubmit(s_spi_bus* bus, s_spi_xfer* xfer);
 
 /**
-  * @brief SPI_ReadBuf Read size of byte to the Buffer from SPI port designated by handle.
-  * @param Value the byte to read, TimeOut the timeout value to read. 
+  * @brief SPI_QueueSubmitChain Add a linked list of transfers (a DMA program) to the queue of
+  * the bus at once. The descriptors are linked with their next member, the last one's next is NULL.
+  * The DMA interrupt walks the chain, and drives the CS and DC lines between the steps, so the
+  * whole chain runs without the caller.
+  * @param bus the SPI bus, first the first descriptor of the chain.
   * @retval None
   */
-void SPI_ReadBuf(uint8_t* Buffer, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut);
+
+void SPI_QueueSubmitChain(s_spi_bus* bus, s_spi_xfer* first);
 
 /**
-  * @brief HAL_StatusTypeDef SPI_WriteBufDMA Write buffer bytes to the selected SPI port with DMA
-  * @param Value the pointer for buffer, size: size of buffer in bytes
-	* TimeOut the timeout value to write.
+  * @brief SPI_QueueBusy Is there running, or waiting transfer on the bus?
+  * @param bus the SPI bus.
+  * @retval 0 if the queue is empty.
+  */
+
+inline static uint8_t SPI_QueueBusy(s_spi_bus* bus) { return bus->queue_head != NULL; }
+
+/**
+  * @brief SPI_QueueFlush Wait until all of the queued transfers are done.
+  * @param bus the SPI bus, TimeOut timeout in milliseconds.
+  * @retval HAL_OK, or HAL_TIMEOUT.
+  */
+
+HAL_StatusTypeDef SPI_QueueFlush(s_spi_bus* bus, uint32_t TimeOut);
+
+/**
+  * @brief SPI_QueueAbort Stop the running transfer, and drop the queue. The callbacks
+  * of the dropped transfers get TRANSFER_ERROR state.
+  * @param bus the SPI bus.
   * @retval None
   */
 
-HAL_StatusTypeDef SPI_WriteBufDMA(void* Value, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut);
+void SPI_QueueAbort(s_spi_bus* bus);
+
+#endif
+
+/*
+ * Register level full-duplex transfers. These talk to the SPIx->DR/SR directly,
+ * without the HAL state machine, and without timeout setup, so the byte-at-a-time
+ * protocols (SD card token polling, R1/R3/R7 responses, commands) run at wire speed.
+ * The SPI must be enabled (SPI_Init does it), and there must not be running
+ * DMA transfer on the bus.
+ */
+
+/**
+  * @brief SPI_Exchange Send a byte, and give back the byte received the same time.
+  * @param bus the SPI bus, Value the byte to send.
+  * @retval the received byte.
+  */
+
+#if defined (SPI_SIMULATION)
+/* The host simulator (sim/) clocks the bytes through its device models. */
+uint8_t SPI_Exchange(s_spi_bus* bus, uint8_t Value);
+#else
+static inline uint8_t SPI_Exchange(s_spi_bus* bus, uint8_t Value)
+{	SPI_TypeDef* spi = bus->handle.Instance;
+	while (!(spi->SR & SPI_SR_TXE)) {};
+	*(__IO uint8_t*)&spi->DR = Value;
+	while (!(spi->SR & SPI_SR_RXNE)) {};
+	return *(__IO uint8_t*)&spi->DR;
+}
+#endif
 
 /**
-  * @brief HAL_StatusTypeDef SPI_ReadBufDMA Read size of byte to the Buffer from SPI port designated by handle with DMA
-  * @param Value the byte to read, TimeOut the timeout value to read.
+  * @brief SPI_ExchangeBuf Full-duplex burst transfer. The next byte is written to
+  * the data register while the previous one is shifting, so there is no gap
+  * between the bytes on the wire.
+  * @param bus the SPI bus, TxBuffer the bytes to send (NULL: send 0xFF bytes),
+  * RxBuffer the received bytes (NULL: drop the received bytes), size in bytes.
+  * In SPI_SIMULATION build the simulator gives it.
   * @retval None
   */
-HAL_StatusTypeDef SPI_ReadBufDMA(uint8_t* Buffer, uint16_t size, SPI_HandleTypeDef handle, uint32_t TimeOut);
+
+void SPI_ExchangeBuf(s_spi_bus* bus, const uint8_t* TxBuffer, uint8_t* RxBuffer, uint16_t size);
 
 #endif
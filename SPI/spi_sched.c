@@ -0,0 +1,178 @@
+
+#include "spi_sched.h"
+
+/**
+  * @brief SPI_PipeInit Prepare the pipe to move count buffers.
+  * @param pipe the pipe, src_bus, dst_bus the buses, buffers SPI_PIPE_SLOTS buffers,
+  * count the number of buffers to move, fill, drain the start functions, arg user argument.
+  * @retval None
+  */
+
+void SPI_PipeInit(s_spi_pipe* pipe, s_spi_bus* src_bus, s_spi_bus* dst_bus, uint8_t* buffers[], uint32_t count,
+		spi_pipe_start fill, spi_pipe_start drain, void* arg)
+{	int i;
+	pipe->src_bus = src_bus;
+	pipe->dst_bus = dst_bus;
+	for (i = 0; i < SPI_PIPE_SLOTS; i++)
+	{
+		pipe->buffer[i] = buffers[i];
+		pipe->length[i] = 0;
+		pipe->state[i] = PIPE_FREE;
+	}
+	pipe->fill_slot = 0;
+	pipe->drain_slot = 0;
+	pipe->fills = count;
+	pipe->drains = count;
+	pipe->fill = fill;
+	pipe->drain = drain;
+	pipe->arg = arg;
+	pipe->error = 0;
+}
+
+void SPI_PipeFilled(s_spi_pipe* pipe, uint8_t slot, uint16_t length)
+{
+	pipe->length[slot] = length;
+	pipe->state[slot] = PIPE_FULL;
+}
+
+void SPI_PipeDrained(s_spi_pipe* pipe, uint8_t slot)
+{
+	pipe->state[slot] = PIPE_FREE;
+}
+
+/* @brief SPI_PipeDrainNext(pipe) Start the next destination transfer, if its bus is free, and its buffer is full. @retval 0 on error. */
+
+static uint8_t SPI_PipeDrainNext(s_spi_pipe* pipe)
+{	uint8_t slot = pipe->drain_slot;
+	if ((pipe->drains) && (pipe->state[slot] == PIPE_FULL) && ((pipe->dst_bus == NULL) || !SPI_QueueBusy(pipe->dst_bus)))
+	{
+		pipe->state[slot] = PIPE_DRAINING;
+		if (!pipe->drain(pipe, slot)) return 0;
+		pipe->drains--;
+		pipe->drain_slot = (slot + 1) % SPI_PIPE_SLOTS;
+	}
+	return 1;
+}
+
+/* @brief SPI_PipeFillNext(pipe) Start the next source transfer, if its bus is free, and its buffer is free. @retval 0 on error. */
+
+static uint8_t SPI_PipeFillNext(s_spi_pipe* pipe)
+{	uint8_t slot = pipe->fill_slot;
+	if ((pipe->fills) && (pipe->state[slot] == PIPE_FREE) && ((pipe->src_bus == NULL) || !SPI_QueueBusy(pipe->src_bus)))
+	{
+		pipe->state[slot] = PIPE_FILLING;
+		if (!pipe->fill(pipe, slot)) return 0;
+		pipe->fills--;
+		pipe->fill_slot = (slot + 1) % SPI_PIPE_SLOTS;
+	}
+	return 1;
+}
+
+/**
+  * @brief SPI_PipePoll Start the next source, and destination transfer if their bus and buffer
+  * are free.
+  * @param pipe the pipe.
+  * @retval HAL_BUSY while the pipe runs, HAL_OK at the end, HAL_ERROR if a transfer was failed.
+  */
+
+HAL_StatusTypeDef SPI_PipePoll(s_spi_pipe* pipe)
+{	uint8_t slot, ok;
+
+	if (pipe->error) return HAL_ERROR;
+
+	/* The destination first: the earlier it starts, the earlier its buffer becomes free. If the CPU
+	 * drains, the source first: its transfer runs while the CPU works on the other buffer. */
+	if (pipe->dst_bus)
+	{
+		ok = SPI_PipeDrainNext(pipe) && SPI_PipeFillNext(pipe);
+	} else ok = SPI_PipeFillNext(pipe) && SPI_PipeDrainNext(pipe);
+	if (!ok)
+	{
+		pipe->error = 1;
+		return HAL_ERROR;
+	}
+
+	if (pipe->drains) return HAL_BUSY;
+	/* The last destination transfer is still running? */
+	for (slot = 0; slot < SPI_PIPE_SLOTS; slot++)
+	{
+		if (pipe->state[slot] != PIPE_FREE) return HAL_BUSY;
+	}
+	return HAL_OK;
+}
+
+/* @brief SPI_PipeRun(pipe, TimeOut) Run the pipe until the end. */
+
+HAL_StatusTypeDef SPI_PipeRun(s_spi_pipe* pipe, uint32_t TimeOut)
+{	HAL_StatusTypeDef status; uint32_t tickstart = HAL_GetTick();
+	while ((status = SPI_PipePoll(pipe)) == HAL_BUSY)
+	{
+		if ((HAL_GetTick() - tickstart) > TimeOut)
+		{
+			if (pipe->src_bus) SPI_QueueAbort(pipe->src_bus);
+			if (pipe->dst_bus) SPI_QueueAbort(pipe->dst_bus);
+			return HAL_TIMEOUT;
+		}
+	}
+	if (status == HAL_ERROR)
+	{
+		/* Wait for the running transfers, the buffers are the caller's. */
+		if (pipe->src_bus) SPI_QueueFlush(pipe->src_bus, TimeOut);
+		if (pipe->dst_bus) SPI_QueueFlush(pipe->dst_bus, TimeOut);
+	}
+	return status;
+}
+
+#if defined (SPI_BUS_STATS)
+
+extern uint32_t spi_overlap_cycles;
+
+/* Start of the measurement window. */
+static uint32_t stats_window_start;
+
+static void SPI_StatsClear(s_spi_bus* bus)
+{
+	bus->stat_busy_cycles = 0;
+	bus->stat_bytes = 0;
+	bus->stat_xfers = 0;
+}
+
+/* @brief SPI_StatsReset(void) Start a new measurement window on all of the buses. */
+
+void SPI_StatsReset(void)
+{	uint32_t primask = __get_PRIMASK(); int i;
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	__disable_irq();
+	for (i = 0; i < spi_bus_count; i++)
+	{
+		SPI_StatsClear(spi_buses[i]);
+	}
+	spi_overlap_cycles = 0;
+	stats_window_start = DWT->CYCCNT;
+	__set_PRIMASK(primask);
+}
+
+/* @brief SPI_StatsGet(bus, stats) The utilization of the bus since the SPI_StatsReset. */
+
+void SPI_StatsGet(s_spi_bus* bus, s_spi_bus_stats* stats)
+{	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	stats->window_cycles = DWT->CYCCNT - stats_window_start;
+	stats->busy_cycles = bus->stat_busy_cycles;
+	stats->overlap_cycles = spi_overlap_cycles;
+	stats->bytes = bus->stat_bytes;
+	stats->xfers = bus->stat_xfers;
+	__set_PRIMASK(primask);
+	if (stats->window_cycles)
+	{
+		stats->utilization = (uint16_t)(((uint64_t)stats->busy_cycles * 1000) / stats->window_cycles);
+		stats->overlap = (uint16_t)(((uint64_t)stats->overlap_cycles * 1000) / stats->window_cycles);
+	} else
+	{
+		stats->utilization = 0;
+		stats->overlap = 0;
+	}
+}
+
+#endif
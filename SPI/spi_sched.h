@@ -0,0 +1,106 @@
+#ifndef __SPI_SCHED_H
+#define __SPI_SCHED_H
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "spi.h"
+
+/*
+ * SPI bus scheduler. A pipe moves the data between two buses (for example from the
+ * SD card to the display) through a few buffers. The source bus fills the next buffer
+ * while the destination bus drains the previous one, so both buses are busy at once.
+ * The source may be the CPU as well (no source bus): the fill function makes the data
+ * (decode, convert, generate) in the thread, while the destination bus drains the other buffer.
+ * Or the destination (no destination bus): the drain function takes the data (convert, check) in
+ * the thread, while the source bus fills the other buffer.
+ */
+
+/* Number of the buffers in a pipe. */
+#define SPI_PIPE_SLOTS	2
+
+/* @brief State of a pipe buffer. */
+typedef enum {
+	PIPE_FREE,			// Empty, it may be filled.
+	PIPE_FILLING,		// The source transfer runs into it.
+	PIPE_FULL,			// Filled, it waits for the destination.
+	PIPE_DRAINING		// The destination transfer runs from it.
+} e_pipe_slot_state;
+
+struct s_spi_pipe;
+
+/* @brief Start the transfer of a pipe buffer. Called from the thread (SPI_PipePoll), so it
+ * may run blocking protocol phases. When the transfer is done, the transfer (typically its
+ * complete callback) must call SPI_PipeFilled() or SPI_PipeDrained().
+ * @retval 0 if the transfer could not start. */
+typedef uint8_t (*spi_pipe_start)(struct s_spi_pipe* pipe, uint8_t slot);
+
+typedef struct s_spi_pipe {
+	s_spi_bus* src_bus;		// The bus of the source transfers, NULL: the CPU fills the buffers.
+	s_spi_bus* dst_bus;		// The bus of the destination transfers, NULL: the CPU drains the buffers.
+	uint8_t* buffer[SPI_PIPE_SLOTS];	// The buffers.
+	uint16_t length[SPI_PIPE_SLOTS];	// Valid bytes in the buffers.
+	volatile e_pipe_slot_state state[SPI_PIPE_SLOTS];
+	uint8_t fill_slot;			// The next buffer to fill.
+	uint8_t drain_slot;			// The next buffer to drain.
+	uint32_t fills;				// Remaining source transfers.
+	uint32_t drains;			// Remaining destination transfers.
+	spi_pipe_start fill;		// Start a source transfer.
+	spi_pipe_start drain;		// Start a destination transfer.
+	void* arg;					// User argument of the start functions.
+	volatile uint8_t error;		// A transfer was failed.
+} s_spi_pipe;
+
+/**
+  * @brief SPI_PipeInit Prepare the pipe to move count buffers.
+  * @param pipe the pipe, src_bus, dst_bus the buses (src_bus NULL: the fill function makes the data,
+  * and calls SPI_PipeFilled() before it returns, dst_bus NULL: the drain function takes the data, and
+  * calls SPI_PipeDrained() before it returns), buffers SPI_PIPE_SLOTS buffers,
+  * count the number of buffers to move, fill, drain the start functions, arg user argument.
+  * @retval None
+  */
+void SPI_PipeInit(s_spi_pipe* pipe, s_spi_bus* src_bus, s_spi_bus* dst_bus, uint8_t* buffers[], uint32_t count,
+		spi_pipe_start fill, spi_pipe_start drain, void* arg);
+
+/* @brief SPI_PipeFilled(pipe, slot, length) The source transfer of the buffer is done. */
+void SPI_PipeFilled(s_spi_pipe* pipe, uint8_t slot, uint16_t length);
+
+/* @brief SPI_PipeDrained(pipe, slot) The destination transfer of the buffer is done. */
+void SPI_PipeDrained(s_spi_pipe* pipe, uint8_t slot);
+
+/* @brief SPI_PipeFailed(pipe) A transfer of the pipe was failed. */
+inline static void SPI_PipeFailed(s_spi_pipe* pipe) { pipe->error = 1; }
+
+/**
+  * @brief SPI_PipePoll Start the next source, and destination transfer if their bus and buffer
+  * are free. Call it from the main loop, the CPU may do anything else between the calls.
+  * @param pipe the pipe.
+  * @retval HAL_BUSY while the pipe runs, HAL_OK at the end, HAL_ERROR if a transfer was failed.
+  */
+HAL_StatusTypeDef SPI_PipePoll(s_spi_pipe* pipe);
+
+/* @brief SPI_PipeRun(pipe, TimeOut) Run the pipe until the end. */
+HAL_StatusTypeDef SPI_PipeRun(s_spi_pipe* pipe, uint32_t TimeOut);
+
+#if defined (SPI_BUS_STATS)
+
+/* @brief Utilization of a bus in a measurement window. */
+typedef struct {
+	uint32_t window_cycles;		// Length of the window in CPU cycles.
+	uint32_t busy_cycles;		// The bus DMA was running so long.
+	uint32_t overlap_cycles;	// Both buses were busy so long.
+	uint32_t bytes;				// Bytes moved by the bus DMA.
+	uint32_t xfers;				// Number of the DMA transfers.
+	uint16_t utilization;		// busy / window in per mille.
+	uint16_t overlap;			// overlap / window in per mille.
+} s_spi_bus_stats;
+
+/* @brief SPI_StatsReset(void) Start a new measurement window on all of the buses. It enables
+ * the DWT cycle counter, the window must be shorter than the counter wrap (~59 s at 72 MHz). */
+void SPI_StatsReset(void);
+
+/* @brief SPI_StatsGet(bus, stats) The utilization of the bus since the SPI_StatsReset. */
+void SPI_StatsGet(s_spi_bus* bus, s_spi_bus_stats* stats);
+
+#endif
+
+#endif
@@ -0,0 +1,318 @@
+#ifndef __STM32F1xx_HAL_H
+#define __STM32F1xx_HAL_H
+
+/*
+ * Host simulator replacement of the STM32F1 HAL, and of the CMSIS device header.
+ * Only the parts used by the SPI, SD card, and display drivers are here. The
+ * peripheral registers are plain memory, the HAL functions, and the register
+ * level SPI exchange are implemented by the simulator (sim.c), which models the
+ * SPI clock, the CS/DC lines, and the DMA completion interrupts.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO	volatile
+
+/* ------------------------------ HAL status ------------------------------ */
+
+typedef enum {
+	HAL_OK			= 0x00U,
+	HAL_ERROR		= 0x01U,
+	HAL_BUSY		= 0x02U,
+	HAL_TIMEOUT		= 0x03U
+} HAL_StatusTypeDef;
+
+/* ------------------------------ Registers ------------------------------- */
+
+typedef struct {
+	__IO uint32_t CRL;
+	__IO uint32_t CRH;
+	__IO uint32_t IDR;
+	__IO uint32_t ODR;
+	__IO uint32_t BSRR;
+	__IO uint32_t BRR;
+	__IO uint32_t LCKR;
+} GPIO_TypeDef;
+
+typedef struct {
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	__IO uint32_t SR;
+	__IO uint32_t DR;
+	__IO uint32_t CRCPR;
+	__IO uint32_t RXCRCR;
+	__IO uint32_t TXCRCR;
+	__IO uint32_t I2SCFGR;
+	__IO uint32_t I2SPR;
+} SPI_TypeDef;
+
+typedef struct {
+	__IO uint32_t CCR;
+	__IO uint32_t CNDTR;
+	__IO uint32_t CPAR;
+	__IO uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+	__IO uint32_t CTRL;
+	__IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+	__IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern GPIO_TypeDef sim_gpioa, sim_gpiob, sim_gpioc;
+extern SPI_TypeDef sim_spi1, sim_spi2;
+extern DMA_Channel_TypeDef sim_dma1_channel[7];
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_coredebug;
+
+#define GPIOA	(&sim_gpioa)
+#define GPIOB	(&sim_gpiob)
+#define GPIOC	(&sim_gpioc)
+#define SPI1	(&sim_spi1)
+#define SPI2	(&sim_spi2)
+#define DMA1_Channel1	(&sim_dma1_channel[0])
+#define DMA1_Channel2	(&sim_dma1_channel[1])
+#define DMA1_Channel3	(&sim_dma1_channel[2])
+#define DMA1_Channel4	(&sim_dma1_channel[3])
+#define DMA1_Channel5	(&sim_dma1_channel[4])
+#define DMA1_Channel6	(&sim_dma1_channel[5])
+#define DMA1_Channel7	(&sim_dma1_channel[6])
+#define DWT			(&sim_dwt)
+#define CoreDebug	(&sim_coredebug)
+
+extern uint32_t SystemCoreClock;
+
+typedef enum {
+	DMA1_Channel1_IRQn	= 11,
+	DMA1_Channel2_IRQn	= 12,
+	DMA1_Channel3_IRQn	= 13,
+	DMA1_Channel4_IRQn	= 14,
+	DMA1_Channel5_IRQn	= 15,
+	DMA1_Channel6_IRQn	= 16,
+	DMA1_Channel7_IRQn	= 17
+} IRQn_Type;
+
+/* Register bits (stm32f103xb.h, core_cm3.h). */
+
+#define SPI_CR1_CPHA		0x0001U
+#define SPI_CR1_CPOL		0x0002U
+#define SPI_CR1_MSTR		0x0004U
+#define SPI_CR1_BR_Pos		(3U)
+#define SPI_CR1_BR			0x0038U
+#define SPI_CR1_BR_0		0x0008U
+#define SPI_CR1_BR_1		0x0010U
+#define SPI_CR1_BR_2		0x0020U
+#define SPI_CR1_SPE			0x0040U
+#define SPI_CR1_SSI			0x0100U
+#define SPI_CR1_SSM			0x0200U
+#define SPI_CR1_DFF			0x0800U
+
+#define SPI_SR_RXNE			0x0001U
+#define SPI_SR_TXE			0x0002U
+#define SPI_SR_BSY			0x0080U
+
+#define DMA_CCR_EN			0x0001U
+#define DMA_CCR_DIR			0x0010U
+#define DMA_CCR_PINC		0x0040U
+#define DMA_CCR_MINC		0x0080U
+#define DMA_CCR_PSIZE		0x0300U
+#define DMA_CCR_PSIZE_0		0x0100U
+#define DMA_CCR_MSIZE		0x0C00U
+#define DMA_CCR_MSIZE_0		0x0400U
+#define DMA_CCR_PL			0x3000U
+
+#define DWT_CTRL_CYCCNTENA_Msk			0x00000001U
+#define CoreDebug_DEMCR_TRCENA_Msk		0x01000000U
+
+/* Interrupt mask. The DMA complete interrupts of the simulator wait while it is set. */
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+void __enable_irq(void);
+
+/* ---------------------------------- GPIO -------------------------------- */
+
+#define GPIO_PIN_0		((uint16_t)0x0001)
+#define GPIO_PIN_1		((uint16_t)0x0002)
+#define GPIO_PIN_2		((uint16_t)0x0004)
+#define GPIO_PIN_3		((uint16_t)0x0008)
+#define GPIO_PIN_4		((uint16_t)0x0010)
+#define GPIO_PIN_5		((uint16_t)0x0020)
+#define GPIO_PIN_6		((uint16_t)0x0040)
+#define GPIO_PIN_7		((uint16_t)0x0080)
+#define GPIO_PIN_8		((uint16_t)0x0100)
+#define GPIO_PIN_9		((uint16_t)0x0200)
+#define GPIO_PIN_10		((uint16_t)0x0400)
+#define GPIO_PIN_11		((uint16_t)0x0800)
+#define GPIO_PIN_12		((uint16_t)0x1000)
+#define GPIO_PIN_13		((uint16_t)0x2000)
+#define GPIO_PIN_14		((uint16_t)0x4000)
+#define GPIO_PIN_15		((uint16_t)0x8000)
+
+typedef enum {
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+#define GPIO_MODE_INPUT			0x00000000U
+#define GPIO_MODE_OUTPUT_PP		0x00000001U
+#define GPIO_MODE_OUTPUT_OD		0x00000011U
+#define GPIO_MODE_AF_PP			0x00000002U
+#define GPIO_MODE_AF_OD			0x00000012U
+#define GPIO_MODE_AF_INPUT		GPIO_MODE_INPUT
+#define GPIO_NOPULL				0x00000000U
+#define GPIO_PULLUP				0x00000001U
+#define GPIO_PULLDOWN			0x00000002U
+#define GPIO_SPEED_FREQ_LOW		0x00000002U
+#define GPIO_SPEED_FREQ_MEDIUM	0x00000001U
+#define GPIO_SPEED_FREQ_HIGH	0x00000003U
+
+typedef struct {
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+} GPIO_InitTypeDef;
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init);
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+
+/* ---------------------------------- DMA --------------------------------- */
+
+#define DMA_PERIPH_TO_MEMORY		0x00000000U
+#define DMA_MEMORY_TO_PERIPH		DMA_CCR_DIR
+#define DMA_PINC_ENABLE				DMA_CCR_PINC
+#define DMA_PINC_DISABLE			0x00000000U
+#define DMA_MINC_ENABLE				DMA_CCR_MINC
+#define DMA_MINC_DISABLE			0x00000000U
+#define DMA_PDATAALIGN_BYTE			0x00000000U
+#define DMA_PDATAALIGN_HALFWORD		DMA_CCR_PSIZE_0
+#define DMA_MDATAALIGN_BYTE			0x00000000U
+#define DMA_MDATAALIGN_HALFWORD		DMA_CCR_MSIZE_0
+#define DMA_NORMAL					0x00000000U
+#define DMA_PRIORITY_LOW			0x00000000U
+#define DMA_PRIORITY_MEDIUM			0x00001000U
+#define DMA_PRIORITY_HIGH			0x00002000U
+#define DMA_PRIORITY_VERY_HIGH		0x00003000U
+
+typedef struct {
+	uint32_t Direction;
+	uint32_t PeriphInc;
+	uint32_t MemInc;
+	uint32_t PeriphDataAlignment;
+	uint32_t MemDataAlignment;
+	uint32_t Mode;
+	uint32_t Priority;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef {
+	DMA_Channel_TypeDef* Instance;
+	DMA_InitTypeDef Init;
+	void* Parent;
+} DMA_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef* hdma);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef* hdma);
+
+#define __HAL_LINKDMA(__HANDLE__, __PPP_DMA_FIELD__, __DMA_HANDLE__)	\
+	do { (__HANDLE__)->__PPP_DMA_FIELD__ = &(__DMA_HANDLE__); (__DMA_HANDLE__).Parent = (__HANDLE__); } while (0)
+
+/* ---------------------------------- SPI --------------------------------- */
+
+#define SPI_MODE_SLAVE				0x00000000U
+#define SPI_MODE_MASTER				(SPI_CR1_MSTR | SPI_CR1_SSI)
+#define SPI_DIRECTION_2LINES		0x00000000U
+#define SPI_DATASIZE_8BIT			0x00000000U
+#define SPI_DATASIZE_16BIT			SPI_CR1_DFF
+#define SPI_POLARITY_LOW			0x00000000U
+#define SPI_POLARITY_HIGH			SPI_CR1_CPOL
+#define SPI_PHASE_1EDGE				0x00000000U
+#define SPI_PHASE_2EDGE				SPI_CR1_CPHA
+#define SPI_NSS_SOFT				SPI_CR1_SSM
+#define SPI_BAUDRATEPRESCALER_2		0x00000000U
+#define SPI_BAUDRATEPRESCALER_4		(SPI_CR1_BR_0)
+#define SPI_BAUDRATEPRESCALER_8		(SPI_CR1_BR_1)
+#define SPI_BAUDRATEPRESCALER_16	(SPI_CR1_BR_1 | SPI_CR1_BR_0)
+#define SPI_BAUDRATEPRESCALER_32	(SPI_CR1_BR_2)
+#define SPI_BAUDRATEPRESCALER_64	(SPI_CR1_BR_2 | SPI_CR1_BR_0)
+#define SPI_BAUDRATEPRESCALER_128	(SPI_CR1_BR_2 | SPI_CR1_BR_1)
+#define SPI_BAUDRATEPRESCALER_256	(SPI_CR1_BR_2 | SPI_CR1_BR_1 | SPI_CR1_BR_0)
+#define SPI_FIRSTBIT_MSB			0x00000000U
+#define SPI_TIMODE_DISABLE			0x00000000U
+#define SPI_CRCCALCULATION_DISABLE	0x00000000U
+
+typedef struct {
+	uint32_t Mode;
+	uint32_t Direction;
+	uint32_t DataSize;
+	uint32_t CLKPolarity;
+	uint32_t CLKPhase;
+	uint32_t NSS;
+	uint32_t BaudRatePrescaler;
+	uint32_t FirstBit;
+	uint32_t TIMode;
+	uint32_t CRCCalculation;
+	uint32_t CRCPolynomial;
+} SPI_InitTypeDef;
+
+typedef enum {
+	HAL_SPI_STATE_RESET		= 0x00U,
+	HAL_SPI_STATE_READY		= 0x01U,
+	HAL_SPI_STATE_BUSY		= 0x02U,
+	HAL_SPI_STATE_BUSY_TX	= 0x03U,
+	HAL_SPI_STATE_BUSY_RX	= 0x04U,
+	HAL_SPI_STATE_BUSY_TX_RX = 0x05U,
+	HAL_SPI_STATE_ERROR		= 0x06U
+} HAL_SPI_StateTypeDef;
+
+typedef struct __SPI_HandleTypeDef {
+	SPI_TypeDef* Instance;
+	SPI_InitTypeDef Init;
+	DMA_HandleTypeDef* hdmatx;
+	DMA_HandleTypeDef* hdmarx;
+	__IO HAL_SPI_StateTypeDef State;
+	__IO uint32_t ErrorCode;
+} SPI_HandleTypeDef;
+
+#define __HAL_SPI_ENABLE(__HANDLE__)	((__HANDLE__)->Instance->CR1 |= SPI_CR1_SPE)
+#define __HAL_SPI_DISABLE(__HANDLE__)	((__HANDLE__)->Instance->CR1 &= (~SPI_CR1_SPE))
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef* hspi);
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef* hspi);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef* hspi, uint8_t* pTxData, uint8_t* pRxData, uint16_t Size);
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef* hspi);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi);
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef* hspi);
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* hspi);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi);
+
+/* ------------------------------- RCC, NVIC ------------------------------ */
+
+#define __HAL_RCC_GPIOA_CLK_ENABLE()	do {} while (0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()	do {} while (0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()	do {} while (0)
+#define __HAL_RCC_SPI1_CLK_ENABLE()		do {} while (0)
+#define __HAL_RCC_SPI2_CLK_ENABLE()		do {} while (0)
+#define __HAL_RCC_DMA1_CLK_ENABLE()		do {} while (0)
+
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+
+/* ---------------------------------- Time -------------------------------- */
+
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+#endif
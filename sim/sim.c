@@ -0,0 +1,410 @@
+/*
+ * Simulator core: the simulated clock, the SPI buses, the DMA completion, and the
+ * HAL functions used by the drivers.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "spi.h"
+#include "sim.h"
+
+GPIO_TypeDef sim_gpioa, sim_gpiob, sim_gpioc;
+SPI_TypeDef sim_spi1, sim_spi2;
+DMA_Channel_TypeDef sim_dma1_channel[7];
+DWT_Type sim_dwt;
+CoreDebug_Type sim_coredebug;
+uint32_t SystemCoreClock = SIM_SYSCLK_HZ;
+
+/*
+ * Simulated bus. At most one DMA transfer runs on a bus (the transfer queue of the
+ * driver starts the next one from the complete callback).
+ */
+
+typedef struct {
+	SPI_TypeDef* spi;
+	GPIO_TypeDef* cs_port;
+	uint16_t cs_pin;
+	GPIO_TypeDef* dc_port;
+	uint16_t dc_pin;
+	s_sim_device* dev;
+	uint8_t selected;				// CS active.
+	uint8_t dc;						// DC level at the last edge.
+	SPI_HandleTypeDef* dma_handle;	// The handle of the running DMA transfer, NULL if none.
+	uint64_t dma_end;				// End of the running DMA transfer.
+	s_sim_bus_stats stats;
+} s_sim_bus;
+
+static s_sim_bus sim_buses[2] = {{.spi = &sim_spi1}, {.spi = &sim_spi2}};
+
+static uint64_t now_ps;
+static uint64_t cycles_last;
+static uint32_t primask;
+static uint8_t in_irq;
+
+static s_sim_bus* sim_bus(SPI_TypeDef* spi)
+{
+	return (spi == SPI1) ? &sim_buses[0] : &sim_buses[1];
+}
+
+void sim_attach(SPI_TypeDef* spi, GPIO_TypeDef* cs_port, uint16_t cs_pin, GPIO_TypeDef* dc_port, uint16_t dc_pin, s_sim_device* dev)
+{	s_sim_bus* bus = sim_bus(spi);
+	bus->cs_port = cs_port;
+	bus->cs_pin = cs_pin;
+	bus->dc_port = dc_port;
+	bus->dc_pin = dc_pin;
+	bus->dev = dev;
+	if (dev->reset) dev->reset(dev);
+}
+
+s_sim_bus_stats* sim_stats(SPI_TypeDef* spi)
+{
+	return &sim_bus(spi)->stats;
+}
+
+void sim_stats_reset()
+{
+	memset(&sim_buses[0].stats, 0, sizeof(s_sim_bus_stats));
+	memset(&sim_buses[1].stats, 0, sizeof(s_sim_bus_stats));
+}
+
+uint64_t sim_now()
+{
+	return now_ps;
+}
+
+uint64_t sim_byte_ps(SPI_TypeDef* spi)
+{	uint64_t pclk = (spi == SPI1) ? SIM_PCLK2_HZ : SIM_PCLK1_HZ;
+	uint64_t div = 2ULL << ((spi->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos);
+	return 8ULL * div * 1000000000000ULL / pclk;
+}
+
+/* @brief sim_set_time(ps) Move the clock, and the DWT cycle counter. */
+
+static void sim_set_time(uint64_t ps)
+{	uint64_t cycles;
+	if (ps <= now_ps) return;
+	now_ps = ps;
+	cycles = now_ps * (SIM_SYSCLK_HZ / 1000000) / 1000000;
+	if (sim_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) sim_dwt.CYCCNT += (uint32_t)(cycles - cycles_last);
+	cycles_last = cycles;
+}
+
+/* @brief sim_irq(bus) The DMA complete interrupt of the bus. */
+
+static void sim_irq(s_sim_bus* bus)
+{	SPI_HandleTypeDef* hspi = bus->dma_handle; HAL_SPI_StateTypeDef state = hspi->State;
+	bus->dma_handle = NULL;
+	hspi->State = HAL_SPI_STATE_READY;
+	in_irq = 1;
+	sim_set_time(now_ps + SIM_IRQ_PS);
+	switch (state)
+	{
+	case HAL_SPI_STATE_BUSY_TX:
+		HAL_SPI_TxCpltCallback(hspi);
+		break;
+	case HAL_SPI_STATE_BUSY_RX:
+		HAL_SPI_RxCpltCallback(hspi);
+		break;
+	default:
+		HAL_SPI_TxRxCpltCallback(hspi);
+	}
+	in_irq = 0;
+}
+
+void sim_advance(uint64_t ps)
+{	uint64_t target = now_ps + ps; s_sim_bus* next; int i;
+	while (!primask && !in_irq)
+	{
+		next = NULL;
+		for (i = 0; i < 2; i++)
+		{
+			if (sim_buses[i].dma_handle && (sim_buses[i].dma_end <= target) &&
+				((next == NULL) || (sim_buses[i].dma_end < next->dma_end))) next = &sim_buses[i];
+		}
+		if (next == NULL) break;
+		sim_set_time(next->dma_end);
+		sim_irq(next);
+	}
+	sim_set_time(target);
+}
+
+/* ------------------------------ Interrupt mask ----------------------------- */
+
+uint32_t __get_PRIMASK(void)
+{
+	return primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+	primask = priMask;
+	if (!primask) sim_advance(0);
+}
+
+void __disable_irq(void)
+{
+	primask = 1;
+}
+
+void __enable_irq(void)
+{
+	__set_PRIMASK(0);
+}
+
+/* ---------------------------------- GPIO ----------------------------------- */
+
+/* @brief sim_gpio_update() Follow the CS, and DC lines of the buses. */
+
+static void sim_gpio_update()
+{	s_sim_bus* bus; uint8_t cs, dc; int i;
+	for (i = 0; i < 2; i++)
+	{
+		bus = &sim_buses[i];
+		if (bus->cs_port == NULL) continue;
+		cs = !(bus->cs_port->ODR & bus->cs_pin);
+		if (cs != bus->selected)
+		{
+			bus->selected = cs;
+			if (cs) bus->stats.transactions++;
+			if (bus->dev->select) bus->dev->select(bus->dev, cs);
+		}
+		if (bus->dc_port)
+		{
+			dc = (bus->dc_port->ODR & bus->dc_pin) != 0;
+			if ((dc != bus->dc) && bus->selected) bus->stats.dc_edges++;
+			bus->dc = dc;
+		}
+	}
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init)
+{
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	if (PinState == GPIO_PIN_SET) GPIOx->ODR |= GPIO_Pin;
+	else GPIOx->ODR &= ~GPIO_Pin;
+	sim_gpio_update();
+	sim_advance(SIM_GPIO_HAL_PS);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	return ((GPIOx->IDR | GPIOx->ODR) & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/* The BSRR, BRR stores of the line macros (SPI_PIN_HIGH, SPI_PIN_LOW). */
+
+void SPI_PinHigh(GPIO_TypeDef* port, uint16_t pin)
+{
+	port->ODR |= pin;
+	sim_gpio_update();
+	sim_advance(SIM_GPIO_STORE_PS);
+}
+
+void SPI_PinLow(GPIO_TypeDef* port, uint16_t pin)
+{
+	port->ODR &= ~pin;
+	sim_gpio_update();
+	sim_advance(SIM_GPIO_STORE_PS);
+}
+
+/* ------------------------------- SPI wire ---------------------------------- */
+
+/* @brief sim_clock_byte(bus, mosi) One byte on the wire. The device sees it only with active CS. */
+
+static uint8_t sim_clock_byte(s_sim_bus* bus, uint8_t mosi)
+{
+	bus->stats.wire_bytes++;
+	bus->stats.wire_ps += sim_byte_ps(bus->spi);
+	if (bus->selected && bus->dev) return bus->dev->exchange(bus->dev, mosi, bus->dc);
+	return 0xFF;
+}
+
+/* @brief sim_clock_frame(bus, frame16, value) One 8, or 16 bit frame, MSB first. */
+
+static uint16_t sim_clock_frame(s_sim_bus* bus, uint8_t frame16, uint16_t value)
+{	uint16_t in;
+	if (!frame16) return sim_clock_byte(bus, value);
+	in = sim_clock_byte(bus, value >> 8) << 8;
+	return in | sim_clock_byte(bus, value);
+}
+
+static void sim_check_idle(s_sim_bus* bus)
+{
+	if (bus->dma_handle) bus->stats.conflicts++;
+}
+
+uint8_t SPI_Exchange(s_spi_bus* bus, uint8_t Value)
+{	s_sim_bus* sbus = sim_bus(bus->handle.Instance); uint8_t in;
+	sim_check_idle(sbus);
+	in = sim_clock_byte(sbus, Value);
+	sim_advance(sim_byte_ps(sbus->spi) + SIM_EXCHANGE_PS);
+	return in;
+}
+
+void SPI_ExchangeBuf(s_spi_bus* bus, const uint8_t* TxBuffer, uint8_t* RxBuffer, uint16_t size)
+{	s_sim_bus* sbus = sim_bus(bus->handle.Instance); uint8_t in; uint16_t i;
+	if (!size) return;
+	sim_check_idle(sbus);
+	for (i = 0; i < size; i++)
+	{
+		in = sim_clock_byte(sbus, (TxBuffer) ? TxBuffer[i] : 0xFF);
+		if (RxBuffer) RxBuffer[i] = in;
+	}
+	/* The burst has no gaps between the bytes. */
+	sim_advance(size * sim_byte_ps(sbus->spi) + SIM_EXCHANGE_PS);
+}
+
+/* ---------------------------------- HAL SPI -------------------------------- */
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef* hspi)
+{
+	hspi->Instance->CR1 = hspi->Init.Mode | hspi->Init.Direction | hspi->Init.DataSize | hspi->Init.CLKPolarity |
+			hspi->Init.CLKPhase | hspi->Init.NSS | hspi->Init.BaudRatePrescaler | hspi->Init.FirstBit;
+	hspi->Instance->SR = SPI_SR_TXE;
+	hspi->State = HAL_SPI_STATE_READY;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_DeInit(SPI_HandleTypeDef* hspi)
+{
+	HAL_SPI_DMAStop(hspi);
+	hspi->Instance->CR1 = 0;
+	hspi->State = HAL_SPI_STATE_RESET;
+	return HAL_OK;
+}
+
+/*
+ * The polling transfers. HAL_SPI_Receive in 2 lines master mode sends the content
+ * of the receive buffer, as the real HAL does.
+ */
+
+static HAL_StatusTypeDef sim_spi_poll(SPI_HandleTypeDef* hspi, uint8_t* tx, uint8_t* rx, uint16_t Size)
+{	s_sim_bus* bus = sim_bus(hspi->Instance); uint8_t frame16 = (hspi->Instance->CR1 & SPI_CR1_DFF) != 0;
+	uint16_t i, in;
+	if (hspi->State != HAL_SPI_STATE_READY) return HAL_BUSY;
+	sim_check_idle(bus);
+	sim_advance(SIM_HAL_CALL_PS);
+	for (i = 0; i < Size; i++)
+	{
+		in = sim_clock_frame(bus, frame16, frame16 ? ((uint16_t*)tx)[i] : tx[i]);
+		if (rx)
+		{
+			if (frame16) ((uint16_t*)rx)[i] = in;
+			else rx[i] = in;
+		}
+		sim_advance(sim_byte_ps(bus->spi) * (frame16 ? 2 : 1) + SIM_HAL_BYTE_PS);
+	}
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout)
+{
+	return sim_spi_poll(hspi, pData, NULL, Size);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout)
+{
+	return sim_spi_poll(hspi, pData, pData, Size);
+}
+
+/*
+ * The DMA transfers. The bytes go to the device at the start, the complete interrupt
+ * comes when the simulated clock reaches the end of the last byte. The memory increment,
+ * and the frame size come from the DMA channel, and the SPI registers, as the driver set them.
+ */
+
+static HAL_StatusTypeDef sim_spi_dma(SPI_HandleTypeDef* hspi, const uint8_t* tx, uint8_t* rx, uint16_t Size, HAL_SPI_StateTypeDef state)
+{	s_sim_bus* bus = sim_bus(hspi->Instance); uint8_t frame16 = (hspi->Instance->CR1 & SPI_CR1_DFF) != 0;
+	uint8_t txinc = (hspi->hdmatx == NULL) || (hspi->hdmatx->Instance->CCR & DMA_CCR_MINC);
+	uint16_t i, in, out; uint32_t bytes = Size * (frame16 ? 2 : 1);
+	if (hspi->State != HAL_SPI_STATE_READY) return HAL_BUSY;
+	sim_check_idle(bus);
+	hspi->State = state;
+	sim_advance(SIM_DMA_START_PS);
+	for (i = 0; i < Size; i++)
+	{
+		out = frame16 ? ((const uint16_t*)tx)[txinc ? i : 0] : tx[txinc ? i : 0];
+		in = sim_clock_frame(bus, frame16, out);
+		if (rx)
+		{
+			if (frame16) ((uint16_t*)rx)[i] = in;
+			else rx[i] = in;
+		}
+	}
+	bus->stats.dma_xfers++;
+	bus->stats.dma_bytes += bytes;
+	bus->dma_handle = hspi;
+	bus->dma_end = now_ps + bytes * sim_byte_ps(bus->spi);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size)
+{
+	return sim_spi_dma(hspi, pData, NULL, Size, HAL_SPI_STATE_BUSY_TX);
+}
+
+HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size)
+{
+	return sim_spi_dma(hspi, pData, pData, Size, HAL_SPI_STATE_BUSY_RX);
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef* hspi, uint8_t* pTxData, uint8_t* pRxData, uint16_t Size)
+{
+	return sim_spi_dma(hspi, pTxData, pRxData, Size, HAL_SPI_STATE_BUSY_TX_RX);
+}
+
+HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef* hspi)
+{	s_sim_bus* bus = sim_bus(hspi->Instance);
+	if (bus->dma_handle == hspi) bus->dma_handle = NULL;
+	hspi->State = HAL_SPI_STATE_READY;
+	return HAL_OK;
+}
+
+/* ----------------------------------- DMA ----------------------------------- */
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef* hdma)
+{
+	hdma->Instance->CCR = hdma->Init.Direction | hdma->Init.PeriphInc | hdma->Init.MemInc | hdma->Init.PeriphDataAlignment |
+			hdma->Init.MemDataAlignment | hdma->Init.Mode | hdma->Init.Priority;
+	return HAL_OK;
+}
+
+/* The simulator calls the complete callbacks directly. */
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef* hdma)
+{
+}
+
+/* -------------------------------- RCC, NVIC, time -------------------------- */
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+	return SIM_PCLK1_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+	return SIM_PCLK2_HZ;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
+
+uint32_t HAL_GetTick(void)
+{
+	sim_advance(SIM_POLL_PS);
+	return now_ps / 1000000000ULL;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	sim_advance(Delay * 1000000000ULL);
+}
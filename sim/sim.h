@@ -0,0 +1,104 @@
+#ifndef __SIM_H
+#define __SIM_H
+
+/*
+ * Host side SPI bus simulator. The drivers (SPI/, SD_SPI/, ILI9341_SPI/) run unchanged
+ * on the workstation, against the simulated HAL (include/stm32f1xx_hal.h). The simulator
+ * keeps a simulated clock, clocks every SPI byte through the device model of the bus at
+ * the prescaler rate of the bus, watches the CS and DC lines, and fires the DMA complete
+ * callbacks when the simulated clock reaches the end of the DMA transfers.
+ *
+ * The CPU time is not modeled, except the costs below. The polling loops call HAL_GetTick(),
+ * every call costs SIM_POLL_PS, so the simulated clock runs while the drivers wait.
+ */
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/* Clocks of the STM32F103 at 72 MHz system clock. */
+#define SIM_SYSCLK_HZ	72000000UL
+#define SIM_PCLK1_HZ	36000000UL		// APB1: SPI2
+#define SIM_PCLK2_HZ	72000000UL		// APB2: SPI1
+
+/* Costs of the CPU in picoseconds (rough STM32F103 figures). */
+#define SIM_POLL_PS			250000ULL		// One HAL_GetTick() polling iteration.
+#define SIM_EXCHANGE_PS		200000ULL		// Gap after a register level byte (SPI_Exchange).
+#define SIM_HAL_CALL_PS		2000000ULL		// Entry, and exit of a HAL SPI polling call.
+#define SIM_HAL_BYTE_PS		500000ULL		// Gap between the bytes of a HAL polling transfer.
+#define SIM_DMA_START_PS	3000000ULL		// HAL DMA transfer setup, until the first byte.
+#define SIM_IRQ_PS			1500000ULL		// DMA interrupt entry, and the HAL handler.
+#define SIM_GPIO_HAL_PS		200000ULL		// HAL_GPIO_WritePin() call.
+#define SIM_GPIO_STORE_PS	28000ULL		// One BSRR, or BRR store (SPI_PIN_HIGH, SPI_PIN_LOW).
+
+/*
+ * Device model on an SPI bus. exchange() gets the byte from the master (MOSI), and gives back
+ * the byte of the device (MISO) in the same frame, it is called only while the CS is active.
+ * select() is called on the CS edges.
+ */
+
+typedef struct s_sim_device {
+	const char* name;
+	uint8_t (*exchange)(struct s_sim_device* dev, uint8_t mosi, uint8_t dc);
+	void (*select)(struct s_sim_device* dev, uint8_t active);
+	void (*reset)(struct s_sim_device* dev);
+} s_sim_device;
+
+/* Statistics of a simulated bus. */
+
+typedef struct {
+	uint64_t wire_bytes;		// Bytes clocked on the bus (with the CS inactive too).
+	uint64_t transactions;		// CS active periods.
+	uint64_t dc_edges;			// DC line changes while the CS was active.
+	uint64_t dma_xfers;			// DMA transfers.
+	uint64_t dma_bytes;			// Bytes moved by the DMA.
+	uint64_t wire_ps;			// Time of the clocked bytes.
+	uint64_t conflicts;			// Register level, or polling transfer while the DMA was running.
+} s_sim_bus_stats;
+
+/* @brief sim_attach(spi, cs_port, cs_pin, dc_port, dc_pin, dev) Connect a device model to an SPI bus. */
+void sim_attach(SPI_TypeDef* spi, GPIO_TypeDef* cs_port, uint16_t cs_pin, GPIO_TypeDef* dc_port, uint16_t dc_pin, s_sim_device* dev);
+
+/* @brief sim_now() The simulated time in picoseconds. */
+uint64_t sim_now();
+
+/* @brief sim_advance(ps) Let the time go, and fire the due DMA interrupts. */
+void sim_advance(uint64_t ps);
+
+/* @brief sim_stats(spi) The statistics of the bus. */
+s_sim_bus_stats* sim_stats(SPI_TypeDef* spi);
+
+/* @brief sim_stats_reset() Clear the statistics of all buses. */
+void sim_stats_reset();
+
+/* @brief sim_byte_ps(spi) The time of one byte on the bus with its current prescaler. */
+uint64_t sim_byte_ps(SPI_TypeDef* spi);
+
+/* ------------------------------- Device models ------------------------------- */
+
+#define SIM_SD_BLOCKS	1024
+
+/* @brief sim_sd SD card (SDHC, SPI mode) model. The block content is sim_sd_data(). */
+extern s_sim_device sim_sd;
+
+/* @brief sim_sd_data(block, i) The i-th byte of the block on the simulated card: the written data, or a generated pattern. */
+uint8_t sim_sd_data(uint32_t block, uint32_t i);
+
+/* @brief sim_sd_errors The count of the protocol errors seen by the card model (bad CRC, illegal command). */
+extern uint32_t sim_sd_errors;
+
+#define SIM_LCD_WIDTH	240
+#define SIM_LCD_HEIGHT	320
+
+/* @brief sim_ili9341 ILI9341 display model with its frame memory. */
+extern s_sim_device sim_ili9341;
+
+/* @brief sim_lcd_pixel(x, y) The pixel in the frame memory as RGB666 (r << 12 | g << 6 | b). */
+uint32_t sim_lcd_pixel(uint16_t x, uint16_t y);
+
+/* @brief sim_lcd_screen(x, y) The pixel seen on the screen (the vertical scroll applied) as RGB666. */
+uint32_t sim_lcd_screen(uint16_t x, uint16_t y);
+
+/* @brief sim_lcd_rgb565(x, y) The pixel in the frame memory converted to RGB565. */
+uint16_t sim_lcd_rgb565(uint16_t x, uint16_t y);
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * ILI9341 display model on the 4 line serial interface (DC line). It keeps the frame
+ * memory in RGB666, and knows the window (CASET, PASET), the pixel format (COLMOD),
+ * the memory write (RAMWR, 0x3C continue), the memory read (RAMRD, dummy byte first), and
+ * the vertical scrolling (VSCRDEF, VSCRSADD) of the screen. The other commands, and their
+ * parameters are ignored.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "sim.h"
+
+static struct {
+	uint8_t cmd;
+	uint8_t nparam;
+	uint8_t param[6];
+	uint16_t sc, ec, sp, ep;	// Column, and page window.
+	uint16_t x, y;				// Memory pointer.
+	uint8_t colmod;
+	uint16_t tfa, vsa, vsp;		// Vertical scrolling: top fixed lines, scroll lines, scroll start.
+	uint8_t pix[3];
+	uint8_t pix_pos;
+	int8_t rd_pos;				// -1: dummy byte, 0..2: color of the pixel.
+	uint32_t fb[SIM_LCD_WIDTH * SIM_LCD_HEIGHT];
+} lcd;
+
+uint32_t sim_lcd_pixel(uint16_t x, uint16_t y)
+{
+	return lcd.fb[y * SIM_LCD_WIDTH + x];
+}
+
+/*
+ * @brief sim_lcd_screen(x, y) The pixel on the screen line y: the lines of the scroll area show the memory
+ * lines from the scroll start, with wrap around in the area.
+ */
+
+uint32_t sim_lcd_screen(uint16_t x, uint16_t y)
+{	uint32_t line = y;
+	if ((y >= lcd.tfa) && (y < lcd.tfa + lcd.vsa) && (lcd.vsp >= lcd.tfa) && (lcd.vsp < lcd.tfa + lcd.vsa))
+	{
+		line = lcd.tfa + (y - lcd.tfa + lcd.vsp - lcd.tfa) % lcd.vsa;
+	}
+	return sim_lcd_pixel(x, line);
+}
+
+uint16_t sim_lcd_rgb565(uint16_t x, uint16_t y)
+{	uint32_t p = sim_lcd_pixel(x, y);
+	return ((p >> 13) << 11) | (((p >> 6) & 0x3F) << 5) | ((p & 0x3F) >> 1);
+}
+
+static void lcd_next()
+{
+	if (++lcd.x > lcd.ec)
+	{
+		lcd.x = lcd.sc;
+		if (++lcd.y > lcd.ep) lcd.y = lcd.sp;
+	}
+}
+
+static void lcd_store(uint32_t rgb666)
+{
+	if ((lcd.x < SIM_LCD_WIDTH) && (lcd.y < SIM_LCD_HEIGHT)) lcd.fb[lcd.y * SIM_LCD_WIDTH + lcd.x] = rgb666;
+	lcd_next();
+}
+
+static void lcd_command(uint8_t cmd)
+{
+	lcd.cmd = cmd;
+	lcd.nparam = 0;
+	lcd.pix_pos = 0;
+	switch (cmd)
+	{
+	case 0x01:	// Software reset.
+		lcd.colmod = 0x66;
+		lcd.sc = lcd.sp = 0;
+		lcd.ec = SIM_LCD_WIDTH - 1;
+		lcd.ep = SIM_LCD_HEIGHT - 1;
+		lcd.tfa = lcd.vsp = 0;
+		lcd.vsa = SIM_LCD_HEIGHT;
+		break;
+	case 0x2C:	// RAMWR
+	case 0x2E:	// RAMRD
+		lcd.x = lcd.sc;
+		lcd.y = lcd.sp;
+		lcd.rd_pos = -1;
+		break;
+	}
+}
+
+static uint8_t lcd_data(uint8_t data)
+{	uint32_t p; uint8_t r, g, b, out;
+	switch (lcd.cmd)
+	{
+	case 0x2A:	// CASET
+	case 0x2B:	// PASET
+		if (lcd.nparam < 4) lcd.param[lcd.nparam++] = data;
+		if (lcd.nparam == 4)
+		{
+			if (lcd.cmd == 0x2A)
+			{
+				lcd.sc = (lcd.param[0] << 8) | lcd.param[1];
+				lcd.ec = (lcd.param[2] << 8) | lcd.param[3];
+			} else
+			{
+				lcd.sp = (lcd.param[0] << 8) | lcd.param[1];
+				lcd.ep = (lcd.param[2] << 8) | lcd.param[3];
+			}
+		}
+		break;
+	case 0x33:	// VSCRDEF, the areas must cover the memory, else the command is ignored.
+		if (lcd.nparam < 6) lcd.param[lcd.nparam++] = data;
+		if ((lcd.nparam == 6) && ((lcd.param[0] << 8 | lcd.param[1]) + (lcd.param[2] << 8 | lcd.param[3]) +
+				(lcd.param[4] << 8 | lcd.param[5]) == SIM_LCD_HEIGHT))
+		{
+			lcd.tfa = (lcd.param[0] << 8) | lcd.param[1];
+			lcd.vsa = (lcd.param[2] << 8) | lcd.param[3];
+		}
+		break;
+	case 0x37:	// VSCRSADD
+		if (lcd.nparam < 2) lcd.param[lcd.nparam++] = data;
+		if (lcd.nparam == 2) lcd.vsp = (lcd.param[0] << 8) | lcd.param[1];
+		break;
+	case 0x3A:	// COLMOD
+		lcd.colmod = data;
+		break;
+	case 0x2C:
+	case 0x3C:	// Memory write continue.
+		lcd.pix[lcd.pix_pos++] = data;
+		if ((lcd.colmod & 0x07) == 0x06)
+		{
+			if (lcd.pix_pos < 3) break;
+			lcd_store(((uint32_t)(lcd.pix[0] >> 2) << 12) | ((lcd.pix[1] >> 2) << 6) | (lcd.pix[2] >> 2));
+		} else
+		{
+			if (lcd.pix_pos < 2) break;
+			/* RGB565 to the RGB666 memory: the red, and blue LSB is the copy of the MSB. */
+			r = lcd.pix[0] >> 3;
+			g = ((lcd.pix[0] & 0x07) << 3) | (lcd.pix[1] >> 5);
+			b = lcd.pix[1] & 0x1F;
+			lcd_store(((uint32_t)((r << 1) | (r >> 4)) << 12) | (g << 6) | ((b << 1) | (b >> 4)));
+		}
+		lcd.pix_pos = 0;
+		break;
+	case 0x2E:
+		/* The read gives 3 bytes per pixel in both pixel formats. */
+		if (lcd.rd_pos < 0)
+		{
+			lcd.rd_pos = 0;
+			return 0x00;
+		}
+		p = ((lcd.x < SIM_LCD_WIDTH) && (lcd.y < SIM_LCD_HEIGHT)) ? lcd.fb[lcd.y * SIM_LCD_WIDTH + lcd.x] : 0;
+		out = ((p >> (12 - lcd.rd_pos * 6)) & 0x3F) << 2;
+		if (++lcd.rd_pos == 3)
+		{
+			lcd.rd_pos = 0;
+			lcd_next();
+		}
+		return out;
+	}
+	return 0xFF;
+}
+
+static uint8_t lcd_exchange(s_sim_device* dev, uint8_t mosi, uint8_t dc)
+{
+	if (!dc)
+	{
+		lcd_command(mosi);
+		return 0xFF;
+	}
+	return lcd_data(mosi);
+}
+
+/*
+ * The CS high resets the bit counter of the serial interface only, the memory write goes on
+ * with the next data bytes (a pixel may span two CS periods). The read ends.
+ */
+
+static void lcd_select(s_sim_device* dev, uint8_t active)
+{
+	if (!active && (lcd.cmd == 0x2E)) lcd.cmd = 0;
+}
+
+static void lcd_reset(s_sim_device* dev)
+{
+	memset(&lcd, 0, sizeof(lcd));
+	lcd_command(0x01);
+	lcd.cmd = 0;
+}
+
+s_sim_device sim_ili9341 = {
+	.name = "ILI9341",
+	.exchange = lcd_exchange,
+	.select = lcd_select,
+	.reset = lcd_reset
+};
@@ -0,0 +1,1324 @@
+/*
+ * SPI bus simulator runner. Initializes the drivers against the device models, runs the
+ * scenarios, prints the bus statistics, and checks the data at the devices. The exit code
+ * is not zero, if a check failed.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "spi.h"
+#include "sd_spi.h"
+#include "ili9341_spi.h"
+#include "ili9341_dirty.h"
+#include "ili9341_band.h"
+#include "ili9341_dlist.h"
+#include "ili9341_font.h"
+#include "ili9341_console.h"
+#include "ili9341_geom.h"
+#include "ili9341_image.h"
+#include "images/dialog.h"
+#include "images/icons.h"
+#include "fonts/font5x7.h"
+#include "fonts/font10x16.h"
+#include "fonts/font10x16aa.h"
+#include "stream.h"
+#include "screenshot.h"
+#include "sim.h"
+
+#define SIM_BLOCKS		16		// Blocks of the SD card scenarios.
+#define SIM_STREAM_BLOCK	100	// First block of the stream image.
+#define SIM_SHOT_BLOCK	600		// First block of the screenshots.
+
+static uint8_t block[SDHX_BLOCSIZE];
+static s_image image;
+static int failures;
+static uint32_t items;			// Counted items of the scenario (characters), the rate is printed.
+static const char* items_name;
+
+static int check_block(uint32_t blocknum, const uint8_t* data)
+{	uint32_t i;
+	for (i = 0; i < SDHX_BLOCSIZE; i++)
+	{
+		if (data[i] != sim_sd_data(blocknum, i)) return 0;
+	}
+	return 1;
+}
+
+/* The error LED of the board (src/interrupts.c). */
+
+void ForceErrorNumber(uint16_t enumb)
+{
+	printf("error number %u\n", enumb);
+	failures++;
+}
+
+/* @brief pixel_666(data, bpp) The frame memory value of a pixel. bpp 2: native uint16_t RGB565, 3: RGB666 bytes. */
+
+static uint32_t pixel_666(const uint8_t* data, uint8_t bpp)
+{	uint16_t p; uint8_t r, b;
+	if (bpp == 3) return ((uint32_t)(data[0] >> 2) << 12) | ((data[1] >> 2) << 6) | (data[2] >> 2);
+	p = data[0] | (data[1] << 8);
+	r = p >> 11;
+	b = p & 0x1F;
+	return ((uint32_t)((r << 1) | (r >> 4)) << 12) | (((p >> 5) & 0x3F) << 6) | ((b << 1) | (b >> 4));
+}
+
+/* ------------------------------- Scenarios --------------------------------- */
+
+static int sd_block_poll(uint32_t* payload)
+{	int i, ok = 1;
+	for (i = 0; i < SIM_BLOCKS; i++)
+	{
+		if (ReadDataBlockPolling(SD_BlockAddress(i), block) != SD_SPI_OK) ok = 0;
+		ok &= check_block(i, block);
+	}
+	*payload = SIM_BLOCKS * SDHX_BLOCSIZE;
+	return ok;
+}
+
+static int sd_block_dma(uint32_t* payload)
+{	int i, ok = 1;
+	for (i = 0; i < SIM_BLOCKS; i++)
+	{
+		if (ReadDataBlock(SD_BlockAddress(i), block) != SD_SPI_OK) ok = 0;
+		ok &= check_block(i, block);
+	}
+	*payload = SIM_BLOCKS * SDHX_BLOCSIZE;
+	return ok;
+}
+
+static SD_SPI_STATE async_state;
+
+static void sd_async_done(s_sd_request* req, SD_SPI_STATE state)
+{
+	async_state = state;
+}
+
+static int sd_block_async(uint32_t* payload)
+{	int i, ok = 1; s_sd_request req;
+	for (i = 0; i < SIM_BLOCKS; i++)
+	{
+		async_state = SD_ERROR;
+		if (ReadDataBlockAsync(SD_BlockAddress(i), block, &req, sd_async_done, NULL) != SD_SPI_OK) ok = 0;
+		if (SPI_QueueFlush(&sd_spi2_bus, SD_SPI2_TIMEOUT) != HAL_OK) ok = 0;
+		ok &= (async_state == SD_SPI_OK) && check_block(i, block);
+	}
+	*payload = SIM_BLOCKS * SDHX_BLOCSIZE;
+	return ok;
+}
+
+/* @brief fill(color, payload) Full screen fill, and check. */
+
+static int fill(t_color color, uint32_t* payload)
+{	t_color565 p565; t_color666 p666; uint32_t expected; int x, y;
+	if (ili9341_format == ILI9341_RGB565)
+	{
+		p565 = ILI9341_Color565(color);
+		expected = pixel_666((uint8_t*)&p565, 2);
+	} else
+	{
+		ILI9341_Color666(color, p666);
+		expected = pixel_666(p666, 3);
+	}
+	*payload = SIM_LCD_WIDTH * SIM_LCD_HEIGHT * ILI9341_BytesPerPixel();
+	if (ILI9341_fillrectangle(0, 0, SIM_LCD_WIDTH, SIM_LCD_HEIGHT, color) != HAL_OK) return 0;
+	for (y = 0; y < SIM_LCD_HEIGHT; y++)
+	{
+		for (x = 0; x < SIM_LCD_WIDTH; x++)
+		{
+			if (sim_lcd_pixel(x, y) != expected) return 0;
+		}
+	}
+	return 1;
+}
+
+static int disp_fill(uint32_t* payload)
+{	t_color color = {0b00100000, 0b10000100, 0b10000100};
+	return fill(color, payload);
+}
+
+/* Gray: one byte is the whole RGB666 pixel. */
+
+static int disp_clear(uint32_t* payload)
+{	t_color color = {0x40, 0x40, 0x40};
+	return fill(color, payload);
+}
+
+#define SIM_WINDOWS	256		// Window sets of the command transaction scenario.
+
+/* Command transactions: CASET, PASET with their parameters, 10 bytes per window. */
+
+static int disp_setaddr(uint32_t* payload)
+{	int i;
+	for (i = 0; i < SIM_WINDOWS; i++)
+	{
+		ILI9341_setaddr(i & 0x7F, i & 0xFF, 239, 319);
+	}
+	*payload = SIM_WINDOWS * 10;
+	return 1;
+}
+
+#define SIM_RECT	8		// Size of the small rectangles.
+
+/*
+ * Small primitives: 8x8 rectangles over the whole screen (the lower half is above y 255), then the same
+ * window again and again (the window cache).
+ */
+
+static int disp_rects(uint32_t* payload)
+{	t_color color; t_color565 p565; int x, y, i, ok = 1; uint32_t rects = 0;
+	for (y = 0; y < SIM_LCD_HEIGHT; y += SIM_RECT)
+	{
+		for (x = 0; x < SIM_LCD_WIDTH; x += SIM_RECT * 3)
+		{
+			color[0] = x;
+			color[1] = y >> 1;
+			color[2] = 0x80;
+			if (ILI9341_fillrectangle(x, y, SIM_RECT, SIM_RECT, color) != HAL_OK) ok = 0;
+			rects++;
+			p565 = ILI9341_Color565(color);
+			for (i = 0; i < SIM_RECT * SIM_RECT; i++)
+			{
+				if (sim_lcd_pixel(x + i % SIM_RECT, y + i / SIM_RECT) != pixel_666((uint8_t*)&p565, 2)) ok = 0;
+			}
+		}
+	}
+	for (i = 0; i < SIM_WINDOWS; i++)
+	{
+		color[2] = i;
+		if (ILI9341_fillrectangle(100, 300, SIM_RECT, SIM_RECT, color) != HAL_OK) ok = 0;
+		rects++;
+	}
+	*payload = rects * SIM_RECT * SIM_RECT * ILI9341_BytesPerPixel();
+	return ok;
+}
+
+#define BITMAP_X	40
+#define BITMAP_Y	60
+
+#define SIM_GRADIENT_PS	300000ULL	// CPU time of a generated pixel (about 20 cycles).
+
+/* @brief gradient_color(n, color) The color of the n-th pixel of the full screen gradient. */
+
+static void gradient_color(uint32_t n, t_color color)
+{
+	color[0] = n % SIM_LCD_WIDTH;
+	color[1] = n / SIM_LCD_WIDTH;
+	color[2] = color[0] + color[1];
+}
+
+/* Pixel source of the gradient, arg is the next pixel number. */
+
+static uint8_t gradient_source(void* buffer, uint16_t pixels, void* arg)
+{	uint32_t* n = arg; uint16_t i; t_color color;
+	for (i = 0; i < pixels; i++, (*n)++)
+	{
+		gradient_color(*n, color);
+		if (ili9341_format == ILI9341_RGB565) ((t_color565*)buffer)[i] = ILI9341_Color565(color);
+		else ILI9341_Color666(color, (uint8_t*)buffer + i * 3);
+	}
+	sim_advance(SIM_GRADIENT_PS * pixels);
+	return 1;
+}
+
+static int gradient_check()
+{	uint32_t n; t_color color; t_color565 p565; t_color666 p666;
+	for (n = 0; n < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; n++)
+	{
+		gradient_color(n, color);
+		p565 = ILI9341_Color565(color);
+		ILI9341_Color666(color, p666);
+		if (sim_lcd_pixel(n % SIM_LCD_WIDTH, n / SIM_LCD_WIDTH) !=
+				((ili9341_format == ILI9341_RGB565) ? pixel_666((uint8_t*)&p565, 2) : pixel_666(p666, 3))) return 0;
+	}
+	return 1;
+}
+
+/* The gradient through the ping-pong streaming stage: the next buffer is made, while the DMA sends the previous one. */
+
+static int disp_gradient(uint32_t* payload)
+{	uint32_t n = 0;
+	*payload = SIM_LCD_WIDTH * SIM_LCD_HEIGHT * ILI9341_BytesPerPixel();
+	if (ILI9341_stream(0, 0, SIM_LCD_WIDTH, SIM_LCD_HEIGHT, gradient_source, &n) != HAL_OK) return 0;
+	return gradient_check();
+}
+
+/* The same with one buffer: make it, send it, and wait (the earlier way of the bitmap, and fill loops). */
+
+static uint16_t serial_buffer[SCR_BUFFER_SIZE / 2];
+
+static int disp_gradient_serial(uint32_t* payload)
+{	uint32_t n = 0, remain = SIM_LCD_WIDTH * SIM_LCD_HEIGHT; uint16_t pixels;
+	*payload = remain * ILI9341_BytesPerPixel();
+	ILI9341_setaddr(0, 0, SIM_LCD_WIDTH - 1, SIM_LCD_HEIGHT - 1);
+	ILI9341_writecmd(ILI9341_RAMWR);
+	SELECT_DISPLAY();
+	SELECT_DATA();
+	while (remain)
+	{
+		pixels = (remain < SCR_BUFFER_IN_PIXELS) ? remain : SCR_BUFFER_IN_PIXELS;
+		gradient_source(serial_buffer, pixels, &n);
+		if (ili9341_format == ILI9341_RGB565) SPI_WriteBufDMA16(&display_spi1_bus, serial_buffer, pixels * 2, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+		else SPI_WriteBufDMA(&display_spi1_bus, serial_buffer, pixels * 3, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+		remain -= pixels;
+	}
+	DESELECT_DISPLAY();
+	return gradient_check();
+}
+
+/*
+ * Dashboard: three 5 digit values, the last two digits change in every frame. The digit cells are 12x16,
+ * the content of a frame is a color per frame (redraw() fills the window with it).
+ */
+
+#define SIM_FRAMES	10
+#define DIGIT_W		12
+#define DIGIT_H		16
+
+static const uint16_t dash_y[] = {40, 140, 270};
+static t_color dash_color;
+
+static HAL_StatusTypeDef dash_redraw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, void* arg)
+{
+	return ILI9341_fillrectangle(x, y, width, height, dash_color);
+}
+
+static int dash_check()
+{	t_color565 p565 = ILI9341_Color565(dash_color); int i, d, k;
+	for (i = 0; i < 3; i++)
+	{
+		for (d = 3; d < 5; d++)
+		{
+			for (k = 0; k < DIGIT_W * DIGIT_H; k++)
+			{
+				if (sim_lcd_pixel(20 + d * DIGIT_W + k % DIGIT_W, dash_y[i] + k / DIGIT_W) != pixel_666((uint8_t*)&p565, 2)) return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+/* Every frame redraws the whole screen. */
+
+static int disp_dash_full(uint32_t* payload)
+{	int f, ok = 1;
+	*payload = 0;
+	for (f = 0; f < SIM_FRAMES; f++)
+	{
+		dash_color[0] = dash_color[1] = f * 16;
+		dash_color[2] = 0x80;
+		if (dash_redraw(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, NULL) != HAL_OK) ok = 0;
+		*payload += ILI9341_WIDTH * ILI9341_HEIGHT * ILI9341_BytesPerPixel();
+	}
+	return ok && dash_check();
+}
+
+/* Every frame marks the changed digits, and flushes the merged windows (one per value). */
+
+static int disp_dash_dirty(uint32_t* payload)
+{	int f, i, d, ok = 1;
+	*payload = 0;
+	for (f = 0; f < SIM_FRAMES; f++)
+	{
+		dash_color[0] = dash_color[1] = f * 16;
+		dash_color[2] = 0x80;
+		for (i = 0; i < 3; i++)
+		{
+			for (d = 3; d < 5; d++)
+			{
+				ILI9341_DirtyAdd(20 + d * DIGIT_W, dash_y[i], DIGIT_W, DIGIT_H);
+			}
+		}
+		if (ILI9341_DirtyCount() != 3) ok = 0;
+		*payload += ILI9341_DirtyPixels() * ILI9341_BytesPerPixel();
+		if (ILI9341_DirtyFlush(dash_redraw, NULL) != HAL_OK) ok = 0;
+	}
+	return ok && dash_check();
+}
+
+/*
+ * Composited frame: background, overlapping rectangles, and an image over them. The direct drawing writes the
+ * overlapped pixels more times (the panel shows the steps), the band render writes every pixel once.
+ */
+
+static uint32_t frame_ref[SIM_LCD_WIDTH * SIM_LCD_HEIGHT];
+
+static void frame_image()
+{	uint32_t i;
+	image.width = 160;
+	image.height = 100;
+	image.bytes_per_pixel = 2;
+	for (i = 0; i < image.width * image.height * 2; i++)
+	{
+		image.pixel_data[i] = (uint8_t)(i * 7 + (i >> 8));
+	}
+}
+
+static t_color frame_colors[] = {{0x10, 0x20, 0x30}, {0xF8, 0x00, 0x00}, {0x00, 0xFC, 0x00}, {0x00, 0x00, 0xF8}};
+
+static int disp_frame_direct(uint32_t* payload)
+{	int i, ok = 1;
+	frame_image();
+	ok &= ILI9341_fillrectangle(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, frame_colors[0]) == HAL_OK;
+	ok &= ILI9341_fillrectangle(20, 30, 150, 200, frame_colors[1]) == HAL_OK;
+	ok &= ILI9341_fillrectangle(90, 100, 140, 210, frame_colors[2]) == HAL_OK;
+	ok &= ILI9341_displaybitmap(40, 150, image.width, image.height, &image) == HAL_OK;
+	ok &= ILI9341_fillrectangle(100, 180, 40, 40, frame_colors[3]) == HAL_OK;
+	*payload = (ILI9341_WIDTH * ILI9341_HEIGHT + 150 * 200 + 140 * 210 + 160 * 100 + 40 * 40) * ILI9341_BytesPerPixel();
+	for (i = 0; i < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; i++)
+	{
+		frame_ref[i] = sim_lcd_pixel(i % SIM_LCD_WIDTH, i / SIM_LCD_WIDTH);
+	}
+	return ok;
+}
+
+static int disp_frame_band(uint32_t* payload)
+{	t_color black = {0, 0, 0}; int i, ok = 1;
+	frame_image();
+	ILI9341_fillrectangle(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, black);
+	sim_stats_reset();
+	ILI9341_BandBegin(frame_colors[0]);
+	ok &= ILI9341_BandFill(20, 30, 150, 200, frame_colors[1]) == HAL_OK;
+	ok &= ILI9341_BandFill(90, 100, 140, 210, frame_colors[2]) == HAL_OK;
+	ok &= ILI9341_BandImage(40, 150, &image) == HAL_OK;
+	ok &= ILI9341_BandFill(100, 180, 40, 40, frame_colors[3]) == HAL_OK;
+	ok &= ILI9341_BandRender(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT) == HAL_OK;
+	*payload = ILI9341_WIDTH * ILI9341_HEIGHT * ILI9341_BytesPerPixel();
+	for (i = 0; i < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; i++)
+	{
+		if (sim_lcd_pixel(i % SIM_LCD_WIDTH, i / SIM_LCD_WIDTH) != frame_ref[i]) return 0;
+	}
+	return ok;
+}
+
+/*
+ * Display list of a static screen: every operation type, a clip, and the blit from the SD card. The full
+ * replay is checked at some pixels, the replay of the windows must give back the same screen.
+ */
+
+static uint32_t dlist_arena[1024 / sizeof(uint32_t)];
+static s_ili9341_dlist dlist;
+static uint8_t dlist_glyphs[10 * 8];
+static const s_ili9341_glyph dlist_index[10] = {{0, 8, 8, 0}, {8, 8, 8, 0}, {16, 8, 8, 0}, {24, 8, 8, 0}, {32, 8, 8, 0},
+		{40, 8, 8, 0}, {48, 8, 8, 0}, {56, 8, 8, 0}, {64, 8, 8, 0}, {72, 8, 8, 0}};
+static const s_ili9341_font dlist_font = {8, 1, 0, '0', 10, dlist_index, dlist_glyphs, NULL, 0};
+static const char dlist_text[] = "01234567890123456789";
+static t_color dlist_colors[] = {{0x00, 0x00, 0x40}, {0xF8, 0xFC, 0x00}, {0xF8, 0x00, 0xF8}, {0x00, 0xFC, 0xF8}, {0xFF, 0xFF, 0xFF}};
+
+#define DLIST_BLOCKS_X	100
+#define DLIST_BLOCKS_Y	150
+
+static int dlist_record()
+{	int i, ok = 1;
+	for (i = 0; i < sizeof(dlist_glyphs); i++)
+	{
+		dlist_glyphs[i] = (uint8_t)(i * 37 + 0x81);
+	}
+	frame_image();
+	ILI9341_DListInit(&dlist, dlist_arena, sizeof(dlist_arena), frame_colors[0]);
+	dlist.read_block = StreamReadBlock;
+	ok &= ILI9341_DListFill(&dlist, 10, 10, 200, 120, dlist_colors[0]) == HAL_OK;
+	ok &= ILI9341_DListClip(&dlist, 20, 20, 100, 60) == HAL_OK;
+	ok &= ILI9341_DListLine(&dlist, 0, 0, 239, 319, dlist_colors[1]) == HAL_OK;
+	ok &= ILI9341_DListText(&dlist, 16, 40, &dlist_font, dlist_colors[4], dlist_colors[0], dlist_text) == HAL_OK;
+	ok &= ILI9341_DListUnclip(&dlist) == HAL_OK;
+	ok &= ILI9341_DListLine(&dlist, 230, 5, 5, 300, dlist_colors[2]) == HAL_OK;
+	ok &= ILI9341_DListLine(&dlist, 0, 200, 239, 200, dlist_colors[3]) == HAL_OK;
+	ok &= ILI9341_DListImage(&dlist, 40, 210, &image) == HAL_OK;
+	ok &= ILI9341_DListBlocks(&dlist, DLIST_BLOCKS_X, DLIST_BLOCKS_Y, 64, 40, ILI9341_BytesPerPixel(), SIM_STREAM_BLOCK) == HAL_OK;
+	ok &= ILI9341_DListFill(&dlist, 180, 260, 100, 100, dlist_colors[3]) == HAL_OK;
+	ok &= ILI9341_DListUnclip(&dlist) == HAL_ERROR;
+	return ok;
+}
+
+static uint32_t dlist_pixel(const t_color color)
+{	t_color666 p666; t_color565 p565 = ILI9341_Color565(color);
+	if (ili9341_format == ILI9341_RGB565) return pixel_666((const uint8_t*)&p565, 2);
+	ILI9341_Color666(color, p666);
+	return pixel_666(p666, 3);
+}
+
+static int dlist_check()
+{	uint8_t bpp = ILI9341_BytesPerPixel(), data[ILI9341_MAX_BYTES_PER_PIXEL]; uint32_t offset; int x, y, i, bit;
+	if ((sim_lcd_pixel(5, 5) != dlist_pixel(frame_colors[0])) || (sim_lcd_pixel(15, 15) != dlist_pixel(dlist_colors[0]))) return 0;
+	if ((sim_lcd_pixel(230, 5) != dlist_pixel(dlist_colors[2])) || (sim_lcd_pixel(5, 300) != dlist_pixel(dlist_colors[2]))) return 0;
+	if ((sim_lcd_pixel(0, 200) != dlist_pixel(dlist_colors[3])) || (sim_lcd_pixel(239, 319) != dlist_pixel(dlist_colors[3]))) return 0;
+	/* The line in the clip only. */
+	if ((sim_lcd_pixel(0, 0) != dlist_pixel(frame_colors[0])) || (sim_lcd_pixel(20, 27) != dlist_pixel(dlist_colors[1]))) return 0;
+	/* The text set pixels in the clip, the fill out of it. */
+	for (y = 0; y < 8; y++)
+	{
+		for (x = 0; x < 8 * (sizeof(dlist_text) - 1); x++)
+		{
+			bit = (dlist_glyphs[(dlist_text[x / 8] - '0') * 8 + y] << (x % 8)) & 0x80;
+			if (bit && (sim_lcd_pixel(16 + x, 40 + y) != dlist_pixel(dlist_colors[((16 + x >= 20) && (16 + x < 120)) ? 4 : 0]))) return 0;
+		}
+	}
+	if (sim_lcd_pixel(50, 220) != pixel_666(&image.pixel_data[(10 * image.width + 10) * 2], 2)) return 0;
+	for (y = 0; y < 40; y++)
+	{
+		for (x = 0; x < 64; x++)
+		{
+			for (i = 0; i < bpp; i++)
+			{
+				offset = (y * 64 + x) * bpp + i;
+				data[i] = sim_sd_data(SIM_STREAM_BLOCK + offset / SDHX_BLOCSIZE, offset % SDHX_BLOCSIZE);
+			}
+			if (sim_lcd_pixel(DLIST_BLOCKS_X + x, DLIST_BLOCKS_Y + y) != pixel_666(data, bpp)) return 0;
+		}
+	}
+	return 1;
+}
+
+static int disp_dlist_full(uint32_t* payload)
+{
+	*payload = ILI9341_WIDTH * ILI9341_HEIGHT * ILI9341_BytesPerPixel();
+	return dlist_record() && (ILI9341_DListRender(&dlist, 0, 0, ILI9341_WIDTH, ILI9341_HEIGHT) == HAL_OK) && dlist_check();
+}
+
+/* The windows of the damage: the replay culls the operations out of them. */
+
+static const uint16_t dlist_windows[][4] = {{0, 0, 240, 100}, {0, 100, 120, 220}, {120, 100, 120, 220}};
+
+static int disp_dlist_windows(uint32_t* payload)
+{	t_color black = {0, 0, 0}; int i, ok;
+	ok = dlist_record() && (ILI9341_DListRender(&dlist, 0, 0, ILI9341_WIDTH, ILI9341_HEIGHT) == HAL_OK);
+	for (i = 0; i < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; i++)
+	{
+		frame_ref[i] = sim_lcd_pixel(i % SIM_LCD_WIDTH, i / SIM_LCD_WIDTH);
+	}
+	ILI9341_fillrectangle(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, black);
+	sim_stats_reset();
+	for (i = 0; i < sizeof(dlist_windows) / sizeof(dlist_windows[0]); i++)
+	{
+		ok &= ILI9341_DListRender(&dlist, dlist_windows[i][0], dlist_windows[i][1], dlist_windows[i][2], dlist_windows[i][3]) == HAL_OK;
+	}
+	*payload = ILI9341_WIDTH * ILI9341_HEIGHT * ILI9341_BytesPerPixel();
+	for (i = 0; i < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; i++)
+	{
+		if (sim_lcd_pixel(i % SIM_LCD_WIDTH, i / SIM_LCD_WIDTH) != frame_ref[i]) return 0;
+	}
+	return ok;
+}
+
+/* Redraw of a damaged 40x40 region of the screen. */
+
+static int disp_dlist_damage(uint32_t* payload)
+{	t_color black = {0, 0, 0}; int x, y;
+	dlist_record();
+	ILI9341_fillrectangle(90, 140, 40, 40, black);
+	sim_stats_reset();
+	*payload = 40 * 40 * ILI9341_BytesPerPixel();
+	if (ILI9341_DListRender(&dlist, 90, 140, 40, 40) != HAL_OK) return 0;
+	for (y = 140; y < 180; y++)
+	{
+		for (x = 90; x < 130; x++)
+		{
+			if (sim_lcd_pixel(x, y) != frame_ref[y * SIM_LCD_WIDTH + x]) return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Text. The reference expands the glyphs of the fonts in the sim, and paints them at the pen positions
+ * of the font metrics.
+ */
+
+#define TEXT_MAX_WIDTH	SIM_LCD_WIDTH
+#define TEXT_MAX_HEIGHT	16
+
+static void glyph_expand(const s_ili9341_font* font, const s_ili9341_glyph* glyph, uint8_t* pixels)
+{	const uint8_t* data = &font->bitmaps[glyph->offset]; int n = glyph->width * font->height, i = 0, k, bpp = font->bpp;
+	uint8_t mask = (1 << bpp) - 1;
+	if (!font->rle)
+	{
+		for (i = 0; i < n; i++)
+		{
+			pixels[i] = (data[(i * bpp) >> 3] >> (8 - bpp - ((i * bpp) & 7))) & mask;
+		}
+		return;
+	}
+	while (i < n)
+	{
+		if (bpp == 1)
+		{
+			for (k = 0; (k < (*data >> 4)) && (i < n); k++) pixels[i++] = 0;
+			for (k = 0; (k < (*data & 0x0F)) && (i < n); k++) pixels[i++] = 1;
+		} else
+		{
+			for (k = 0; (k <= (*data >> bpp)) && (i < n); k++) pixels[i++] = *data & mask;
+		}
+		data++;
+	}
+}
+
+/* @brief text_blend(font, level, color, background, blend) The color of the pixel value, rounded. */
+
+static void text_blend(const s_ili9341_font* font, uint8_t level, const t_color color, const t_color background, t_color blend)
+{	int n = (1 << font->bpp) - 1, ch;
+	for (ch = 0; ch < 3; ch++)
+	{
+		blend[ch] = (background[ch] * (n - level) + color[ch] * level + n / 2) / n;
+	}
+}
+
+static int text_check(uint16_t x, uint16_t y, const s_ili9341_font* font, const char* text, const t_color color, const t_color background)
+{	static uint8_t expected[TEXT_MAX_HEIGHT][TEXT_MAX_WIDTH]; uint8_t pixels[TEXT_MAX_WIDTH * TEXT_MAX_HEIGHT];
+	const s_ili9341_glyph* glyph; int count = strlen(text), width = ILI9341_TextWidth(font, text, count), pen = 0, i, gx, gy;
+	t_color blend;
+	/* The window is clipped to the screen. */
+	if (x + width > SIM_LCD_WIDTH) width = SIM_LCD_WIDTH - x;
+	memset(expected, 0, sizeof(expected));
+	for (i = 0; i < count; i++)
+	{
+		glyph = ILI9341_Glyph(font, text[i]);
+		glyph_expand(font, glyph, pixels);
+		for (gy = 0; gy < font->height; gy++)
+		{
+			for (gx = 0; gx < glyph->width; gx++)
+			{
+				if (pixels[gy * glyph->width + gx] && (pen + glyph->left + gx < width))
+				{
+					expected[gy][pen + glyph->left + gx] = pixels[gy * glyph->width + gx];
+				}
+			}
+		}
+		pen += glyph->advance + ((i + 1 < count) ? ILI9341_Kerning(font, text[i], text[i + 1]) : 0);
+	}
+	for (gy = 0; gy < font->height; gy++)
+	{
+		for (gx = 0; gx < width; gx++)
+		{
+			text_blend(font, expected[gy][gx], color, background, blend);
+			if (sim_lcd_screen(x + gx, y + gy) != dlist_pixel(blend)) return 0;
+		}
+	}
+	return 1;
+}
+
+static const char* text_lines[] = {"The quick brown fox jumps", "over the lazy dog. AVATAR", "Ty: 0123456789 {[(<@#$%&>)]}"};
+static t_color text_color = {0xFF, 0xE0, 0x40}, text_background = {0x10, 0x10, 0x60};
+
+static int disp_text(uint32_t* payload)
+{	const s_ili9341_font* fonts[] = {&font5x7, &font10x16, &font10x16aa}; uint16_t y = 20, width; int f, i, ok = 1;
+	*payload = 0;
+	for (f = 0; f < 3; f++)
+	{
+		for (i = 0; i < 3; i++, y += fonts[f]->height)
+		{
+			ok &= ILI9341_DrawText(4, y, fonts[f], text_lines[i], text_color, text_background) == HAL_OK;
+			ok &= text_check(4, y, fonts[f], text_lines[i], text_color, text_background);
+			width = ILI9341_TextWidth(fonts[f], text_lines[i], strlen(text_lines[i]));
+			*payload += ((width < SIM_LCD_WIDTH - 4) ? width : SIM_LCD_WIDTH - 4) * fonts[f]->height * ILI9341_BytesPerPixel();
+			items += strlen(text_lines[i]);
+		}
+	}
+	items_name = "chars";
+	return ok;
+}
+
+/* A screen of text: 40 lines of 40 characters in one call, and one window per character. */
+
+static const char text_screen_line[] = "Log 0042: SPI1 DMA window 240x8 done ok\n";
+static char text_screen[40 * sizeof(text_screen_line)];
+
+static int text_screen_setup(uint32_t* payload)
+{	int i;
+	for (i = 0; i < 40; i++)
+	{
+		memcpy(&text_screen[i * (sizeof(text_screen_line) - 1)], text_screen_line, sizeof(text_screen_line));
+	}
+	items = 40 * (sizeof(text_screen_line) - 2);
+	items_name = "chars";
+	*payload = 40 * ILI9341_TextWidth(&font5x7, text_screen_line, sizeof(text_screen_line) - 2) * font5x7.height * ILI9341_BytesPerPixel();
+	return text_check(0, 312, &font5x7, "Log 0042: SPI1 DMA window 240x8 done ok", text_color, text_background);
+}
+
+static int disp_text_lines(uint32_t* payload)
+{
+	text_screen_setup(payload);
+	return (ILI9341_DrawText(0, 0, &font5x7, text_screen, text_color, text_background) == HAL_OK) && text_screen_setup(payload);
+}
+
+static int disp_text_chars(uint32_t* payload)
+{	char c[2] = {0, 0}; uint16_t x, y; const char* s; int ok = 1;
+	for (y = 0; y < 320; y += font5x7.height)
+	{
+		for (x = 0, s = text_screen_line; *s != '\n'; s++)
+		{
+			c[0] = *s;
+			ok &= ILI9341_DrawText(x, y, &font5x7, c, text_color, text_background) == HAL_OK;
+			x += ILI9341_TextWidth(&font5x7, s, 2) - ILI9341_TextWidth(&font5x7, s + 1, 1);
+		}
+	}
+	/* No kerning pairs in the line, the windows give the same pixels. */
+	return ok && text_screen_setup(payload);
+}
+
+/*
+ * Console: the lines go in one by one, or in bursts with a flush per 250 lines. The screen must show the
+ * last lines in order, from the top of the scroll area.
+ */
+
+static s_ili9341_console console;
+
+static void console_line(char* line, uint32_t n)
+{
+	sprintf(line, "Log %04u: SPI1 DMA window 240x8 done ok", (unsigned)n);
+}
+
+static int console_run(uint16_t top, uint32_t count, uint32_t burst, uint32_t* payload)
+{	char line[ILI9341_CONSOLE_COLUMNS + 1]; uint32_t n, drawn = 0; uint16_t row; int ok;
+	ok = ILI9341_ConsoleInit(&console, top, SIM_LCD_HEIGHT - top, &font5x7, text_color, text_background) == HAL_OK;
+	for (n = 0; n < count; n++)
+	{
+		console_line(line, n);
+		ILI9341_ConsolePuts(&console, line);
+		if ((n + 1) % burst == 0)
+		{
+			drawn += console.pending;
+			ok &= ILI9341_ConsoleFlush(&console) == HAL_OK;
+		}
+	}
+	for (row = 0; row < console.rows; row++)
+	{
+		console_line(line, count - console.rows + row);
+		ok &= text_check(0, top + row * font5x7.height, &font5x7, line, text_color, text_background);
+	}
+	ok &= (console.lines == count) && (console.skipped == count - drawn);
+	ok &= ILI9341_ConsoleClose(&console) == HAL_OK;
+	items = count;
+	items_name = "lines";
+	*payload = drawn * SIM_LCD_WIDTH * font5x7.height * ILI9341_BytesPerPixel();
+	return ok;
+}
+
+static int disp_console(uint32_t* payload)
+{
+	return console_run(0, 100, 1, payload);
+}
+
+static int disp_console_burst(uint32_t* payload)
+{
+	return console_run(16, 5000, 250, payload);
+}
+
+/*
+ * Geometry: GEOM_LINES lines of all the directions (some of them out of the screen) plotted pixel by pixel with
+ * the same Bresenham steps, then drawn as spans in an other color over them. The spans must change the plotted
+ * pixels only. The shapes are checked against their geometry with a pixel of tolerance at the edges.
+ */
+
+#define GEOM_LINES	100
+
+static t_color geom_plot_color = {0x18, 0xFC, 0x48}, geom_line_color = {0xF8, 0x40, 0xB0};
+static uint32_t geom_seed;
+
+static int16_t geom_random(int16_t low, int16_t high)
+{
+	geom_seed = geom_seed * 1103515245 + 12345;
+	return low + (int16_t)((geom_seed >> 16) % (high - low + 1));
+}
+
+static void geom_line(int i, int16_t* p)
+{	int k;
+	geom_seed = i + 1;
+	for (k = 0; k < 4; k++)
+	{
+		p[k] = geom_random(-20, (k & 1) ? SIM_LCD_HEIGHT + 20 : SIM_LCD_WIDTH + 20);
+	}
+	if (i % 10 == 0) p[3] = p[1];	// Horizontal
+	if (i % 10 == 1) p[2] = p[0];	// Vertical
+}
+
+static int disp_geom_plot(uint32_t* payload)
+{	int16_t p[4]; int32_t dx, dy, sx, sy, x, y, err; int i; uint32_t n = 0;
+	for (i = 0; i < GEOM_LINES; i++)
+	{
+		geom_line(i, p);
+		dx = abs(p[2] - p[0]);
+		dy = abs(p[3] - p[1]);
+		sx = (p[2] > p[0]) ? 1 : -1;
+		sy = (p[3] > p[1]) ? 1 : -1;
+		x = p[0];
+		y = p[1];
+		err = (dx >= dy) ? dx / 2 : dy / 2;
+		for (;;)
+		{
+			if ((x >= 0) && (x < SIM_LCD_WIDTH) && (y >= 0) && (y < SIM_LCD_HEIGHT))
+			{
+				ILI9341_fillrectangle(x, y, 1, 1, geom_plot_color);
+				n++;
+			}
+			if ((dx >= dy) ? (x == p[2]) : (y == p[3])) break;
+			if (dx >= dy)
+			{
+				x += sx;
+				if ((err -= dy) < 0) y += sy, err += dx;
+			} else
+			{
+				y += sy;
+				if ((err -= dx) < 0) x += sx, err += dy;
+			}
+		}
+	}
+	for (i = 0; i < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; i++)
+	{
+		frame_ref[i] = sim_lcd_pixel(i % SIM_LCD_WIDTH, i / SIM_LCD_WIDTH);
+	}
+	items = GEOM_LINES;
+	items_name = "lines";
+	*payload = n * ILI9341_BytesPerPixel();
+	return 1;
+}
+
+static int disp_geom_lines(uint32_t* payload)
+{	int16_t p[4]; int i, ok = 1; uint32_t plot = dlist_pixel(geom_plot_color), line = dlist_pixel(geom_line_color), n = 0;
+	for (i = 0; i < GEOM_LINES; i++)
+	{
+		geom_line(i, p);
+		ok &= ILI9341_DrawLine(p[0], p[1], p[2], p[3], geom_line_color) == HAL_OK;
+	}
+	for (i = 0; i < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; i++)
+	{
+		if (frame_ref[i] == plot) n++;
+		if (sim_lcd_pixel(i % SIM_LCD_WIDTH, i / SIM_LCD_WIDTH) != ((frame_ref[i] == plot) ? line : frame_ref[i])) ok = 0;
+	}
+	items = GEOM_LINES;
+	items_name = "lines";
+	*payload = n * ILI9341_BytesPerPixel();
+	return ok;
+}
+
+/*
+ * @brief geom_check(x1, y1, x2, y2, r, fill, color, payload) Check the rounded box of the corner centers, and the radius:
+ * the pixels nearer to the edge than 1 may be anything, the others of the outline, or the fill are the color, the rest
+ * is not. Every row, and column of the box has a pixel of the color.
+ */
+
+static int geom_check(int x1, int y1, int x2, int y2, int r, int fill, const t_color color, uint32_t* payload)
+{	uint32_t pixel = dlist_pixel(color); int x, y, cx, cy, inner, outer, ok = 1; double d2, lo, hi;
+	for (y = y1 - r - 2; y <= y2 + r + 2; y++)
+	{
+		for (x = x1 - r - 2; x <= x2 + r + 2; x++)
+		{
+			if ((x < 0) || (x >= SIM_LCD_WIDTH) || (y < 0) || (y >= SIM_LCD_HEIGHT)) continue;
+			cx = (x < x1) ? x1 : (x > x2) ? x2 : x;
+			cy = (y < y1) ? y1 : (y > y2) ? y2 : y;
+			d2 = (double)(x - cx) * (x - cx) + (double)(y - cy) * (y - cy);
+			lo = (r - 1.0) * (r - 1.0);
+			hi = (r + 1.0) * (r + 1.0);
+			if (d2 >= hi) inner = 0, outer = 1;
+			else if (d2 <= lo) inner = 1, outer = !fill;
+			else inner = outer = 0;
+			if (inner && !outer && (sim_lcd_pixel(x, y) != pixel)) ok = 0;
+			if (outer && !inner && (sim_lcd_pixel(x, y) == pixel)) ok = 0;
+			if (sim_lcd_pixel(x, y) == pixel) (*payload) += ILI9341_BytesPerPixel();
+		}
+	}
+	for (y = y1 - r; y <= y2 + r; y++)
+	{
+		for (x = x1 - r, inner = 0; x <= x2 + r; x++) inner |= sim_lcd_pixel(x, y) == pixel;
+		ok &= inner;
+	}
+	for (x = x1 - r; x <= x2 + r; x++)
+	{
+		for (y = y1 - r, inner = 0; y <= y2 + r; y++) inner |= sim_lcd_pixel(x, y) == pixel;
+		ok &= inner;
+	}
+	return ok;
+}
+
+/* @brief geom_polygon_check(points, count, color, payload) The pixels farther than 1 from the edges. */
+
+static int geom_polygon_check(const s_ili9341_point* points, int count, const t_color color, uint32_t* payload)
+{	uint32_t pixel = dlist_pixel(color); int x, y, i, inside, outside, ok = 1; double cross, len2, area = 0;
+	const s_ili9341_point *a, *b;
+	for (i = 0; i < count; i++)
+	{
+		a = &points[i];
+		b = &points[(i + 1) % count];
+		area += (double)a->x * b->y - (double)b->x * a->y;
+	}
+	for (y = 0; y < SIM_LCD_HEIGHT; y++)
+	{
+		for (x = 0; x < SIM_LCD_WIDTH; x++)
+		{
+			inside = 1;
+			outside = 0;
+			for (i = 0; i < count; i++)
+			{
+				a = &points[i];
+				b = &points[(i + 1) % count];
+				cross = ((double)(b->x - a->x) * (y - a->y) - (double)(b->y - a->y) * (x - a->x)) * ((area > 0) ? 1 : -1);
+				len2 = (double)(b->x - a->x) * (b->x - a->x) + (double)(b->y - a->y) * (b->y - a->y);
+				if ((cross < 0) || (cross * cross < len2)) inside = 0;
+				if ((cross < 0) && (cross * cross > len2)) outside = 1;
+			}
+			if (inside && (sim_lcd_pixel(x, y) != pixel)) ok = 0;
+			if (outside && (sim_lcd_pixel(x, y) == pixel)) ok = 0;
+			if (!outside && (sim_lcd_pixel(x, y) == pixel)) (*payload) += ILI9341_BytesPerPixel();
+		}
+	}
+	return ok;
+}
+
+static int disp_geom_shapes(uint32_t* payload)
+{	static t_color colors[] = {{0xF8, 0x00, 0x00}, {0x00, 0xFC, 0x00}, {0x00, 0x00, 0xF8}, {0xF8, 0xFC, 0x00}, {0x00, 0xFC, 0xF8},
+			{0xF8, 0x00, 0xF8}, {0x80, 0x80, 0x80}};
+	static const s_ili9341_point hexagon[] = {{70, 200}, {113, 225}, {113, 275}, {70, 300}, {27, 275}, {27, 225}};
+	static const s_ili9341_point triangle[] = {{180, 215}, {125, 300}, {260, 330}};
+	int ok = 1;
+	*payload = 0;
+	ok &= ILI9341_FillCircle(60, 50, 30, colors[0]) == HAL_OK;
+	ok &= geom_check(60, 50, 60, 50, 30, 1, colors[0], payload);
+	ok &= ILI9341_DrawCircle(175, 50, 40, colors[1]) == HAL_OK;
+	ok &= geom_check(175, 50, 175, 50, 40, 0, colors[1], payload);
+	ok &= ILI9341_FillRoundRect(10, 100, 100, 60, 12, colors[2]) == HAL_OK;
+	ok &= geom_check(22, 112, 97, 147, 12, 1, colors[2], payload);
+	ok &= ILI9341_DrawRoundRect(130, 100, 100, 60, 15, colors[3]) == HAL_OK;
+	ok &= geom_check(145, 115, 214, 144, 15, 0, colors[3], payload);
+	ok &= ILI9341_FillPolygon(hexagon, 6, colors[4]) == HAL_OK;
+	ok &= geom_polygon_check(hexagon, 6, colors[4], payload);
+	ok &= ILI9341_FillPolygon(triangle, 3, colors[5]) == HAL_OK;
+	ok &= geom_polygon_check(triangle, 3, colors[5], payload);
+	/* Clipped at the screen edge. */
+	ok &= ILI9341_FillCircle(-5, 170, 12, colors[6]) == HAL_OK;
+	ok &= ILI9341_DrawLine(-10, 330, 300, -10, colors[6]) == HAL_OK;
+	ok &= sim_lcd_pixel(0, 170) == dlist_pixel(colors[6]);
+	items = 8;
+	items_name = "primitives";
+	return ok;
+}
+
+/*
+ * Flash images: the RLE dialog is decoded by the simulator into the s_image, and blitted from the RAM as the
+ * reference. The same pixels go out from the flash as plain RGB565, and as RLE (decoded into the stage
+ * buffers, the long runs are DMA fills).
+ */
+
+#define IMAGE_X		40
+#define IMAGE_Y		110
+
+static void image_unrle(const s_ili9341_image* rle, uint8_t* pixels)
+{	const uint8_t* data = rle->data; uint32_t n, i = 0; uint8_t token;
+	while (data < rle->data + rle->size)
+	{
+		token = *data++;
+		if (token < 0x80)
+		{
+			memcpy(&pixels[i * 2], data, (token + 1) * 2);
+			data += (token + 1) * 2;
+			i += token + 1;
+			continue;
+		}
+		n = (token < 0xC0) ? (token & 0x3F) + 1 : (((token & 0x3F) << 8) | *data++) + 1;
+		for (; n; n--, i++) memcpy(&pixels[i * 2], data, 2);
+		data += 2;
+	}
+}
+
+static int image_check(uint32_t* payload)
+{	int x, y;
+	*payload = dialog.width * dialog.height * ILI9341_BytesPerPixel();
+	for (y = 0; y < dialog.height; y++)
+	{
+		for (x = 0; x < dialog.width; x++)
+		{
+			if (sim_lcd_pixel(IMAGE_X + x, IMAGE_Y + y) != pixel_666(&image.pixel_data[(y * dialog.width + x) * 2], 2)) return 0;
+		}
+	}
+	return 1;
+}
+
+static int disp_image_ref(uint32_t* payload)
+{
+	image.width = dialog.width;
+	image.height = dialog.height;
+	image.bytes_per_pixel = 2;
+	image_unrle(&dialog, image.pixel_data);
+	ILI9341_fillrectangle(IMAGE_X, IMAGE_Y, dialog.width, dialog.height, text_color);
+	return (ILI9341_displaybitmap(IMAGE_X, IMAGE_Y, dialog.width, dialog.height, &image) == HAL_OK) && image_check(payload);
+}
+
+static int disp_image_raw(uint32_t* payload)
+{	s_ili9341_image raw = {dialog.width, dialog.height, ILI9341_IMAGE_RGB565, dialog.width * dialog.height * 2, image.pixel_data};
+	ILI9341_fillrectangle(IMAGE_X, IMAGE_Y, dialog.width, dialog.height, text_color);
+	return (ILI9341_DrawImage(IMAGE_X, IMAGE_Y, &raw) == HAL_OK) && image_check(payload);
+}
+
+static int disp_image_rle(uint32_t* payload)
+{
+	ILI9341_fillrectangle(IMAGE_X, IMAGE_Y, dialog.width, dialog.height, text_color);
+	return (ILI9341_DrawImage(IMAGE_X, IMAGE_Y, &dialog) == HAL_OK) && image_check(payload);
+}
+
+/*
+ * Indexed images: 37x23 images of random indexes at 1, 2, 4, and 8 bpp with random palettes, and the 4 bpp icons
+ * asset, checked pixel by pixel against the palette. The icons are blitted as RGB565 too (the same pixels).
+ */
+
+#define INDEXED_W	37
+#define INDEXED_H	23
+#define ICONS_BLITS	9
+
+static uint8_t indexed_index(const s_ili9341_image* image, int x, int y)
+{	int bpp = 1 << (image->format - ILI9341_IMAGE_INDEXED1), stride = (image->width * bpp + 7) / 8, bit = x * bpp;
+	return (image->data[y * stride + bit / 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1);
+}
+
+static int indexed_check(uint16_t x0, uint16_t y0, const s_ili9341_image* image, uint32_t* payload)
+{	int x, y;
+	for (y = 0; y < image->height; y++)
+	{
+		for (x = 0; x < image->width; x++)
+		{
+			if (sim_lcd_pixel(x0 + x, y0 + y) != dlist_pixel(image->palette[indexed_index(image, x, y)])) return 0;
+		}
+	}
+	*payload += image->width * image->height * ILI9341_BytesPerPixel();
+	return 1;
+}
+
+static int disp_indexed(uint32_t* payload)
+{	static uint8_t data[INDEXED_H * INDEXED_W]; static t_color palette[256]; s_ili9341_image image; int k, i, ok = 1;
+	*payload = 0;
+	for (k = 0; k < 4; k++)
+	{
+		geom_seed = k + 7;
+		for (i = 0; i < sizeof(data); i++) data[i] = geom_random(0, 255);
+		for (i = 0; i < 256; i++)
+		{
+			palette[i][0] = geom_random(0, 255);
+			palette[i][1] = geom_random(0, 255);
+			palette[i][2] = geom_random(0, 255);
+		}
+		image.width = INDEXED_W;
+		image.height = INDEXED_H;
+		image.format = ILI9341_IMAGE_INDEXED1 + k;
+		image.size = sizeof(data);
+		image.data = data;
+		image.palette = (const t_color*)palette;
+		image.colors = 1 << (1 << k);
+		ok &= ILI9341_DrawImage(10 + k * 50, 250, &image) == HAL_OK;
+		ok &= indexed_check(10 + k * 50, 250, &image, payload);
+	}
+	return ok;
+}
+
+static int disp_icons(uint32_t* payload)
+{	int i, ok = 1;
+	*payload = 0;
+	for (i = 0; i < ICONS_BLITS; i++)
+	{
+		ok &= ILI9341_DrawImage(72, 10 + i * 32, &icons) == HAL_OK;
+		ok &= indexed_check(72, 10 + i * 32, &icons, payload);
+	}
+	items = ICONS_BLITS;
+	items_name = "blits";
+	return ok;
+}
+
+static int disp_icons_raw(uint32_t* payload)
+{	s_ili9341_image raw = {icons.width, icons.height, ILI9341_IMAGE_RGB565, icons.width * icons.height * 2, image.pixel_data};
+	t_color565 p; int x, y, i, ok = 1;
+	for (y = 0; y < icons.height; y++)
+	{
+		for (x = 0; x < icons.width; x++)
+		{
+			p = ILI9341_Color565(icons.palette[indexed_index(&icons, x, y)]);
+			memcpy(&image.pixel_data[(y * icons.width + x) * 2], &p, 2);
+		}
+	}
+	*payload = 0;
+	for (i = 0; i < ICONS_BLITS; i++)
+	{
+		ok &= ILI9341_DrawImage(72, 10 + i * 32, &raw) == HAL_OK;
+		ok &= indexed_check(72, 10 + i * 32, &icons, payload);
+	}
+	items = ICONS_BLITS;
+	items_name = "blits";
+	return ok;
+}
+
+/*
+ * Screen readback: the whole screen, and an odd window with small chunks in one RAMRD each, checked pixel by pixel
+ * against the frame memory in RGB565. The reference reads the screen line by line with ILI9341_getpixels().
+ */
+
+static struct {
+	uint16_t x, y, width;
+	uint32_t n;				// Pixels checked.
+	uint32_t errors;
+} readback;
+
+static uint8_t readback_sink(t_color565* pixels, uint16_t count, void* arg)
+{	uint16_t i;
+	for (i = 0; i < count; i++, readback.n++)
+	{
+		if (pixels[i] != sim_lcd_rgb565(readback.x + readback.n % readback.width, readback.y + readback.n / readback.width))
+		{
+			readback.errors++;
+		}
+	}
+	return 1;
+}
+
+static int read_window(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t chunk)
+{
+	readback.x = x;
+	readback.y = y;
+	readback.width = width;
+	readback.n = readback.errors = 0;
+	return (ILI9341_readback_chunks(x, y, width, height, chunk, readback_sink, NULL) == HAL_OK) &&
+			(readback.n == (uint32_t)width * height) && !readback.errors;
+}
+
+static int disp_read_lines(uint32_t* payload)
+{	static uint8_t line[SCR_BUFFER_SIZE]; t_color565 pixels[SIM_LCD_WIDTH]; int x, y;
+	*payload = SIM_LCD_WIDTH * SIM_LCD_HEIGHT * 3;
+	readback.x = readback.y = 0;
+	readback.width = SIM_LCD_WIDTH;
+	readback.n = readback.errors = 0;
+	for (y = 0; y < SIM_LCD_HEIGHT; y++)
+	{
+		if (ILI9341_getpixels(0, y, SIM_LCD_WIDTH, 1, line) != HAL_OK) return 0;
+		for (x = 0; x < SIM_LCD_WIDTH; x++)
+		{
+			pixels[x] = ((line[x * 3] & 0xF8) << 8) | ((line[x * 3 + 1] & 0xFC) << 3) | (line[x * 3 + 2] >> 3);
+		}
+		readback_sink(pixels, SIM_LCD_WIDTH, NULL);
+	}
+	return !readback.errors;
+}
+
+static int disp_read_screen(uint32_t* payload)
+{
+	*payload = SIM_LCD_WIDTH * SIM_LCD_HEIGHT * 3;
+	return read_window(0, 0, SIM_LCD_WIDTH, SIM_LCD_HEIGHT, ILI9341_READBACK_CHUNK);
+}
+
+static int disp_read_rect(uint32_t* payload)
+{
+	*payload = 37 * 23 * 3;
+	return read_window(IMAGE_X + 3, IMAGE_Y + 5, 37, 23, 100) && (ILI9341_readback(200, 300, 41, 20, readback_sink, NULL) != HAL_OK);
+}
+
+/*
+ * Screenshot: the BMP file on the card is checked against the frame memory, the headers, the rows, and the row
+ * padding. It should take the time of the readback, the SD card writes in the shadow of the display reads.
+ */
+
+static uint32_t shot_byte(uint32_t offset)
+{
+	return sim_sd_data(SIM_SHOT_BLOCK + offset / SDHX_BLOCSIZE, offset % SDHX_BLOCSIZE);
+}
+
+static uint32_t shot_word(uint32_t offset)
+{
+	return shot_byte(offset) | (shot_byte(offset + 1) << 8) | (shot_byte(offset + 2) << 16) | (shot_byte(offset + 3) << 24);
+}
+
+static int shot_check(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, uint32_t* payload)
+{	uint32_t stride = (width * 2 + 3) & ~3, offset; int x, y;
+	*payload = ScreenshotSize(width, height);
+	if ((shot_byte(0) != 'B') || (shot_byte(1) != 'M') || (shot_word(2) != *payload) || (shot_word(10) != 66) ||
+		(shot_word(18) != width) || (shot_word(22) != -(uint32_t)height) || ((shot_word(26) >> 16) != 16) ||
+		(shot_word(30) != 3) || (shot_word(54) != 0xF800) || (shot_word(58) != 0x07E0) || (shot_word(62) != 0x001F)) return 0;
+	for (y = 0; y < height; y++)
+	{
+		offset = 66 + y * stride;
+		for (x = 0; x < width; x++, offset += 2)
+		{
+			if ((shot_byte(offset) | (shot_byte(offset + 1) << 8)) != sim_lcd_rgb565(x0 + x, y0 + y)) return 0;
+		}
+		for (; offset < 66 + (y + 1) * stride; offset++)
+		{
+			if (shot_byte(offset)) return 0;
+		}
+	}
+	return 1;
+}
+
+static int disp_shot(uint32_t* payload)
+{
+	return (Screenshot(SIM_SHOT_BLOCK) == HAL_OK) && shot_check(0, 0, SIM_LCD_WIDTH, SIM_LCD_HEIGHT, payload);
+}
+
+static int disp_shot_rect(uint32_t* payload)
+{
+	return (ScreenshotToSD(SIM_SHOT_BLOCK, IMAGE_X + 3, IMAGE_Y + 5, 37, 23) == HAL_OK) &&
+			shot_check(IMAGE_X + 3, IMAGE_Y + 5, 37, 23, payload);
+}
+
+/* @brief bitmap(bpp, payload) Show an image of the bpp format, the RGB565 images are converted in RGB666 mode. */
+
+static int bitmap(uint8_t bpp, uint32_t* payload)
+{	uint32_t i; int x, y;
+	image.width = 160;
+	image.height = 100;
+	image.bytes_per_pixel = bpp;
+	for (i = 0; i < sizeof(image.pixel_data); i++)
+	{
+		/* RGB666: the lower 2 bits are not used. */
+		image.pixel_data[i] = (uint8_t)(i * 13 + (i >> 9)) & ((bpp == 3) ? 0xFC : 0xFF);
+	}
+	*payload = image.width * image.height * ILI9341_BytesPerPixel();
+	if (ILI9341_displaybitmap(BITMAP_X, BITMAP_Y, image.width, image.height, &image) != HAL_OK) return 0;
+	for (y = 0; y < image.height; y++)
+	{
+		for (x = 0; x < image.width; x++)
+		{
+			if (sim_lcd_pixel(BITMAP_X + x, BITMAP_Y + y) != pixel_666(&image.pixel_data[(y * image.width + x) * bpp], bpp)) return 0;
+		}
+	}
+	return 1;
+}
+
+static int disp_bitmap(uint32_t* payload)
+{
+	return bitmap(ILI9341_BytesPerPixel(), payload);
+}
+
+static int disp_bitmap_565(uint32_t* payload)
+{
+	return bitmap(2, payload);
+}
+
+static int stream(uint32_t* payload)
+{	uint32_t n, offset; uint8_t data[ILI9341_MAX_BYTES_PER_PIXEL]; uint8_t bpp = ILI9341_BytesPerPixel(); int i;
+	*payload = SIM_LCD_WIDTH * SIM_LCD_HEIGHT * bpp;
+	if (StreamImageFromSD(SIM_STREAM_BLOCK, 0, 0, SIM_LCD_WIDTH, SIM_LCD_HEIGHT) != HAL_OK) return 0;
+	for (n = 0; n < SIM_LCD_WIDTH * SIM_LCD_HEIGHT; n++)
+	{
+		for (i = 0; i < bpp; i++)
+		{
+			offset = n * bpp + i;
+			data[i] = sim_sd_data(SIM_STREAM_BLOCK + offset / SDHX_BLOCSIZE, offset % SDHX_BLOCSIZE);
+		}
+		/* RGB666: the lower 2 bits of the bytes are not used. */
+		if (sim_lcd_pixel(n % SIM_LCD_WIDTH, n / SIM_LCD_WIDTH) != pixel_666(data, bpp)) return 0;
+	}
+	return 1;
+}
+
+/*
+ * Scenario. run() gives back the useful bytes of the scenario in the payload. The display scenarios
+ * run in the given pixel format (0: in the current format).
+ */
+
+typedef struct {
+	const char* name;
+	int (*run)(uint32_t* payload);
+	e_ili9341_format format;
+} s_scenario;
+
+static const s_scenario scenarios[] = {
+	{"sd_block_poll",	sd_block_poll,	0},
+	{"sd_block_dma",	sd_block_dma,	0},
+	{"sd_block_async",	sd_block_async,	0},
+	{"disp_setaddr",	disp_setaddr,	0},
+	{"disp_rects",		disp_rects,		ILI9341_RGB565},
+	{"disp_fill_666",	disp_fill,		ILI9341_RGB666},
+	{"disp_fill_565",	disp_fill,		ILI9341_RGB565},
+	{"disp_clear_666",	disp_clear,		ILI9341_RGB666},
+	{"disp_bitmap_666",	disp_bitmap,	ILI9341_RGB666},
+	{"disp_bitmap_565",	disp_bitmap,	ILI9341_RGB565},
+	{"disp_bitmap_conv",	disp_bitmap_565,	ILI9341_RGB666},
+	{"disp_grad_serial",	disp_gradient_serial,	ILI9341_RGB565},
+	{"disp_grad_stream",	disp_gradient,	ILI9341_RGB565},
+	{"disp_grad_666",	disp_gradient,	ILI9341_RGB666},
+	{"disp_dash_full",	disp_dash_full,	ILI9341_RGB565},
+	{"disp_dash_dirty",	disp_dash_dirty,	ILI9341_RGB565},
+	{"disp_frame_direct",	disp_frame_direct,	ILI9341_RGB565},
+	{"disp_frame_band",	disp_frame_band,	ILI9341_RGB565},
+	{"disp_frame_d666",	disp_frame_direct,	ILI9341_RGB666},
+	{"disp_frame_b666",	disp_frame_band,	ILI9341_RGB666},
+	{"disp_dlist_666",	disp_dlist_full,	ILI9341_RGB666},
+	{"disp_dlist_565",	disp_dlist_full,	ILI9341_RGB565},
+	{"disp_dlist_wins",	disp_dlist_windows,	ILI9341_RGB565},
+	{"disp_dlist_damage",	disp_dlist_damage,	ILI9341_RGB565},
+	{"disp_text_565",	disp_text,		ILI9341_RGB565},
+	{"disp_text_666",	disp_text,		ILI9341_RGB666},
+	{"disp_text_chars",	disp_text_chars,	ILI9341_RGB565},
+	{"disp_text_lines",	disp_text_lines,	ILI9341_RGB565},
+	{"disp_console",	disp_console,	ILI9341_RGB565},
+	{"disp_console_burst",	disp_console_burst,	ILI9341_RGB565},
+	{"disp_geom_plot",	disp_geom_plot,	ILI9341_RGB565},
+	{"disp_geom_lines",	disp_geom_lines,	ILI9341_RGB565},
+	{"disp_geom_shapes",	disp_geom_shapes,	ILI9341_RGB565},
+	{"disp_geom_666",	disp_geom_shapes,	ILI9341_RGB666},
+	{"disp_image_ref",	disp_image_ref,	ILI9341_RGB565},
+	{"disp_image_raw",	disp_image_raw,	ILI9341_RGB565},
+	{"disp_image_rle",	disp_image_rle,	ILI9341_RGB565},
+	{"disp_image_r666",	disp_image_rle,	ILI9341_RGB666},
+	{"disp_indexed_565",	disp_indexed,	ILI9341_RGB565},
+	{"disp_indexed_666",	disp_indexed,	ILI9341_RGB666},
+	{"disp_icons_raw",	disp_icons_raw,	ILI9341_RGB565},
+	{"disp_icons_4bpp",	disp_icons,		ILI9341_RGB565},
+	{"disp_read_lines",	disp_read_lines,	ILI9341_RGB565},
+	{"disp_read_565",	disp_read_screen,	ILI9341_RGB565},
+	{"disp_read_666",	disp_read_screen,	ILI9341_RGB666},
+	{"disp_read_rect",	disp_read_rect,	ILI9341_RGB565},
+	{"disp_shot",		disp_shot,		ILI9341_RGB565},
+	{"disp_shot_666",	disp_shot,		ILI9341_RGB666},
+	{"disp_shot_rect",	disp_shot_rect,	ILI9341_RGB565},
+	{"stream_666",		stream,			ILI9341_RGB666},
+	{"stream_565",		stream,			ILI9341_RGB565},
+};
+
+static void print_bus(const char* name, SPI_TypeDef* spi)
+{	s_sim_bus_stats* st = sim_stats(spi);
+	printf("  %s  %8llu B  %6llu CS  %6llu DC  %5llu DMA  %9.1f us wire%s\n", name,
+			(unsigned long long)st->wire_bytes, (unsigned long long)st->transactions, (unsigned long long)st->dc_edges,
+			(unsigned long long)st->dma_xfers, st->wire_ps / 1e6, st->conflicts ? "  BUS CONFLICT" : "");
+	if (st->conflicts) failures++;
+}
+
+static void run_scenario(const s_scenario* sc)
+{	uint64_t start; double us; int ok; uint32_t errors = sim_sd_errors, payload = 0;
+	if (sc->format && (ILI9341_SetPixelFormat(sc->format) != HAL_OK)) failures++;
+	sim_stats_reset();
+	items = 0;
+	start = sim_now();
+	ok = sc->run(&payload) && (sim_sd_errors == errors);
+	us = (sim_now() - start) / 1e6;
+	printf("%-16s %-4s %10.1f us  %7u B  %8.1f kB/s\n", sc->name, ok ? "OK" : "FAIL", us, payload,
+			payload / us * 1e6 / 1024);
+	if (items) printf("  %u %s, %.0f %s/s\n", items, items_name, items / us * 1e6, items_name);
+	print_bus("SPI1", SPI1);
+	print_bus("SPI2", SPI2);
+	if (!ok) failures++;
+}
+
+int main()
+{	unsigned int i;
+	sim_attach(DISPLAY_SPI_CHANNEL, DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN, DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN, &sim_ili9341);
+	sim_attach(SD_SPI_CHANNEL, SD_CARD_CS_PORT, SD_CARD_CS_PIN, NULL, 0, &sim_sd);
+
+	DISPLAY_SPI1_Init();
+	ILI9341_Init();
+	SD_SPI2_Init();
+	SD_Card_SPI_Select();
+	if ((ResetCard() != SD_SPI_OK) || (SPIModeInitialize() != SD_SPI_OK) || (SetFastSPI() != SD_SPI_OK))
+	{
+		printf("SD card init failed\n");
+		return 1;
+	}
+	printf("SPI1 display: write %u Hz, read %u Hz\n", (unsigned)SPI_ClockHz(&display_spi1_bus, display_spi1_bus.write_prescaler),
+			(unsigned)SPI_ClockHz(&display_spi1_bus, display_spi1_bus.read_prescaler));
+	printf("SPI2 SD card: %u Hz\n", (unsigned)SPI_ClockHz(&sd_spi2_bus, sd_spi2_bus.write_prescaler));
+	printf("init             %10.1f us\n\n", sim_now() / 1e6);
+
+	for (i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+	{
+		run_scenario(&scenarios[i]);
+	}
+	if (sim_sd_errors) printf("SD card protocol errors: %u\n", sim_sd_errors);
+	printf("%s\n", failures ? "FAILED" : "PASSED");
+	return failures ? 1 : 0;
+}
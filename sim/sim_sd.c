@@ -0,0 +1,294 @@
+/*
+ * SD card model in SPI mode. SDHC card (block addressing, CCS = 1) with SIM_SD_BLOCKS
+ * blocks. It knows the commands of the initialization flow, the register reads, the
+ * single block read, and the multiple block write. The data block comes after the
+ * SIM_SD_ACCESS_PS access time, the card sends 0xFF bytes until then. A written block is
+ * busy (0x00 bytes) for SIM_SD_PROG_PS after its data response.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "sim.h"
+
+#define SIM_SD_ACCESS_PS	100000000ULL	// Read access time (100 us).
+#define SIM_SD_REG_PS		10000000ULL		// Access time of the CID, CSD registers.
+#define SIM_SD_ACMD41		2				// ACMD41 count of the power up.
+#define SIM_SD_PROG_PS		200000000ULL	// Programming time of a written block (200 us).
+
+#define SD_OUT_MAX	(1 + 5 + 1 + 512 + 2)
+
+static const uint8_t sd_csd[16] = {0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00, 0x00, 0x1D, 0x8A, 0x7F, 0x80, 0x0A, 0x40, 0x00, 0x00};
+static const uint8_t sd_cid[16] = {0x03, 'S', 'D', 'S', 'I', 'M', 'S', 'D', 0x10, 0x12, 0x34, 0x56, 0x78, 0x01, 0x1A, 0x00};
+
+static struct {
+	uint8_t cmd[6];			// The command under receive.
+	uint8_t cmd_pos;
+	uint8_t out[SD_OUT_MAX];	// The response, and the data block.
+	uint16_t out_len;
+	uint16_t out_pos;
+	uint16_t token_pos;		// Index of the start block token in out, the card waits there for the access time.
+	uint64_t token_time;
+	uint8_t idle;
+	uint8_t app;
+	uint8_t acmd41;
+	uint8_t crc_on;
+	uint8_t writing;		// CMD25 multiple block write: the card takes data tokens.
+	uint32_t wr_block;		// The next block to write.
+	uint16_t in_pos;		// Received bytes of the data block, token included (0: waiting for the token).
+	uint8_t in[1 + 512 + 2];
+	uint8_t wr_response;	// The data response token to send, 0: none.
+	uint64_t busy_time;		// The card is busy until then.
+} card;
+
+/* The written blocks, the rest of the card is sim_sd_data(). */
+static uint8_t sd_store[SIM_SD_BLOCKS][512];
+static uint8_t sd_written[SIM_SD_BLOCKS];
+
+uint32_t sim_sd_errors;
+
+uint8_t sim_sd_data(uint32_t block, uint32_t i)
+{
+	if ((block < SIM_SD_BLOCKS) && sd_written[block]) return sd_store[block][i];
+	return (uint8_t)(block * 31 + i * 7 + (i >> 8));
+}
+
+static uint8_t sd_crc7(const uint8_t* data, int length)
+{	uint8_t crc = 0; int i, j;
+	for (i = 0; i < length; i++)
+	{
+		for (j = 7; j >= 0; j--)
+		{
+			crc <<= 1;
+			if (((data[i] >> j) ^ (crc >> 7)) & 1) crc ^= 0x09;
+		}
+	}
+	return crc & 0x7F;
+}
+
+static uint16_t sd_crc16(const uint8_t* data, int length)
+{	uint16_t crc = 0; int i, j;
+	for (i = 0; i < length; i++)
+	{
+		crc ^= data[i] << 8;
+		for (j = 0; j < 8; j++)
+		{
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+static void sd_out(uint8_t b)
+{
+	card.out[card.out_len++] = b;
+}
+
+/* @brief sd_block(data, size, access) The start block token after the access time, the data, and the CRC16. */
+
+static void sd_block(const uint8_t* data, int size, uint64_t access)
+{	uint16_t crc = sd_crc16(data, size);
+	card.token_pos = card.out_len;
+	card.token_time = sim_now() + access;
+	sd_out(0xFE);
+	memcpy(&card.out[card.out_len], data, size);
+	card.out_len += size;
+	sd_out(crc >> 8);
+	sd_out(crc);
+}
+
+static void sd_register(const uint8_t* reg)
+{	uint8_t data[16];
+	memcpy(data, reg, 15);
+	data[15] = (sd_crc7(data, 15) << 1) | 1;
+	sd_block(data, 16, SIM_SD_REG_PS);
+}
+
+static void sd_command()
+{	uint8_t index = card.cmd[0] & 0x3F, r1, app = card.app; uint8_t data[512]; int i;
+	uint32_t arg = ((uint32_t)card.cmd[1] << 24) | ((uint32_t)card.cmd[2] << 16) | (card.cmd[3] << 8) | card.cmd[4];
+	card.out_len = card.out_pos = 0;
+	card.token_pos = 0xFFFF;
+	card.app = 0;
+	sd_out(0xFF);	// NCR
+	/* CMD0, and CMD8 have CRC check always. */
+	if ((card.crc_on || (index == 0) || (index == 8)) && (card.cmd[5] != ((sd_crc7(card.cmd, 5) << 1) | 1)))
+	{
+		sim_sd_errors++;
+		sd_out(card.idle | 0x08);
+		return;
+	}
+	r1 = card.idle;
+	switch (index)
+	{
+	case 0:
+		card.idle = 1;
+		card.acmd41 = 0;
+		sd_out(0x01);
+		break;
+	case 8:
+		sd_out(r1);
+		sd_out(0x00);
+		sd_out(0x00);
+		sd_out(card.cmd[3] & 0x0F);
+		sd_out(card.cmd[4]);
+		break;
+	case 9:
+		sd_out(r1);
+		sd_register(sd_csd);
+		break;
+	case 10:
+		sd_out(r1);
+		sd_register(sd_cid);
+		break;
+	case 16:
+		sd_out((arg == 512) ? r1 : r1 | 0x40);
+		break;
+	case 17:
+		if (arg >= SIM_SD_BLOCKS)
+		{
+			sim_sd_errors++;
+			sd_out(r1 | 0x20);	// Address error.
+			break;
+		}
+		sd_out(r1);
+		for (i = 0; i < 512; i++)
+		{
+			data[i] = sim_sd_data(arg, i);
+		}
+		sd_block(data, 512, SIM_SD_ACCESS_PS);
+		break;
+	case 25:
+		if (arg >= SIM_SD_BLOCKS)
+		{
+			sim_sd_errors++;
+			sd_out(r1 | 0x20);
+			break;
+		}
+		sd_out(r1);
+		card.writing = 1;
+		card.wr_block = arg;
+		card.in_pos = 0;
+		break;
+	case 55:
+		card.app = 1;
+		sd_out(r1);
+		break;
+	case 41:
+		if (!app)
+		{
+			sim_sd_errors++;
+			sd_out(r1 | 0x04);
+			break;
+		}
+		if (++card.acmd41 >= SIM_SD_ACMD41) card.idle = 0;
+		sd_out(card.idle);
+		break;
+	case 58:
+		sd_out(r1);
+		sd_out((card.idle ? 0x00 : 0x80) | 0x40);	// Power up status, CCS.
+		sd_out(0xFF);
+		sd_out(0x80);
+		sd_out(0x00);
+		break;
+	case 59:
+		card.crc_on = arg & 1;
+		sd_out(r1);
+		break;
+	default:
+		sim_sd_errors++;
+		sd_out(r1 | 0x04);	// Illegal command.
+	}
+}
+
+/*
+ * @brief sd_write(mosi) The multiple block write: the start block token, the data, the CRC16, then the data response
+ * token, and the busy. The stop transmission token ends the write with a busy.
+ */
+
+static uint8_t sd_write(uint8_t mosi)
+{	uint8_t miso;
+	if (card.wr_response)
+	{
+		miso = card.wr_response;
+		card.wr_response = 0;
+		card.busy_time = sim_now() + SIM_SD_PROG_PS;
+		return miso;
+	}
+	if (card.in_pos)
+	{
+		card.in[card.in_pos++] = mosi;
+		if (card.in_pos < sizeof(card.in)) return 0xFF;
+		card.in_pos = 0;
+		if ((card.wr_block >= SIM_SD_BLOCKS) || (card.crc_on && (sd_crc16(&card.in[1], 512) != ((card.in[513] << 8) | card.in[514]))))
+		{
+			sim_sd_errors++;
+			card.wr_response = (card.wr_block >= SIM_SD_BLOCKS) ? 0x0D : 0x0B;
+			return 0xFF;
+		}
+		memcpy(sd_store[card.wr_block], &card.in[1], 512);
+		sd_written[card.wr_block++] = 1;
+		card.wr_response = 0x05;
+		return 0xFF;
+	}
+	switch (mosi)
+	{
+	case 0xFC:
+		card.in[0] = mosi;
+		card.in_pos = 1;
+		break;
+	case 0xFD:
+		card.writing = 0;
+		card.busy_time = sim_now() + SIM_SD_PROG_PS;
+		break;
+	case 0xFF:
+		break;
+	default:
+		sim_sd_errors++;
+	}
+	return 0xFF;
+}
+
+/*
+ * The card does not listen to the MOSI while it sends a data block. Else a byte with 01 at
+ * the top starts a new command, and drops the rest of the earlier response.
+ */
+
+static uint8_t sd_exchange(s_sim_device* dev, uint8_t mosi, uint8_t dc)
+{	uint8_t miso = 0xFF; uint8_t in_block = (card.out_pos >= card.token_pos) && (card.out_pos < card.out_len);
+	/* The busy card holds the data line low, and does not listen. */
+	if (sim_now() < card.busy_time) return 0x00;
+	if (card.writing && (card.out_pos >= card.out_len)) return sd_write(mosi);
+	if (card.out_pos < card.out_len)
+	{
+		if ((card.out_pos != card.token_pos) || (sim_now() >= card.token_time)) miso = card.out[card.out_pos++];
+	}
+	if (in_block) return miso;
+	if (card.cmd_pos)
+	{
+		card.cmd[card.cmd_pos++] = mosi;
+		if (card.cmd_pos == sizeof(card.cmd))
+		{
+			card.cmd_pos = 0;
+			sd_command();
+		}
+	} else if ((mosi & 0xC0) == 0x40)
+	{
+		card.cmd[0] = mosi;
+		card.cmd_pos = 1;
+	}
+	return miso;
+}
+
+static void sd_reset(s_sim_device* dev)
+{
+	memset(&card, 0, sizeof(card));
+	card.token_pos = 0xFFFF;
+	card.idle = 1;
+}
+
+s_sim_device sim_sd = {
+	.name = "SD card",
+	.exchange = sd_exchange,
+	.select = NULL,
+	.reset = sd_reset
+};
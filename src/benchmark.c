@@ -0,0 +1,686 @@
+
+/*
+ * Driver benchmarks. Every benchmark measures the same work on the earlier
+ * path and on the new path with the DWT cycle counter.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "benchmark.h"
+#include "spi.h"
+#include "sd_spi.h"
+#include "ili9341_spi.h"
+#include "ili9341_font.h"
+#include "ili9341_console.h"
+#include "ili9341_geom.h"
+#include "ili9341_image.h"
+#include "images/dialog.h"
+#include "images/icons.h"
+#include "fonts/font5x7.h"
+#include "fonts/font10x16.h"
+#include "fonts/font10x16aa.h"
+#include "stream.h"
+
+s_bench_result bench_sd_poll;
+s_bench_result bench_sd_burst;
+s_bench_result bench_fill_frames;
+s_bench_result bench_blit_frames;
+s_bench_result bench_sd_blocks;
+s_bench_result bench_pins;
+s_bench_result bench_fill_format;
+s_bench_result bench_rects;
+s_bench_result bench_clear;
+s_bench_result bench_stream;
+s_bench_result bench_text;
+s_bench_result bench_text_aa;
+s_bench_result bench_console;
+s_bench_result bench_geom;
+s_bench_result bench_image;
+s_bench_result bench_indexed;
+s_bench_result bench_readback;
+
+static uint8_t bench_buffer[BENCH_BYTES];
+
+/* @brief Bench_Init() Enable the DWT cycle counter. */
+
+void Bench_Init()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*
+ * @brief Bench_Rate(result) The throughputs of the result from the cycles.
+ */
+
+static void Bench_Rate(s_bench_result* result)
+{
+	if (result->cycles_ref) result->rate_ref = (uint64_t)result->bytes * SystemCoreClock / result->cycles_ref;
+	if (result->cycles_new) result->rate_new = (uint64_t)result->bytes * SystemCoreClock / result->cycles_new;
+}
+
+/*
+ * @brief Bench_SDPoll() SD card token polling one byte at a time. The card is
+ * deselected, so the card does not see the clocks.
+ */
+
+static void Bench_SDPoll()
+{	uint32_t start; int i; uint8_t in;
+
+	DESELECT_SD();
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BYTES; i++)
+	{
+		SPI_ReadByte(&sd_spi2_bus, &in, SD_SPI2_TIMEOUT);
+	}
+	bench_sd_poll.cycles_ref = Bench_Cycles() - start;
+
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BYTES; i++)
+	{
+		in = SPI_Exchange(&sd_spi2_bus, SD_DUMMY_BYTE);
+	}
+	bench_sd_poll.cycles_new = Bench_Cycles() - start;
+	bench_sd_poll.bytes = BENCH_BYTES;
+}
+
+/*
+ * @brief Bench_SDBurst() Multiple bytes responses (R3/R7 are 4 bytes long).
+ */
+
+static void Bench_SDBurst()
+{	uint32_t start; int i;
+
+	DESELECT_SD();
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BYTES; i += 4)
+	{
+		SPI_ReadBuf(&sd_spi2_bus, &bench_buffer[i], 4, SD_SPI2_TIMEOUT);
+	}
+	bench_sd_burst.cycles_ref = Bench_Cycles() - start;
+
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BYTES; i += 4)
+	{
+		SPI_ExchangeBuf(&sd_spi2_bus, NULL, &bench_buffer[i], 4);
+	}
+	bench_sd_burst.cycles_new = Bench_Cycles() - start;
+	bench_sd_burst.bytes = BENCH_BYTES;
+}
+
+/*
+ * @brief Bench_Pins() The line changes around one command byte (CS low, DC low, DC high, CS high)
+ * with HAL_GPIO_WritePin(), and with the line macros.
+ */
+
+static void Bench_Pins()
+{	uint32_t start; int i;
+
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BYTES; i++)
+	{
+		HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN, GPIO_PIN_RESET);
+		HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN, GPIO_PIN_RESET);
+		HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_DC_PIN, GPIO_PIN_SET);
+		HAL_GPIO_WritePin(DISPLAY_CONTROL_PORT, DISPLAY_CS_PIN, GPIO_PIN_SET);
+	}
+	bench_pins.cycles_ref = Bench_Cycles() - start;
+
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BYTES; i++)
+	{
+		SELECT_DISPLAY();
+		SELECT_COMMAND();
+		SELECT_DATA();
+		DESELECT_DISPLAY();
+	}
+	bench_pins.cycles_new = Bench_Cycles() - start;
+}
+
+/*
+ * @brief Bench_FrameFill(frame16) Full screen of RGB565 pixels from the bench buffer, in 8, or 16 bit frames.
+ */
+
+static uint32_t Bench_FrameFill(uint8_t frame16)
+{	uint32_t start, remain = 240UL * 320 * 2;
+	ILI9341_setaddr(0, 0, 239, 319);
+	ILI9341_writecmd(ILI9341_RAMWR);
+	SELECT_DISPLAY();
+	SELECT_DATA();
+	start = Bench_Cycles();
+	while (remain)
+	{
+		if (frame16)
+		{
+			SPI_WriteBufDMA16(&display_spi1_bus, bench_buffer, BENCH_BYTES, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+		} else
+		{
+			SPI_WriteBufDMA(&display_spi1_bus, bench_buffer, BENCH_BYTES, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+		}
+		remain -= BENCH_BYTES;
+	}
+	start = Bench_Cycles() - start;
+	DESELECT_DISPLAY();
+	return start;
+}
+
+/*
+ * @brief Bench_FrameBlit(frame16) 160x120 RGB565 pixels in one DMA transfer from the flash, in 8, or 16 bit frames.
+ * The content of the flash is not an image, only the timing is interesting.
+ */
+
+static uint32_t Bench_FrameBlit(uint8_t frame16)
+{	uint32_t start; uint16_t size = 160 * 120 * 2;
+	ILI9341_setaddr(0, 0, 159, 119);
+	ILI9341_writecmd(ILI9341_RAMWR);
+	SELECT_DISPLAY();
+	SELECT_DATA();
+	start = Bench_Cycles();
+	if (frame16)
+	{
+		SPI_WriteBufDMA16(&display_spi1_bus, (const void*)FLASH_BASE, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	} else
+	{
+		SPI_WriteBufDMA(&display_spi1_bus, (const void*)FLASH_BASE, size, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+	}
+	start = Bench_Cycles() - start;
+	DESELECT_DISPLAY();
+	return start;
+}
+
+static void Bench_Frames()
+{
+	bench_fill_frames.cycles_ref = Bench_FrameFill(0);
+	bench_fill_frames.cycles_new = Bench_FrameFill(1);
+	bench_fill_frames.bytes = 240UL * 320 * 2;
+	bench_blit_frames.cycles_ref = Bench_FrameBlit(0);
+	bench_blit_frames.cycles_new = Bench_FrameBlit(1);
+	bench_blit_frames.bytes = 160 * 120 * 2;
+}
+
+/*
+ * @brief Bench_Formats() Full screen fill in both pixel formats. The pixel format of the display is restored.
+ */
+
+static void Bench_Formats()
+{	uint32_t start; e_ili9341_format format = ili9341_format; t_color color = {0x20, 0x84, 0x84};
+	ILI9341_SetPixelFormat(ILI9341_RGB666);
+	start = Bench_Cycles();
+	ILI9341_fillrectangle(0, 0, 240, 320, color);
+	bench_fill_format.cycles_ref = Bench_Cycles() - start;
+	ILI9341_SetPixelFormat(ILI9341_RGB565);
+	start = Bench_Cycles();
+	ILI9341_fillrectangle(0, 0, 240, 320, color);
+	bench_fill_format.cycles_new = Bench_Cycles() - start;
+	bench_fill_format.bytes = 240UL * 320;
+	ILI9341_SetPixelFormat(format);
+}
+
+/*
+ * @brief Bench_Clear() Full screen RGB565 clear. The reference is the earlier fill: the color in a SCR_BUFFER_IN_PIXELS
+ * pixels buffer, sent in buffer sized DMA chunks. The new is ILI9341_fillrectangle() with the fixed DMA source.
+ */
+
+static void Bench_Clear()
+{	uint32_t start, remain = 240UL * 320 * 2; e_ili9341_format format = ili9341_format; t_color color = {0, 0, 0};
+	uint16_t chunk = SCR_BUFFER_IN_PIXELS * 2; int i;
+	ILI9341_SetPixelFormat(ILI9341_RGB565);
+	start = Bench_Cycles();
+	for (i = 0; i < SCR_BUFFER_IN_PIXELS; i++)
+	{
+		((t_color565*)bench_buffer)[i] = ILI9341_Color565(color);
+	}
+	ILI9341_setaddr(0, 0, 239, 319);
+	ILI9341_writecmd(ILI9341_RAMWR);
+	SELECT_DISPLAY();
+	SELECT_DATA();
+	while (remain)
+	{
+		SPI_WriteBufDMA16(&display_spi1_bus, bench_buffer, (remain > chunk) ? chunk : remain, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+		remain -= (remain > chunk) ? chunk : remain;
+	}
+	DESELECT_DISPLAY();
+	bench_clear.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	ILI9341_fillrectangle(0, 0, 240, 320, color);
+	bench_clear.cycles_new = Bench_Cycles() - start;
+	bench_clear.bytes = 240UL * 320 * 2;
+	ILI9341_SetPixelFormat(format);
+}
+
+/* @brief Bench_Gradient(buffer, pixels, arg) RGB565 gradient pixel source, arg is the next pixel number. */
+
+static uint8_t Bench_Gradient(void* buffer, uint16_t pixels, void* arg)
+{	uint32_t* n = arg; uint16_t i; t_color color;
+	for (i = 0; i < pixels; i++, (*n)++)
+	{
+		color[0] = *n % 240;
+		color[1] = *n / 240;
+		color[2] = color[0] + color[1];
+		((t_color565*)buffer)[i] = ILI9341_Color565(color);
+	}
+	return 1;
+}
+
+/*
+ * @brief Bench_Stream() Full screen RGB565 gradient. The reference makes a buffer, sends it, and waits (one buffer),
+ * the new is the ping-pong streaming stage.
+ */
+
+static void Bench_Stream()
+{	uint32_t start, n = 0, remain = 240UL * 320; uint16_t pixels; e_ili9341_format format = ili9341_format;
+	ILI9341_SetPixelFormat(ILI9341_RGB565);
+	start = Bench_Cycles();
+	ILI9341_setaddr(0, 0, 239, 319);
+	ILI9341_writecmd(ILI9341_RAMWR);
+	SELECT_DISPLAY();
+	SELECT_DATA();
+	while (remain)
+	{
+		pixels = (remain > BENCH_BYTES / 2) ? BENCH_BYTES / 2 : remain;
+		Bench_Gradient(bench_buffer, pixels, &n);
+		SPI_WriteBufDMA16(&display_spi1_bus, bench_buffer, pixels * 2, DISPLAY_SPI_TRANSMIT_TIMEOUT);
+		remain -= pixels;
+	}
+	DESELECT_DISPLAY();
+	bench_stream.cycles_ref = Bench_Cycles() - start;
+	n = 0;
+	start = Bench_Cycles();
+	ILI9341_stream(0, 0, 240, 320, Bench_Gradient, &n);
+	bench_stream.cycles_new = Bench_Cycles() - start;
+	bench_stream.bytes = 240UL * 320 * 2;
+	ILI9341_SetPixelFormat(format);
+}
+
+/*
+ * @brief Bench_Text() BENCH_TEXT_LINES lines of text with font5x7. The reference draws every character in its own
+ * window, the new draws a line in one window.
+ */
+
+static void Bench_Text()
+{	static const char line[] = "Log 0042: SPI1 DMA window 240x8 done ok"; char c[2] = {0, 0}; uint32_t start; uint16_t x, y;
+	const char* s; t_color color = {0xFF, 0xFF, 0xFF}, background = {0x00, 0x00, 0x00};
+	start = Bench_Cycles();
+	for (y = 0; y < BENCH_TEXT_LINES * font5x7.height; y += font5x7.height)
+	{
+		for (x = 0, s = line; *s; s++)
+		{
+			c[0] = *s;
+			ILI9341_DrawText(x, y, &font5x7, c, color, background);
+			x += ILI9341_TextWidth(&font5x7, s, 2) - ILI9341_TextWidth(&font5x7, s + 1, 1);
+		}
+	}
+	bench_text.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	for (y = 0; y < BENCH_TEXT_LINES * font5x7.height; y += font5x7.height)
+	{
+		ILI9341_DrawText(0, y, &font5x7, line, color, background);
+	}
+	bench_text.cycles_new = Bench_Cycles() - start;
+	bench_text.bytes = BENCH_TEXT_LINES * (sizeof(line) - 1);
+}
+
+/*
+ * @brief Bench_TextAA() BENCH_TEXT_AA_LINES lines of 2x size text. The reference is the 1 bpp font10x16, the new is the
+ * 4 bpp anti-aliased font10x16aa (the blend table lookups), with the same glyph shapes.
+ */
+
+static void Bench_TextAA()
+{	static const char line[] = "T = 23.5 C  P = 1013 hPa"; uint32_t start; uint16_t y;
+	t_color color = {0xFF, 0xC0, 0x20}, background = {0x10, 0x20, 0x40};
+	start = Bench_Cycles();
+	for (y = 0; y < BENCH_TEXT_AA_LINES * font10x16.height; y += font10x16.height)
+	{
+		ILI9341_DrawText(0, y, &font10x16, line, color, background);
+	}
+	bench_text_aa.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	for (y = 0; y < BENCH_TEXT_AA_LINES * font10x16aa.height; y += font10x16aa.height)
+	{
+		ILI9341_DrawText(0, y, &font10x16aa, line, color, background);
+	}
+	bench_text_aa.cycles_new = Bench_Cycles() - start;
+	bench_text_aa.bytes = BENCH_TEXT_AA_LINES * (sizeof(line) - 1);
+}
+
+/* @brief Bench_ConsoleLine(line, n) The log line of the number n (4 digits). */
+
+static void Bench_ConsoleLine(char* line, uint16_t n)
+{	int i;
+	for (i = 7; i >= 4; i--, n /= 10)
+	{
+		line[i] = '0' + n % 10;
+	}
+}
+
+/*
+ * @brief Bench_Console() BENCH_CONSOLE_LINES log lines on a full screen console with font5x7, a line at a time. The
+ * reference redraws the visible rows after every line (software scroll), the new draws one row, and moves the
+ * hardware scroll start.
+ */
+
+static void Bench_Console()
+{	static s_ili9341_console console; static char line[] = "Log 0000: SPI1 DMA window 240x8 done ok"; uint32_t start;
+	uint16_t n, row, rows = ILI9341_HEIGHT / font5x7.height; t_color color = {0xFF, 0xFF, 0xFF}, background = {0x00, 0x00, 0x00};
+	start = Bench_Cycles();
+	for (n = 0; n < BENCH_CONSOLE_LINES; n++)
+	{
+		for (row = 0; (row < rows) && (row <= n); row++)
+		{
+			Bench_ConsoleLine(line, (n < rows) ? row : n - rows + 1 + row);
+			ILI9341_DrawTextLine(0, row * font5x7.height, ILI9341_WIDTH, &font5x7, line, sizeof(line) - 1, color, background);
+		}
+	}
+	bench_console.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	ILI9341_ConsoleInit(&console, 0, ILI9341_HEIGHT, &font5x7, color, background);
+	for (n = 0; n < BENCH_CONSOLE_LINES; n++)
+	{
+		Bench_ConsoleLine(line, n);
+		ILI9341_ConsolePuts(&console, line);
+		ILI9341_ConsoleFlush(&console);
+	}
+	bench_console.cycles_new = Bench_Cycles() - start;
+	ILI9341_ConsoleClose(&console);
+	bench_console.bytes = BENCH_CONSOLE_LINES;
+}
+
+/* @brief Bench_PlotLine(x1, y1, x2, y2, color) The Bresenham line pixel by pixel, a window per pixel. */
+
+static void Bench_PlotLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, t_color color)
+{	int16_t dx = (x2 > x1) ? x2 - x1 : x1 - x2, dy = (y2 > y1) ? y2 - y1 : y1 - y2, sx = (x2 > x1) ? 1 : -1, sy = (y2 > y1) ? 1 : -1;
+	int16_t err = ((dx >= dy) ? dx : dy) / 2;
+	for (;;)
+	{
+		ILI9341_fillrectangle(x1, y1, 1, 1, color);
+		if ((x1 == x2) && (y1 == y2)) break;
+		if (dx >= dy)
+		{
+			x1 += sx;
+			if ((err -= dy) < 0)
+			{
+				y1 += sy;
+				err += dx;
+			}
+		} else
+		{
+			y1 += sy;
+			if ((err -= dx) < 0)
+			{
+				x1 += sx;
+				err += dy;
+			}
+		}
+	}
+}
+
+/* @brief Bench_PlotCircle(x, y, r, color) The midpoint circle pixel by pixel. */
+
+static void Bench_PlotCircle(int16_t x, int16_t y, int16_t r, t_color color)
+{	int16_t px = 0, py = r, d = 1 - r;
+	while (px <= py)
+	{
+		ILI9341_fillrectangle(x + px, y + py, 1, 1, color);
+		ILI9341_fillrectangle(x - px, y + py, 1, 1, color);
+		ILI9341_fillrectangle(x + px, y - py, 1, 1, color);
+		ILI9341_fillrectangle(x - px, y - py, 1, 1, color);
+		ILI9341_fillrectangle(x + py, y + px, 1, 1, color);
+		ILI9341_fillrectangle(x - py, y + px, 1, 1, color);
+		ILI9341_fillrectangle(x + py, y - px, 1, 1, color);
+		ILI9341_fillrectangle(x - py, y - px, 1, 1, color);
+		if (d < 0) d += 2 * px + 3;
+		else d += 2 * (px - py--) + 5;
+		px++;
+	}
+}
+
+/*
+ * @brief Bench_Geom() BENCH_GEOM_PRIMS primitives: a line fan from the screen center, and circles of growing radius.
+ * The reference plots them pixel by pixel (a window per pixel), the new sends them as spans (ili9341_geom.h).
+ */
+
+static void Bench_Geom()
+{	uint32_t start; int i; t_color color = {0x40, 0xC0, 0xFF};
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_GEOM_PRIMS; i += 2)
+	{
+		Bench_PlotLine(120, 160, (i * 15) % 240, (i < BENCH_GEOM_PRIMS / 2) ? 0 : 319, color);
+		Bench_PlotCircle(120, 160, 10 + i, color);
+	}
+	bench_geom.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_GEOM_PRIMS; i += 2)
+	{
+		ILI9341_DrawLine(120, 160, (i * 15) % 240, (i < BENCH_GEOM_PRIMS / 2) ? 0 : 319, color);
+		ILI9341_DrawCircle(120, 160, 10 + i, color);
+	}
+	bench_geom.cycles_new = Bench_Cycles() - start;
+	bench_geom.bytes = BENCH_GEOM_PRIMS;
+}
+
+/* @brief Reference RLE decoder: every pixel goes through the stage buffers. */
+typedef struct {
+	const uint8_t* data;
+	uint16_t count;
+	uint8_t literal;
+} s_bench_rle;
+
+static uint8_t Bench_RLESource(void* buffer, uint16_t pixels, void* arg)
+{	s_bench_rle* rle = arg; uint8_t* dst = buffer; uint8_t token; uint16_t n;
+	while (pixels)
+	{
+		if (!rle->count)
+		{
+			token = *rle->data++;
+			rle->literal = token < 0x80;
+			if (rle->literal) rle->count = token + 1;
+			else rle->count = (token < 0xC0) ? (token & 0x3F) + 1 : (((token & 0x3F) << 8) | *rle->data++) + 1;
+		}
+		n = (rle->count < pixels) ? rle->count : pixels;
+		if (rle->literal)
+		{
+			memcpy(dst, rle->data, n * 2);
+			rle->data += n * 2;
+		} else ILI9341_span(dst, rle->data, n);
+		dst += n * 2;
+		pixels -= n;
+		if (!(rle->count -= n) && !rle->literal) rle->data += 2;
+	}
+	return 1;
+}
+
+/*
+ * @brief Bench_Image() BENCH_IMAGES blits of the RLE dialog image (RGB565). The reference decodes every pixel into the
+ * stage buffers, the new sends the long runs as DMA fills.
+ */
+
+static void Bench_Image()
+{	uint32_t start; int i; s_bench_rle rle; e_ili9341_format format = ili9341_format;
+	ILI9341_SetPixelFormat(ILI9341_RGB565);
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_IMAGES; i++)
+	{
+		rle.data = dialog.data;
+		rle.count = 0;
+		ILI9341_stream_chunks(40, 110, dialog.width, dialog.height, 12 * dialog.width, Bench_RLESource, &rle);
+	}
+	bench_image.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_IMAGES; i++)
+	{
+		ILI9341_DrawImage(40, 110, &dialog);
+	}
+	bench_image.cycles_new = Bench_Cycles() - start;
+	bench_image.bytes = BENCH_IMAGES * dialog.width * dialog.height * 2;
+	ILI9341_SetPixelFormat(format);
+}
+
+/* @brief Reference expansion of the 4 bpp icons: the palette color of every pixel converted by ILI9341_pixel(). */
+
+static uint8_t Bench_IndexedSource(void* buffer, uint16_t pixels, void* arg)
+{	const uint8_t** src = arg; uint8_t* dst = buffer; uint8_t bpp = ILI9341_BytesPerPixel();
+	for (; pixels >= 2; pixels -= 2, dst += 2 * bpp)
+	{
+		ILI9341_pixel(icons.palette[**src >> 4], dst);
+		ILI9341_pixel(icons.palette[*(*src)++ & 0x0F], dst + bpp);
+	}
+	return 1;
+}
+
+/*
+ * @brief Bench_Indexed() BENCH_INDEXED blits of the 96x32 4 bpp icons. The reference converts the palette color of every
+ * pixel, the new reads the lookup table of the palette.
+ */
+
+static void Bench_Indexed()
+{	uint32_t start; int i; const uint8_t* src;
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_INDEXED; i++)
+	{
+		src = icons.data;
+		ILI9341_stream_chunks(72, 10, icons.width, icons.height, 8 * icons.width, Bench_IndexedSource, &src);
+	}
+	bench_indexed.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_INDEXED; i++)
+	{
+		ILI9341_DrawImage(72, 10, &icons);
+	}
+	bench_indexed.cycles_new = Bench_Cycles() - start;
+	bench_indexed.bytes = BENCH_INDEXED * icons.width * icons.height * ILI9341_BytesPerPixel();
+}
+
+/* @brief Bench_ReadSink(pixels, count, arg) Sum the pixels, so the reads are not optimized out. */
+
+static uint8_t Bench_ReadSink(t_color565* pixels, uint16_t count, void* arg)
+{	uint32_t* sum = arg;
+	for (; count; count--)
+	{
+		*sum += *pixels++;
+	}
+	return 1;
+}
+
+/*
+ * @brief Bench_Readback() Full screen readback. The reference reads a line by ILI9341_getpixels(), and converts it to
+ * RGB565, the new converts a chunk while the DMA reads the next one.
+ */
+
+static void Bench_Readback()
+{	static uint8_t raw[SCR_BUFFER_SIZE]; uint32_t start, sum = 0; t_color565 line[ILI9341_WIDTH]; int x, y;
+	start = Bench_Cycles();
+	for (y = 0; y < ILI9341_HEIGHT; y++)
+	{
+		ILI9341_getpixels(0, y, ILI9341_WIDTH, 1, raw);
+		for (x = 0; x < ILI9341_WIDTH; x++)
+		{
+			line[x] = ((raw[x * 3] & 0xF8) << 8) | ((raw[x * 3 + 1] & 0xFC) << 3) | (raw[x * 3 + 2] >> 3);
+		}
+		Bench_ReadSink(line, ILI9341_WIDTH, &sum);
+	}
+	bench_readback.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	ILI9341_readback(0, 0, ILI9341_WIDTH, ILI9341_HEIGHT, Bench_ReadSink, &sum);
+	bench_readback.cycles_new = Bench_Cycles() - start;
+	bench_readback.bytes = ILI9341_WIDTH * ILI9341_HEIGHT * 3;
+}
+
+/*
+ * @brief Bench_Rects() BENCH_RECTS 8x8 rectangles at new windows (CASET, PASET every time), and on the same
+ * window (the window cache).
+ */
+
+static void Bench_Rects()
+{	uint32_t start; int i; t_color color = {0x20, 0x84, 0x84};
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_RECTS; i++)
+	{
+		ILI9341_fillrectangle((i * 8) % 232, 312 - (i % 40) * 8, 8, 8, color);
+	}
+	bench_rects.cycles_ref = Bench_Cycles() - start;
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_RECTS; i++)
+	{
+		ILI9341_fillrectangle(0, 312, 8, 8, color);
+	}
+	bench_rects.cycles_new = Bench_Cycles() - start;
+	bench_rects.bytes = BENCH_RECTS;
+}
+
+/* @brief Bench_SDBlocks(first_block) Command, token wait, data phase, and CRC of every block. */
+
+void Bench_SDBlocks(uint32_t first_block)
+{	uint32_t start, i;
+
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BLOCKS; i++)
+	{
+		ReadDataBlockPolling(SD_BlockAddress(first_block + i), bench_buffer);
+	}
+	bench_sd_blocks.cycles_ref = Bench_Cycles() - start;
+
+	start = Bench_Cycles();
+	for (i = 0; i < BENCH_BLOCKS; i++)
+	{
+		ReadDataBlock(SD_BlockAddress(first_block + i), bench_buffer);
+	}
+	bench_sd_blocks.cycles_new = Bench_Cycles() - start;
+	bench_sd_blocks.bytes = BENCH_BLOCKS * SDHX_BLOCSIZE;
+	Bench_Rate(&bench_sd_blocks);
+}
+
+#if defined (SPI_BUS_STATS)
+
+s_spi_bus_stats bench_stream_display;
+s_spi_bus_stats bench_stream_sd;
+
+/* @brief Bench_SDStream(first_block) Stream a full screen image from the SD card to the display. */
+
+void Bench_SDStream(uint32_t first_block)
+{
+	SPI_StatsReset();
+	StreamImageFromSD(first_block, 0, 0, 240, 320);
+	SPI_StatsGet(&display_spi1_bus, &bench_stream_display);
+	SPI_StatsGet(&sd_spi2_bus, &bench_stream_sd);
+}
+
+#endif
+
+/* @brief RunBenchmarks() Run all of the benchmarks. The SPI buses must be initialized. */
+
+void RunBenchmarks()
+{
+	Bench_Init();
+	Bench_SDPoll();
+	Bench_SDBurst();
+	Bench_Pins();
+	Bench_Frames();
+	Bench_Formats();
+	Bench_Rects();
+	Bench_Clear();
+	Bench_Stream();
+	Bench_Text();
+	Bench_TextAA();
+	Bench_Console();
+	Bench_Geom();
+	Bench_Image();
+	Bench_Indexed();
+	Bench_Readback();
+	Bench_Rate(&bench_sd_poll);
+	Bench_Rate(&bench_sd_burst);
+	Bench_Rate(&bench_fill_frames);
+	Bench_Rate(&bench_blit_frames);
+	Bench_Rate(&bench_fill_format);
+	Bench_Rate(&bench_rects);
+	Bench_Rate(&bench_clear);
+	Bench_Rate(&bench_stream);
+	Bench_Rate(&bench_text);
+	Bench_Rate(&bench_text_aa);
+	Bench_Rate(&bench_console);
+	Bench_Rate(&bench_geom);
+	Bench_Rate(&bench_image);
+	Bench_Rate(&bench_indexed);
+	Bench_Rate(&bench_readback);
+}
@@ -0,0 +1,124 @@
+
+#ifndef __BENCHMARK_H
+#define __BENCHMARK_H
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "spi_sched.h"
+
+/* @brief BENCHMARK If defined, the main runs the driver benchmarks after the
+ * initialization. The results are in the bench_* variables, read them with
+ * the debugger. */
+//#define BENCHMARK
+
+/* Bytes moved by the benchmark loops. */
+#define BENCH_BYTES	512
+
+/* SD card blocks read by the block read benchmark. */
+#define BENCH_BLOCKS	16
+
+/* @brief Result of one benchmark. The reference is the earlier (HAL) path,
+ * the new is the optimized path, both moved the same bytes. */
+
+typedef struct {
+	uint32_t cycles_ref;	// CPU cycles of the reference path.
+	uint32_t cycles_new;	// CPU cycles of the new path.
+	uint32_t bytes;			// Bytes moved by one path.
+	uint32_t rate_ref;		// Throughput of the reference path in bytes per second.
+	uint32_t rate_new;		// Throughput of the new path in bytes per second.
+} s_bench_result;
+
+/* @brief Bench_Init() Enable the DWT cycle counter. */
+void Bench_Init();
+
+/* @brief Bench_Cycles() The current value of the DWT cycle counter. */
+inline static uint32_t Bench_Cycles(){ return DWT->CYCCNT; }
+
+/* @brief RunBenchmarks() Run all of the benchmarks. The SPI buses must be initialized. */
+void RunBenchmarks();
+
+/* SD card bus: byte polling with HAL_SPI_Receive, and with SPI_Exchange. */
+extern s_bench_result bench_sd_poll;
+/* SD card bus: response reads with HAL_SPI_Receive, and with SPI_ExchangeBuf. */
+extern s_bench_result bench_sd_burst;
+
+/* Control lines: CS, DC line changes of BENCH_BYTES command transactions (reference: HAL_GPIO_WritePin(),
+ * new: BSRR/BRR stores). No bytes are moved, the bytes field is 0. */
+extern s_bench_result bench_pins;
+
+/* Display bus: full screen RGB565 fill (reference: 8 bit frames, new: 16 bit frames). */
+extern s_bench_result bench_fill_frames;
+/* Display: full screen fillrectangle (reference: RGB666, new: RGB565 pixel format). The bytes field
+ * is the pixel count, the rates are pixels per second. */
+extern s_bench_result bench_fill_format;
+/* Rectangles of the small primitive benchmark. */
+#define BENCH_RECTS	256
+
+/* Display: 8x8 fillrectangle calls (reference: new window every time, new: the same, cached window). The bytes
+ * field is the rectangle count, the rates are rectangles per second. */
+extern s_bench_result bench_rects;
+/* Display: full screen RGB565 clear (reference: buffer sized DMA chunks, new: fixed source DMA, 65535 frames
+ * per transfer). */
+extern s_bench_result bench_clear;
+/* Display: full screen RGB565 gradient (reference: make a buffer, send it, and wait, new: ping-pong streaming stage). */
+extern s_bench_result bench_stream;
+/* Lines of the text benchmark. */
+#define BENCH_TEXT_LINES	40
+
+/* Display: BENCH_TEXT_LINES lines of 39 characters with font5x7 (reference: one window per character, new: one window
+ * per line). The bytes field is the character count, the rates are characters per second. */
+extern s_bench_result bench_text;
+/* Lines of the anti-aliased text benchmark. */
+#define BENCH_TEXT_AA_LINES	20
+
+/* Display: BENCH_TEXT_AA_LINES lines of 25 characters (reference: 1 bpp font10x16, new: 4 bpp anti-aliased font10x16aa).
+ * The bytes field is the character count, the rates are characters per second. */
+extern s_bench_result bench_text_aa;
+/* Lines of the console benchmark. */
+#define BENCH_CONSOLE_LINES	100
+
+/* Display: BENCH_CONSOLE_LINES log lines on a full screen font5x7 console, one line at a time (reference: redraw of the
+ * visible rows, new: one row, and the hardware scroll). The bytes field is the line count, the rates are lines per second. */
+extern s_bench_result bench_console;
+/* Primitives of the geometry benchmark. */
+#define BENCH_GEOM_PRIMS	32
+
+/* Display: BENCH_GEOM_PRIMS lines, and circles (reference: a window per pixel, new: a window per span). The bytes field
+ * is the primitive count, the rates are primitives per second. */
+extern s_bench_result bench_geom;
+/* Blits of the image benchmark. */
+#define BENCH_IMAGES	10
+
+/* Display: BENCH_IMAGES blits of the 160x100 RLE dialog image from the flash (reference: every pixel decoded into the
+ * stage buffers, new: the long runs as DMA fills). */
+extern s_bench_result bench_image;
+/* Blits of the indexed image benchmark. */
+#define BENCH_INDEXED	10
+
+/* Display: BENCH_INDEXED blits of the 96x32 4 bpp icons (reference: the palette color of every pixel converted, new: the
+ * lookup table of the palette). */
+extern s_bench_result bench_indexed;
+/* Display: full screen readback to RGB565 (reference: ILI9341_getpixels() line by line, and the conversion after the
+ * read, new: one RAMRD, and the conversion while the DMA reads the next chunk). */
+extern s_bench_result bench_readback;
+/* Display bus: 160x120 RGB565 blit from the flash (reference: 8 bit frames, new: 16 bit frames). */
+extern s_bench_result bench_blit_frames;
+
+/* @brief Bench_SDBlocks(first_block) Read BENCH_BLOCKS blocks from the SD card with the HAL polling, and with
+ * the DMA data phase. The SD card must be initialized. */
+void Bench_SDBlocks(uint32_t first_block);
+
+/* SD card bus: block reads (reference: HAL_SPI_Receive data phase, new: DMA with constant 0xFF source). */
+extern s_bench_result bench_sd_blocks;
+
+#if defined (SPI_BUS_STATS)
+/* @brief Bench_SDStream(first_block) Stream a full screen image from the SD card to the display,
+ * and measure the utilization, and the overlap of the buses. The SD card must be initialized. */
+void Bench_SDStream(uint32_t first_block);
+
+/* Bus utilization of the SD card to display stream. */
+extern s_spi_bus_stats bench_stream_display;
+extern s_spi_bus_stats bench_stream_sd;
+#endif
+
+#endif
@@ -8,6 +8,7 @@
 #include "init.h"
 #include "sd_spi.h"
 #include "ili9341_spi.h"
+#include "benchmark.h"
 
 extern s_image button;
 
@@ -72,6 +73,10 @@ int main()
 	DISPLAY_SPI1_Init();	// Initialize SPI1 for display.
 	ILI9341_Init();
 
+#if defined (BENCHMARK)
+	RunBenchmarks();
+#endif
+
 	color[0] = 0b00100000;
 	color[1] = 0b10000100;
 	color[2] = 0b10000100;
@@ -109,6 +114,10 @@ int main()
 				if (SPIModeInitialize() == SD_SPI_OK)
 				{
 					SetFastSPI();
+#if defined (BENCHMARK)
+					Bench_SDBlocks(0);
+					Bench_SDStream(0);
+#endif
 
 					GetCIDRegister(cid_string);
 	//				GetCSDRegister();
@@ -0,0 +1,166 @@
+/*
+ * Screen capture to the SD card. The display readback converts the chunks to RGB565, the sink packs them into
+ * two SD block buffers: the card writes one (DMA), while the next one is filled.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "spi.h"
+#include "sd_spi.h"
+#include "ili9341_spi.h"
+#include "screenshot.h"
+
+/* Number of the block buffers. */
+#define SCREENSHOT_BUFFERS	2
+
+typedef struct {
+#if defined (SD_SPI_DMA)
+	s_sd_request req[SCREENSHOT_BUFFERS];	// SD card block writes.
+#endif
+	uint8_t buffer;				// The block buffer under fill.
+	uint16_t pos;				// Bytes in the block buffer.
+	uint16_t width;				// Pixels of a row.
+	uint16_t column;			// The next pixel in the row.
+	uint8_t pad;				// Padding bytes after a row.
+	volatile uint8_t error;		// A block write was failed.
+} s_screenshot;
+
+static uint8_t screenshot_blocks[SCREENSHOT_BUFFERS][SDHX_BLOCSIZE];
+
+uint32_t ScreenshotSize(uint16_t width, uint16_t height)
+{
+	return SCREENSHOT_HEADER_SIZE + (((uint32_t)width * 2 + 3) & ~3UL) * height;
+}
+
+#if defined (SD_SPI_DMA)
+
+static void Screenshot_SDDone(s_sd_request* req, SD_SPI_STATE state)
+{	s_screenshot* shot = req->arg;
+	if (state != SD_SPI_OK) shot->error = 1;
+}
+
+#endif
+
+/*
+ * @brief Screenshot_Flush(shot) Write the full block buffer, and switch to the other one. The write of the other one is
+ * done, when the next one starts (the SD card bus is flushed before the start block token).
+ */
+
+static uint8_t Screenshot_Flush(s_screenshot* shot)
+{	uint8_t* block = screenshot_blocks[shot->buffer];
+#if defined (SD_SPI_DMA)
+	if (shot->error || (WriteMultipleBlockAsync(block, &shot->req[shot->buffer], Screenshot_SDDone, shot) != SD_SPI_OK)) return 0;
+#else
+	if (WriteMultipleBlock(block) != SD_SPI_OK) return 0;
+#endif
+	shot->buffer = (shot->buffer + 1) % SCREENSHOT_BUFFERS;
+	shot->pos = 0;
+	return 1;
+}
+
+/* @brief Screenshot_Put(shot, data, size) Add bytes to the file. */
+
+static uint8_t Screenshot_Put(s_screenshot* shot, const uint8_t* data, uint16_t size)
+{	uint16_t n;
+	while (size)
+	{
+		n = SDHX_BLOCSIZE - shot->pos;
+		if (n > size) n = size;
+		memcpy(&screenshot_blocks[shot->buffer][shot->pos], data, n);
+		shot->pos += n;
+		data += n;
+		size -= n;
+		if ((shot->pos == SDHX_BLOCSIZE) && !Screenshot_Flush(shot)) return 0;
+	}
+	return 1;
+}
+
+static void Screenshot_Put32(uint8_t* dst, uint32_t value)
+{
+	dst[0] = value;
+	dst[1] = value >> 8;
+	dst[2] = value >> 16;
+	dst[3] = value >> 24;
+}
+
+/* @brief Screenshot_Header(shot, width, height) The file header, the info header, and the bit field masks of RGB565. */
+
+static uint8_t Screenshot_Header(s_screenshot* shot, uint16_t width, uint16_t height)
+{	uint8_t header[SCREENSHOT_HEADER_SIZE];
+	memset(header, 0, sizeof(header));
+	header[0] = 'B';
+	header[1] = 'M';
+	Screenshot_Put32(&header[2], ScreenshotSize(width, height));
+	Screenshot_Put32(&header[10], SCREENSHOT_HEADER_SIZE);
+	Screenshot_Put32(&header[14], 40);
+	Screenshot_Put32(&header[18], width);
+	/* Negative height: the first row is the top one, as the display reads it. */
+	Screenshot_Put32(&header[22], -(int32_t)height);
+	header[26] = 1;		// Planes.
+	header[28] = 16;	// Bits per pixel.
+	header[30] = 3;		// BI_BITFIELDS
+	Screenshot_Put32(&header[34], ScreenshotSize(width, height) - SCREENSHOT_HEADER_SIZE);
+	Screenshot_Put32(&header[38], 2835);	// 72 DPI
+	Screenshot_Put32(&header[42], 2835);
+	Screenshot_Put32(&header[54], 0xF800);
+	Screenshot_Put32(&header[58], 0x07E0);
+	Screenshot_Put32(&header[62], 0x001F);
+	return Screenshot_Put(shot, header, sizeof(header));
+}
+
+/*
+ * @brief Screenshot_Sink(pixels, count, arg) The readback chunk to the block buffers: the pixels become little endian
+ * in place, and go row by row with the padding.
+ */
+
+static uint8_t Screenshot_Sink(t_color565* pixels, uint16_t count, void* arg)
+{	s_screenshot* shot = arg; static const uint8_t pad[3]; uint8_t* bytes = (uint8_t*)pixels; uint16_t i, n;
+	for (i = 0; i < count; i++)
+	{
+		n = pixels[i];
+		bytes[i * 2] = n;
+		bytes[i * 2 + 1] = n >> 8;
+	}
+	while (count)
+	{
+		n = shot->width - shot->column;
+		if (n > count) n = count;
+		if (!Screenshot_Put(shot, bytes, n * 2)) return 0;
+		bytes += n * 2;
+		count -= n;
+		shot->column += n;
+		if (shot->column == shot->width)
+		{
+			shot->column = 0;
+			if (shot->pad && !Screenshot_Put(shot, pad, shot->pad)) return 0;
+		}
+	}
+	return 1;
+}
+
+HAL_StatusTypeDef ScreenshotToSD(uint32_t first_block, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{	static s_screenshot shot; HAL_StatusTypeDef result;
+
+	shot.buffer = 0;
+	shot.pos = 0;
+	shot.width = width;
+	shot.column = 0;
+	shot.pad = (4 - (width * 2) % 4) % 4;
+	shot.error = 0;
+	if (!width || !height || (WriteMultipleStart(SD_BlockAddress(first_block)) != SD_SPI_OK)) return HAL_ERROR;
+	result = (Screenshot_Header(&shot, width, height)) ? ILI9341_readback(x, y, width, height, Screenshot_Sink, &shot) : HAL_ERROR;
+	if ((result == HAL_OK) && shot.pos)
+	{
+		memset(&screenshot_blocks[shot.buffer][shot.pos], 0, SDHX_BLOCSIZE - shot.pos);
+		if (!Screenshot_Flush(&shot)) result = HAL_ERROR;
+	}
+	/* The stop token ends the write on error too, it waits for the last block. */
+	if ((WriteMultipleStop() != SD_SPI_OK) || shot.error) result = HAL_ERROR;
+	return result;
+}
+
+HAL_StatusTypeDef Screenshot(uint32_t first_block)
+{
+	return ScreenshotToSD(first_block, 0, 0, ILI9341_WIDTH, ILI9341_HEIGHT);
+}
@@ -0,0 +1,30 @@
+#ifndef __SCREENSHOT_H
+#define __SCREENSHOT_H
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/*
+ * Screen capture to the SD card as a BMP file: 16 bit RGB565 pixels with bit field masks, the rows top-down
+ * (negative height), padded to 4 bytes. The file goes to consecutive blocks of the card, the last block is
+ * padded with zero bytes.
+ */
+
+/* Size of the BMP headers: file header (14), info header (40), and the red, green, blue masks (12). */
+#define SCREENSHOT_HEADER_SIZE	66
+
+/* @brief ScreenshotSize(width, height) The size of the BMP file of the window in bytes. */
+uint32_t ScreenshotSize(uint16_t width, uint16_t height);
+
+/*
+ * @brief ScreenshotToSD(first_block, x, y, width, height) Write the window of the display to the SD card as a BMP
+ * file from the first_block block (ScreenshotSize() bytes). The display is read once in chunks, and the SD card
+ * writes the blocks of the previous chunk meanwhile (multiple block write), there is no frame buffer. The SD card
+ * must be initialized.
+ */
+HAL_StatusTypeDef ScreenshotToSD(uint32_t first_block, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/* @brief Screenshot(first_block) Write the whole screen to the SD card as a BMP file. */
+HAL_StatusTypeDef Screenshot(uint32_t first_block);
+
+#endif
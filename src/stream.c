@@ -0,0 +1,82 @@
+
+/*
+ * Streaming from the SD card (SPI2) to the display (SPI1). The two buses work at the
+ * same time with the help of the bus scheduler pipe.
+ */
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+#include "spi.h"
+#include "spi_sched.h"
+#include "sd_spi.h"
+#include "ili9341_spi.h"
+#include "stream.h"
+
+typedef struct {
+	s_spi_pipe pipe;
+	s_sd_request req[SPI_PIPE_SLOTS];	// SD card block reads.
+	s_spi_xfer xfer[SPI_PIPE_SLOTS];	// Display writes.
+	uint16_t length[SPI_PIPE_SLOTS];	// Used bytes of the blocks.
+	uint32_t block;						// The next block to read.
+	uint32_t remain;					// Bytes to read.
+} s_sd_display_stream;
+
+static uint8_t stream_buffers[SPI_PIPE_SLOTS][SDHX_BLOCSIZE];
+
+static void Stream_SDDone(s_sd_request* req, SD_SPI_STATE state)
+{	s_sd_display_stream* stream = req->arg; uint8_t slot = req - stream->req;
+	if (state == SD_SPI_OK)
+	{
+		SPI_PipeFilled(&stream->pipe, slot, stream->length[slot]);
+	} else SPI_PipeFailed(&stream->pipe);
+}
+
+static void Stream_DisplayDone(s_spi_xfer* xfer, e_dma_transfer_state state)
+{	s_sd_display_stream* stream = xfer->arg; uint8_t slot = xfer - stream->xfer;
+	if (state == TRANSFER_COMPLETE)
+	{
+		SPI_PipeDrained(&stream->pipe, slot);
+	} else SPI_PipeFailed(&stream->pipe);
+}
+
+static uint8_t Stream_Fill(s_spi_pipe* pipe, uint8_t slot)
+{	s_sd_display_stream* stream = pipe->arg;
+	/* The last block is used partially. */
+	stream->length[slot] = (stream->remain < SDHX_BLOCSIZE) ? stream->remain : SDHX_BLOCSIZE;
+	if (ReadDataBlockAsync(SD_BlockAddress(stream->block), pipe->buffer[slot], &stream->req[slot], Stream_SDDone, stream) != SD_SPI_OK)
+	{
+		return 0;
+	}
+	stream->remain -= stream->length[slot];
+	stream->block++;
+	return 1;
+}
+
+static uint8_t Stream_Drain(s_spi_pipe* pipe, uint8_t slot)
+{	s_sd_display_stream* stream = pipe->arg;
+	ILI9341_buf_to_disp_async(&stream->xfer[slot], pipe->buffer[slot], pipe->length[slot], Stream_DisplayDone, stream);
+	return 1;
+}
+
+HAL_StatusTypeDef StreamImageFromSD(uint32_t first_block, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{	static s_sd_display_stream stream; uint8_t* buffers[SPI_PIPE_SLOTS]; int i;
+
+	for (i = 0; i < SPI_PIPE_SLOTS; i++)
+	{
+		buffers[i] = stream_buffers[i];
+	}
+	stream.block = first_block;
+	stream.remain = (uint32_t)width * height * ILI9341_BytesPerPixel();
+
+	ILI9341_setaddr(x, y, x + width - 1, y + height - 1);
+	ILI9341_writecmd(ILI9341_RAMWR);
+
+	SPI_PipeInit(&stream.pipe, &sd_spi2_bus, &display_spi1_bus, buffers,
+			(stream.remain + SDHX_BLOCSIZE - 1) / SDHX_BLOCSIZE, Stream_Fill, Stream_Drain, &stream);
+	return SPI_PipeRun(&stream.pipe, STREAM_TIMEOUT);
+}
+
+uint8_t StreamReadBlock(uint32_t block, uint8_t* buffer)
+{
+	return ReadDataBlock(SD_BlockAddress(block), buffer) == SD_SPI_OK;
+}
@@ -0,0 +1,24 @@
+
+#ifndef __STREAM_H
+#define __STREAM_H
+
+#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/* @brief Timeout of a whole stream in milliseconds. */
+#define STREAM_TIMEOUT	5000
+
+/*
+ * @brief StreamImageFromSD(first_block, x, y, width, height) Show a raw image from the
+ * SD card. The pixel data (in the display pixel format, ILI9341_BytesPerPixel() bytes per pixel,
+ * row by row) starts at the first_block block, and continues in the next blocks. The
+ * SD card reads the next block while the display writes the previous one. The SD card
+ * must be initialized.
+ */
+HAL_StatusTypeDef StreamImageFromSD(uint32_t first_block, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/* @brief StreamReadBlock(block, buffer) Read a block of the SD card, the block reader of the display list blits
+ * (ili9341_dlist.h). @retval 1, or 0 on error. */
+uint8_t StreamReadBlock(uint32_t block, uint8_t* buffer);
+
+#endif